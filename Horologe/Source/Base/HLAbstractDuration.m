@@ -45,8 +45,8 @@
     id<HLReadableDuration> thisDuration = (id<HLReadableDuration>)self;
     id<HLReadableDuration> otherDuration = (id<HLReadableDuration>)obj;
     
-    NSInteger thisMillis = [thisDuration millis];
-    NSInteger otherMillis = [otherDuration millis];
+    int64_t thisMillis = [thisDuration millis];
+    int64_t otherMillis = [otherDuration millis];
     
     // cannot do (thisMillis - otherMillis) as it can overflow
     if (thisMillis < otherMillis) {
@@ -105,7 +105,7 @@
 //-----------------------------------------------------------------------
 - (NSString*)description {
     
-    NSInteger millis = [self millis];
+    int64_t millis = [self millis];
     NSMutableString* buf = [NSMutableString string];
     [buf appendString:@"PT"];
     [HLFormatUtils appendUnpaddedInteger:(millis / 1000)
@@ -241,7 +241,7 @@
  * @param instant  a millisecond instant to check against
  * @return true if this instant is after the instant passed in
  */
-- (BOOL)isAfterInstantValue:(NSInteger)instant;
+- (BOOL)isAfterInstantValue:(int64_t)instant;
 
 /**
  * Is this instant after the current instant
@@ -268,7 +268,7 @@
  * @param instant  a millisecond instant to check against
  * @return true if this instant is before the instant passed in
  */
-- (BOOL)isBeforeInstantValue:(NSInteger)instant;
+- (BOOL)isBeforeInstantValue:(int64_t)instant;
 
 /**
  * Is this instant before the current instant
@@ -295,7 +295,7 @@
  * @param instant  a millisecond instant to check against
  * @return true if this instant is before the instant passed in
  */
-- (BOOL)isEqualToInstant:(NSInteger)instant;
+- (BOOL)isEqualToInstant:(int64_t)instant;
 
 /**
  * Is this instant equal to the current instant
@@ -23,6 +23,7 @@
 
 #import "HLConstants.h"
 #import "HLChronology.h"
+#import "HLDateBridge.h"
 #import "HLDateTimeUtils.h"
 
 
@@ -119,7 +120,7 @@
 
 //-----------------------------------------------------------------------
 - (NSDate*)toDate {
-    return [[[NSDate alloc] initWithTimeIntervalSince1970:([self millis] / 1000)] autorelease];
+    return HLDateFromMillis([self millis]);
 }
 
 //-----------------------------------------------------------------------
@@ -152,8 +153,8 @@
     
     id<HLReadableInstant> otherInstant = (id<HLReadableInstant>)instant;
     
-    NSInteger otherMillis = [otherInstant millis];
-    NSInteger thisMillis = [self millis];
+    int64_t otherMillis = [otherInstant millis];
+    int64_t thisMillis = [self millis];
     
     // cannot do (thisMillis - otherMillis) as can overflow
     if (thisMillis == otherMillis) {
@@ -167,44 +168,44 @@
 }
 
 //-----------------------------------------------------------------------
-- (BOOL)isAfter:(NSInteger)instant {
+- (BOOL)isAfter:(int64_t)instant {
     return ([self millis] > instant);
 }
 
 - (BOOL)isAfterNow {
-    return [self isAfter:[HLDateTimeUtils currentTimeMillis]];
+    return [self isAfter:HLCurrentTimeMillis()];
 }
 
 - (BOOL)isAfter:(id<HLReadableInstant>)instant {
-    NSInteger instantMillis = [HLDateTimeUtils instantMillis:instant];
+    int64_t instantMillis = [HLDateTimeUtils instantMillis:instant];
     return [self isAfter:instantMillis];
 }
 
 //-----------------------------------------------------------------------
-- (BOOL)isBefore:(NSInteger)instant {
+- (BOOL)isBefore:(int64_t)instant {
     return ([self millis] < instant);
 }
 
 - (BOOL)isBeforeNow {
-    return [self isBefore:[HLDateTimeUtils currentTimeMillis]];
+    return [self isBefore:HLCurrentTimeMillis()];
 }
 
 - (BOOL)isBefore:(id<HLReadableInstant>)instant {
-    NSInteger instantMillis = [HLDateTimeUtils instantMillis:instant];
+    int64_t instantMillis = [HLDateTimeUtils instantMillis:instant];
     return [self isBefore:instantMillis];
 }
 
 //-----------------------------------------------------------------------
-- (BOOL)isEqual:(NSInteger)instant {
+- (BOOL)isEqual:(int64_t)instant {
     return ([self millis] == instant);
 }
 
 - (BOOL)isEqualNow {
-    return [self isEqual:[HLDateTimeUtils currentTimeMillis]];
+    return [self isEqual:HLCurrentTimeMillis()];
 }
 
 - (BOOL)isEqual:(id<HLReadableInstant>)instant {
-    NSInteger instantMillis = [HLDateTimeUtils instantMillis:instant];
+    int64_t instantMillis = [HLDateTimeUtils instantMillis:instant];
     return [self isEqual:instantMillis];
 }
 
@@ -92,7 +92,7 @@
  *  millisecond instant from 1970-01-01T00:00:00Z
  * @return true if this time interval contains the millisecond
  */
-- (BOOL)contains:(NSInteger)millisInstant;
+- (BOOL)contains:(int64_t)millisInstant;
 
 /**
  * Does this time interval contain the current instant.
@@ -217,7 +217,7 @@
  *  millisecond instant from 1970-01-01T00:00:00Z
  * @return true if this time interval is before the instant
  */
-- (BOOL)isBeforeInstantValue:(NSInteger)millisInstant;
+- (BOOL)isBeforeInstantValue:(int64_t)millisInstant;
 
 /**
  * Is this time interval before the current instant.
@@ -258,7 +258,7 @@
  *  millisecond instant from 1970-01-01T00:00:00Z
  * @return true if this time interval is after the instant
  */
-- (BOOL)isAfterInstantValue:(NSInteger)millisInstant;
+- (BOOL)isAfterInstantValue:(int64_t)millisInstant;
 
 /**
  * Is this time interval after the current instant.
@@ -316,7 +316,7 @@
  * @return the duration of the time interval in milliseconds
  * @throws ArithmeticException if the duration exceeds the capacity of a long
  */
-- (NSInteger)toDurationMillis;
+- (int64_t)toDurationMillis;
 
 /**
  * Gets the duration of this time interval.
@@ -24,6 +24,7 @@
 #import "HLConstants.h"
 #import "HLDateTime.h"
 #import "HLDateTimeUtils.h"
+#import "HLFieldUtils.h"
 #import "HLReadableInstant.h"
 #import "HLReadableInterval.h"
 #import "HLInterval.h"
@@ -68,14 +69,14 @@
 }
 
 //-----------------------------------------------------------------------
-- (BOOL)contains:(NSInteger)millisInstant {
-    NSInteger thisStart = [self startMillis];
-    NSInteger thisEnd = [self endMillis];
+- (BOOL)contains:(int64_t)millisInstant {
+    int64_t thisStart = [self startMillis];
+    int64_t thisEnd = [self endMillis];
     return (millisInstant >= thisStart && millisInstant < thisEnd);
 }
 
 - (BOOL)containsNow {
-    return [self contains:[HLDateTimeUtils currentTimeMillis]];
+    return [self contains:HLCurrentTimeMillis()];
 }
 
 - (BOOL)containsInstant:(id<HLReadableInstant>)instant {
@@ -91,36 +92,36 @@
         return [self containsNow];
     }
     
-    NSInteger otherStart = [interval startMillis];
-    NSInteger otherEnd = [interval endMillis];
-    NSInteger thisStart = [self startMillis];
-    NSInteger thisEnd = [self endMillis];
+    int64_t otherStart = [interval startMillis];
+    int64_t otherEnd = [interval endMillis];
+    int64_t thisStart = [self startMillis];
+    int64_t thisEnd = [self endMillis];
     
     return (thisStart <= otherStart && otherStart < thisEnd && otherEnd <= thisEnd);
 }
 
 - (BOOL)overlaps:(id<HLReadableInterval>)interval {
-    NSInteger thisStart = [self startMillis];
-    NSInteger thisEnd = [self endMillis];
+    int64_t thisStart = [self startMillis];
+    int64_t thisEnd = [self endMillis];
     
     if (interval == nil) {
-        NSInteger now = [HLDateTimeUtils currentTimeMillis];
+        int64_t now = HLCurrentTimeMillis();
         return (thisStart < now && now < thisEnd);
     }  
     else {
-        NSInteger otherStart = [interval startMillis];
-        NSInteger otherEnd = [interval endMillis];
+        int64_t otherStart = [interval startMillis];
+        int64_t otherEnd = [interval endMillis];
         return (thisStart < otherEnd && otherStart < thisEnd);
     }
 }
 
 //-----------------------------------------------------------------------
-- (BOOL)isBeforeInstantValue:(NSInteger)millisInstant {
+- (BOOL)isBeforeInstantValue:(int64_t)millisInstant {
     return ([self endMillis] <= millisInstant);
 }
 
 - (BOOL)isBeforeNow {
-    return [self isBefore:[HLDateTimeUtils currentTimeMillis]];
+    return [self isBefore:HLCurrentTimeMillis()];
 }
 
 - (BOOL)isBeforeInstant:(id<HLReadableInstant>)instant {
@@ -140,12 +141,12 @@
 }
 
 //-----------------------------------------------------------------------
-- (BOOL)isAfterInstantValue:(NSInteger)millisInstant {
+- (BOOL)isAfterInstantValue:(int64_t)millisInstant {
     return ([self startMillis] > millisInstant);
 }
 
 - (BOOL)isAfterNow {
-    return [self isAfter:[HLDateTimeUtils currentTimeMillis]];
+    return [self isAfter:HLCurrentTimeMillis()];
 }
 
 - (BOOL)isAfterInstant:(id<HLReadableInstant>)instant {
@@ -157,9 +158,9 @@
 }
 
 - (BOOL)isAfterInterval:(id<HLReadableInterval>)interval {
-    NSInteger endMillis;
+    int64_t endMillis;
     if (interval == nil) {
-        endMillis = [HLDateTimeUtils currentTimeMillis]
+        endMillis = HLCurrentTimeMillis();
     } 
     else {
         endMillis = [interval endMillis];
@@ -182,13 +183,12 @@
 }
 
 //-----------------------------------------------------------------------
-- (NSInteger)toDurationMillis {
-    return [HLFieldUtils safeAddMillis:[self endMillis]
-                              toMillis:-[self startMillis]];
+- (int64_t)toDurationMillis {
+    return HLSafeSubtract([self endMillis], [self startMillis]);
 }
 
 - (HLDuration*)toDuration {
-    NSInteger durMillis = [self toDurationMillis];
+    int64_t durMillis = [self toDurationMillis];
     if (durMillis == 0) {
         return [HLDuration zeroDuration];
     } 
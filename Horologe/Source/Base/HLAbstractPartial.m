@@ -193,11 +193,11 @@
  */
 - (HLDateTime*)toDateTime:(id<HLReadableInstant>)baseInstant {
     HLChronology* chrono = [HLDateTimeUtils instantChronology:baseInstant];
-    NSInteger instantMillis = [HLDateTimeUtils instantMillis:baseInstant];
-    NSInteger resolved = [chrono set:self
-                              millis:instantMillis];
-    return [[[HLDateTime alloc] initWithMillis:[self resolved]
-                                    chronology:chrono] autorelease];
+    int64_t instantMillis = [HLDateTimeUtils instantMillis:baseInstant];
+    int64_t resolved = [chrono setPartial:self
+                              intoInstant:instantMillis];
+    return [[[HLDateTime alloc] initWithInstantValue:resolved
+                                          chronology:chrono] autorelease];
 }
 
 //-----------------------------------------------------------------------
@@ -44,7 +44,7 @@
     
 @private
     /** The millis from 1970-01-01T00:00:00Z */
-    NSInteger _iMillis;
+    int64_t _iMillis;
     /** The chronology to use */
     HLChronology* _iChronology;
     
@@ -80,7 +80,7 @@
  *
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  */
-- (id)initWithInstant:(NSInteger)instant;
+- (id)initWithInstant:(int64_t)instant;
 
 /**
  * Constructs an instance set to the milliseconds from 1970-01-01T00:00:00Z
@@ -91,7 +91,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param zone  the time zone, nil means default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant
+- (id)initWithInstantValue:(int64_t)instant
                       zone:(HLDateTimeZone*)zone;
 
 /**
@@ -104,7 +104,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param chronology  the chronology, nil means ISOChronology in default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant
+- (id)initWithInstantValue:(int64_t)instant
                 chronology:(HLChronology*)chronology;
 
 //-----------------------------------------------------------------------
@@ -235,8 +235,8 @@
  * @param chronology  the chronology to use, not nil
  * @return the instant to store in this datetime
  */
-- (NSInteger)checkInstant:(NSInteger)instant
-               chronology:(HLChronology*)chronology;
+- (int64_t)checkInstant:(int64_t)instant
+             chronology:(HLChronology*)chronology;
 
 //-----------------------------------------------------------------------
 /**
@@ -245,7 +245,7 @@
  * 
  * @return the number of milliseconds since 1970-01-01T00:00:00Z
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 /**
  * Gets the chronology of the datetime.
@@ -263,7 +263,7 @@
  *
  * @param instant  the milliseconds since 1970-01-01T00:00:00Z to set the datetime to
  */
-- (void)setMillis:(NSInteger)instant;
+- (void)setMillis:(int64_t)instant;
 
 /**
  * Sets the chronology of the datetime.
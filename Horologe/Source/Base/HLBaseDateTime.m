@@ -47,7 +47,7 @@
 
 //-----------------------------------------------------------------------
 - (id)init {
-    self = [self initWithInstant:[HLDateTimeUtils currentTimeMillis]
+    self = [self initWithInstant:HLCurrentTimeMillis()
                       chronology:[[[HLISOChronology alloc] init] autorelease]];
     if(self) {
         
@@ -57,7 +57,7 @@
 }
 
 - (id)initWithDateTimeZone:(HLDateTimeZone *)zone {
-    self = [self initWithInstant:[HLDateTimeUtils currentTimeMillis]
+    self = [self initWithInstant:HLCurrentTimeMillis()
                       chronology:[[[HLISOChronology alloc] initWithDateTimeZone:zone] autorelease]];
     if(self) {
         
@@ -67,7 +67,7 @@
 }
 
 - (id)initWithChronology:(HLChronology *)chronology {
-    self = [self initWithInstant:[HLDateTimeUtils currentTimeMillis]
+    self = [self initWithInstant:HLCurrentTimeMillis()
                       chronology:chronology];
     if(self) {
         
@@ -77,7 +77,7 @@
 }
 
 //-----------------------------------------------------------------------
-- (id)initWithInstant:(NSInteger)instant {
+- (id)initWithInstant:(int64_t)instant {
     self = [self initWithInstant:instant
                       chronology:[[[HLISOChronology alloc] init] autorelease]];
     if(self) {
@@ -200,7 +200,7 @@
     self = [super init];
     if(self) {
         _iChronology = [[self _checkChronology:chronology] retain];
-        NSInteger instant = [_iChronology dateTimeMillisWithYear:year
+        int64_t instant = [_iChronology dateTimeMillisWithYear:year
                                                            month:monthOfYear
                                                              day:dayOfMonth
                                                             hour:hourOfDay
@@ -219,13 +219,13 @@
     return [HLDateTimeUtils chronology:chronology];
 }
 
-- (NSInteger)checkInstant:(NSInteger)instant
-                chronology:(HLChronology*)chronology {
+- (int64_t)checkInstant:(int64_t)instant
+              chronology:(HLChronology*)chronology {
     return instant;
 }
 
 //-----------------------------------------------------------------------
-- (NSInteger)millis {
+- (int64_t)millis {
     return _iMillis;
 }
 
@@ -234,7 +234,7 @@
 }
 
 //-----------------------------------------------------------------------
-- (void)setMillis:(NSInteger)instant {
+- (void)setMillis:(int64_t)instant {
     
     [self willChangeValueForKey:@"millis"];
     _iMillis = [self _checkInstant:instant
@@ -49,7 +49,7 @@
     
 @private
     /** The duration length */
-    NSInteger _iMillis;
+    int64_t _iMillis;
     
 }
 
@@ -58,7 +58,7 @@
  *
  * @param duration  the duration, in milliseconds
  */
-- (id)initWithDurationValue:(NSInteger)duration;
+- (id)initWithDurationValue:(int64_t)duration;
 
 /**
  * Creates a duration from the given interval endpoints.
@@ -67,8 +67,8 @@
  * @param endInstant  interval end, in milliseconds
  * @throws ArithmeticException if the duration exceeds a 64 bit long
  */
-- (id)initWithStartInstantValue:(NSInteger)startInstant 
-                endInstantValue:(NSInteger)endInstant;
+- (id)initWithStartInstantValue:(int64_t)startInstant 
+                endInstantValue:(int64_t)endInstant;
 
 /**
  * Creates a duration from the given interval endpoints.
@@ -95,7 +95,7 @@
  *
  * @return the length of the duration in milliseconds.
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 //-----------------------------------------------------------------------
 /**
@@ -103,7 +103,7 @@
  * 
  * @param duration  the new length of the duration
  */
-- (void)setMillis:(NSInteger)duration;
+- (void)setMillis:(int64_t)duration;
 
 //-----------------------------------------------------------------------
 /**
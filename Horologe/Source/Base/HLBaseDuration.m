@@ -45,7 +45,7 @@
  */
 @implementation HLBaseDuration
 
-- (id)initWithDuration:(NSInteger)duration {
+- (id)initWithDuration:(int64_t)duration {
     self = [super init];
     if(self) {
         _iMillis = duration;
@@ -54,12 +54,11 @@
     return self;
 }
 
-- (id)initWithStart:(NSInteger)startInstant 
-                 end:(NSInteger)endInstant {
+- (id)initWithStart:(int64_t)startInstant 
+                 end:(int64_t)endInstant {
     self = [super init];
     if(self) {
-        _iMillis = [HLFieldUtils safeAddValue:endInstant
-                                     andValue:-startInstant];
+        _iMillis = HLSafeSubtract(endInstant, startInstant);
     }
     
     return self;
@@ -73,10 +72,9 @@
             _iMillis = 0L;
         } 
         else {
-            NSInteger startMillis = [HLDateTimeUtils instantMillis:start];
-            NSInteger endMillis = [HLDateTimeUtils instantMillis:end];
-            _iMillis = [HLFieldUtils safeAddValue:endMillis
-                                         andValue:-startMillis];
+            int64_t startMillis = [HLDateTimeUtils instantMillis:start];
+            int64_t endMillis = [HLDateTimeUtils instantMillis:end];
+            _iMillis = HLSafeSubtract(endMillis, startMillis);
         }
     }
     
@@ -94,12 +92,12 @@
 }
 
 //-----------------------------------------------------------------------
-- (NSInteger)millis {
+- (int64_t)millis {
     return _iMillis;
 }
 
 //-----------------------------------------------------------------------
-- (void)setMillis:(NSInteger)duration {
+- (void)setMillis:(int64_t)duration {
     
     [self willChangeValueForKey:@"millis"];
     _iMillis = duration;
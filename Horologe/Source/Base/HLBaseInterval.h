@@ -51,9 +51,9 @@
     /** The chronology of the interval */
     HLChronology* _iChronology;
     /** The start of the interval */
-    NSInteger _iStartMillis;
+    int64_t _iStartMillis;
     /** The end of the interval */
-    NSInteger _iEndMillis;
+    int64_t _iEndMillis;
     
 }
 
@@ -65,8 +65,8 @@
  * @param chrono  the chronology to use, nil is ISO default
  * @throws IllegalArgumentException if the end is before the start
  */
-- (id)initWithStartInstantValue:(NSInteger)startInstant 
-                endInstantValue:(NSInteger)endInstant
+- (id)initWithStartInstantValue:(int64_t)startInstant 
+                endInstantValue:(int64_t)endInstant
                      chronology:(HLChronology*)chrono;
 
 /**
@@ -154,7 +154,7 @@
  * @return the start of the time interval,
  *  millisecond instant from 1970-01-01T00:00:00Z
  */
-- (NSInteger)startMillis;
+- (int64_t)startMillis;
 
 /**
  * Gets the end of this time interval which is exclusive.
@@ -162,7 +162,7 @@
  * @return the end of the time interval,
  *  millisecond instant from 1970-01-01T00:00:00Z
  */
-- (NSInteger)endMillis;
+- (int64_t)endMillis;
 
 //-----------------------------------------------------------------------
 /**
@@ -173,8 +173,8 @@
  * @param chrono  the chronology, not nil
  * @throws IllegalArgumentException if the end is before the start
  */
-- (void)setIntervalStart:(NSInteger)startInstant 
-                     end:(NSInteger)endInstant
+- (void)setIntervalStart:(int64_t)startInstant 
+                     end:(int64_t)endInstant
               chronology:(HLChronology*)chrono;
 
 @end
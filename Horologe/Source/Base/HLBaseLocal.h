@@ -53,6 +53,6 @@
  * 
  * @return the number of milliseconds since 1970-01-01T00:00:00
  */
-- (NSInteger)localMillis;
+- (int64_t)localMillis;
 
 @end
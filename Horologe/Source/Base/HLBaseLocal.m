@@ -27,7 +27,7 @@
 @implementation HLBaseLocal
 
 //-----------------------------------------------------------------------
-- (NSInteger)localMillis {
+- (int64_t)localMillis {
     [NSException raise:HL_UNIMPLEMENTED_EXCEPTION
                 format:@"%s must be implemented by subclass"];
 }
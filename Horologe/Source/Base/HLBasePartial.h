@@ -74,7 +74,7 @@
  *
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  */
-- (id)initWithInstantValue:(NSInteger)instant;
+- (id)initWithInstantValue:(int64_t)instant;
 
 /**
  * Constructs a partial extracting the partial fields from the specified
@@ -87,7 +87,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param chronology  the chronology, nil means ISOChronology in the default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant
+- (id)initWithInstantValue:(int64_t)instant
                 chronology:(HLChronology*)chronology;
 
 /**
@@ -28,7 +28,7 @@
 
     //-----------------------------------------------------------------------
 - (id)init {
-    self = [self initWithInstantValue:[HLDateTimeUtils currentTimeMillis]
+    self = [self initWithInstantValue:HLCurrentTimeMillis()
                            chronology:nil];
     if(self) {
         
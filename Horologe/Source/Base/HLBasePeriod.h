@@ -77,7 +77,7 @@
               hours:(NSInteger)hours 
             minutes:(NSInteger)minutes 
             seconds:(NSInteger)seconds 
-             millis:(NSInteger)millis
+             millis:(int64_t)millis
                type:(HLPeriodType*)type;
 
 /**
@@ -89,8 +89,8 @@
  * @param chrono  the chronology to use, nil means ISO default
  * @throws IllegalArgumentException if period type is invalid
  */
-- (id)initWithStartInstantValue:(NSInteger)startInstant 
-                     endInstant:(NSInteger)endInstant
+- (id)initWithStartInstantValue:(int64_t)startInstant 
+                     endInstant:(int64_t)endInstant
                            type:(HLPeriodType*)type
                      chronology:(HLChronology*)chrono;
 
@@ -162,7 +162,7 @@
  * @param chrono  the chronology to use, nil means ISO default
  * @throws IllegalArgumentException if period type is invalid
  */
-- (id)initWithDuration:(NSInteger)duration
+- (id)initWithDuration:(int64_t)duration
                   type:(HLPeriodType*)type
             chronology:(HLChronology*)chrono;
 
@@ -301,7 +301,7 @@
             hours:(NSInteger)hours 
           minutes:(NSInteger)minutes 
           seconds:(NSInteger)seconds 
-           millis:(NSInteger)millis;
+           millis:(int64_t)millis;
 
 //-----------------------------------------------------------------------
 /**
@@ -24,6 +24,7 @@
 #import "HLReadablePeriod.h"
 
 
+@class HLChronology;
 @class HLDurationFieldType;
 @class HLPeriod;
 @class HLMutablePeriod;
@@ -64,6 +65,50 @@
                       endInstant:(id<HLReadableInstant>)end
                        fieldType:(HLDurationFieldType*)field;
 
+/**
+ * Calculates the number of whole units between each pair of instants held
+ * as millis, with the same result as betweenStartInstant:endInstant:fieldType:
+ * gives for the pair.
+ * <p>
+ * Days, weeks and months in the ISO chronology in UTC are computed directly
+ * from the millis. Other fields and chronologies ask the duration field of
+ * the chronology for each pair.
+ *
+ * @param starts  the start millis, not NULL
+ * @param ends  the end millis, not NULL
+ * @param count  the number of pairs
+ * @param field  the field type to use, must not be nil
+ * @param chrono  the chronology to use, nil means ISO in UTC
+ * @param results  receives the difference of each pair, not NULL
+ * @throws IllegalArgumentException if the field type is nil
+ * @throws ArithmeticException if a difference cannot fit in NSInteger
+ */
++ (void)betweenStartMillis:(const int64_t*)starts
+                 endMillis:(const int64_t*)ends
+                     count:(NSUInteger)count
+                 fieldType:(HLDurationFieldType*)field
+                chronology:(HLChronology*)chrono
+                   results:(NSInteger*)results;
+
+/**
+ * Calculates the number of whole units between each pair of instants.
+ * <p>
+ * As with betweenStartInstant:endInstant:fieldType:, the chronology of each
+ * start instant is used. Consecutive pairs whose starts share a chronology
+ * are computed together by betweenStartMillis:endMillis:count:fieldType:chronology:results:.
+ *
+ * @param starts  the start instants, each a ReadableInstant, not nil
+ * @param ends  the end instants, each a ReadableInstant, not nil
+ * @param field  the field type to use, must not be nil
+ * @param results  receives the difference of each pair, sized for the count of starts
+ * @throws IllegalArgumentException if the arrays differ in count or the field type is nil
+ * @throws ArithmeticException if a difference cannot fit in NSInteger
+ */
++ (void)betweenStartInstants:(NSArray*)starts
+                 endInstants:(NSArray*)ends
+                   fieldType:(HLDurationFieldType*)field
+                     results:(NSInteger*)results;
+
 //-----------------------------------------------------------------------
 /**
  * Calculates the number of whole units between the two specified partial datetimes.
@@ -81,6 +126,25 @@
                       endPartial:(id<HLReadablePartial>)end
                             zero:(id<HLReadablePeriod>)zeroInstance;
 
+/**
+ * Calculates the number of whole units between the two specified partial
+ * datetimes, reporting invalid partials through an error rather than an
+ * exception.
+ *
+ * @param start  the start partial date, may be nil
+ * @param end  the end partial date, may be nil
+ * @param zeroInstance  the zero instance constant, must not be nil
+ * @param result  receives the period on success, not NULL
+ * @param error  receives an HL_ERROR_DOMAIN error if the partials are nil
+ *  or invalid, may be NULL
+ * @return YES if the period was calculated
+ */
++ (BOOL)tryBetweenStartPartial:(id<HLReadablePartial>)start
+                    endPartial:(id<HLReadablePartial>)end
+                          zero:(id<HLReadablePeriod>)zeroInstance
+                        result:(NSInteger*)result
+                         error:(NSError**)error;
+
 /**
  * Creates a new instance representing the number of complete standard length units
  * in the specified period.
@@ -102,7 +166,7 @@
  * @throws IllegalArgumentException if the period contains imprecise duration values
  */
 + (NSInteger)standardPeriodInPeriod:(id<HLReadablePeriod>)period 
-                             millis:(NSInteger)millisPerUnit;
+                             millis:(int64_t)millisPerUnit;
 
 //-----------------------------------------------------------------------
 /**
@@ -242,3 +306,47 @@
 - (NSComparisonResult)compareTo:(id)other;
 
 @end
+
+//-----------------------------------------------------------------------
+/** The smallest value held by a single field period pool. */
+#define HL_PERIOD_POOL_MIN -128
+/** The largest value held by a single field period pool. */
+#define HL_PERIOD_POOL_MAX 1024
+
+/**
+ * A preallocated set of immutable single field periods of one class, one
+ * for each value from HL_PERIOD_POOL_MIN to HL_PERIOD_POOL_MAX.
+ * <p>
+ * Immutable subclasses keep a pool in static storage, fill it from their
+ * +initialize and return its instances from their factory methods, so
+ * arithmetic on the small values that most code works with does not
+ * allocate. The runtime runs +initialize once, before any factory method,
+ * so the pool is full by the time it is read. Its instances live for the
+ * life of the process.
+ */
+typedef struct {
+    HLBaseSingleFieldPeriod* values[HL_PERIOD_POOL_MAX - HL_PERIOD_POOL_MIN + 1];
+} HLPeriodPool;
+
+/**
+ * Fills a pool with instances of a class, created with initWithPeriod:.
+ * Called once per pool from the +initialize of the class.
+ *
+ * @param pool  the pool to fill, not NULL
+ * @param periodClass  the immutable subclass to create
+ */
+extern void HLPeriodPoolFill(HLPeriodPool* pool, Class periodClass);
+
+/**
+ * Gets the pooled instance for a value.
+ *
+ * @param pool  the filled pool of the class, not NULL
+ * @param value  the period value
+ * @return the shared instance, or nil if the value is outside the pool
+ */
+static inline id HLPeriodPoolValue(const HLPeriodPool* pool, NSInteger value) {
+    if (value < HL_PERIOD_POOL_MIN || value > HL_PERIOD_POOL_MAX) {
+        return nil;
+    }
+    return pool->values[value - HL_PERIOD_POOL_MIN];
+}
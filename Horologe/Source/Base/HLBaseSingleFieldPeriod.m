@@ -26,68 +26,272 @@
 #import "HLDateTimeUtils.h"
 #import "HLFieldUtils.h"
 #import "HLDurationField.h"
+#import "HLDurationFieldType.h"
+#import "HLInstantSort.h"
+#import "HLInstantValue.h"
 #import "HLReadablePartial.h"
 #import "HLReadablePeriod.h"
 #import "HLISOChronology.h"
 
 
+/*
+ * Checks that two partials can be compared by betweenStart:end:zero:,
+ * returning the reason they cannot, or nil if they can.
+ */
+static NSString* HLPartialsProblem(id<HLReadablePartial> start, id<HLReadablePartial> end) {
+    if (start == nil || end == nil) {
+        return @"ReadablePartial objects must not be nil";
+    }
+    if ([start size] != [end size]) {
+        return @"ReadablePartial objects must have the same set of fields";
+    }
+    for(NSInteger i = 0, isize = [start size]; i < isize; i++) {
+        if ([start fieldTypeAtIndex:i] != [end fieldTypeAtIndex:i]) {
+            return @"ReadablePartial objects must have the same set of fields";
+        }
+    }
+    if([HLDateTimeUtils isContiguous:start] == NO) {
+        return @"ReadablePartial objects must be contiguous";
+    }
+    return nil;
+}
+
+/*
+ * Computes the single field difference between two checked partials.
+ */
+static int64_t HLPartialsDifference(id<HLReadablePartial> start, 
+                                    id<HLReadablePartial> end, 
+                                    id<HLReadablePeriod> zeroInstance) {
+    HLChronology* chrono = [[HLDateTimeUtils chronology:[start chronology]] withUTC];
+    NSInteger size = [zeroInstance size];
+    int64_t values[size > 0 ? size : 1];
+    [chrono valuesOfPeriod:zeroInstance
+         startInstantValue:[chrono setPartial:start
+                                  intoInstant:0]
+           endInstantValue:[chrono setPartial:end
+                                  intoInstant:0]
+                intoBuffer:values];
+    return values[0];
+}
+
+/*
+ * The largest magnitude of millis whose epoch day fits in HLLocalDateValue.
+ * Months beyond it are left to the chronology.
+ */
+static const int64_t HLMonthsDirectLimit = (int64_t) INT32_MAX * 86400000LL;
+
+/*
+ * Gets the number of days in an ISO month.
+ */
+static inline int32_t HLISODaysInMonth(int32_t year, int32_t monthOfYear) {
+    if (monthOfYear == 2) {
+        return ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0) ? 29 : 28;
+    }
+    // 31 days in odd months up to July, then in even months
+    return 30 + ((monthOfYear + (monthOfYear >> 3)) & 1);
+}
+
+/*
+ * Computes the months between two instants in the ISO chronology in UTC,
+ * following the month of year field: the difference of the year-months,
+ * less one if the end is earlier in its month than the start, where a
+ * start day past the last day of the end month counts as that last day.
+ */
+static int64_t HLISOMonthsBetween(int64_t start, int64_t end) {
+    int64_t sign = 1;
+    if (end < start) {
+        int64_t swap = start;
+        start = end;
+        end = swap;
+        sign = -1;
+    }
+    int64_t startDay = HLFloorDivide(start, HLInstantValueMillisPerDay);
+    int64_t endDay = HLFloorDivide(end, HLInstantValueMillisPerDay);
+    int32_t startYear, startMonth, startDom, endYear, endMonth, endDom;
+    HLLocalDateValueGetFields(HLLocalDateValueMakeWithEpochDay((int32_t) startDay), &startYear, &startMonth, &startDom);
+    HLLocalDateValueGetFields(HLLocalDateValueMakeWithEpochDay((int32_t) endDay), &endYear, &endMonth, &endDom);
+    
+    int64_t difference = ((int64_t) endYear - startYear) * 12 + endMonth - startMonth;
+    if (startDom > endDom && endDom == HLISODaysInMonth(endYear, endMonth)) {
+        startDom = endDom;
+    }
+    int64_t startRem = (startDom - 1) * HLInstantValueMillisPerDay + (start - startDay * HLInstantValueMillisPerDay);
+    int64_t endRem = (endDom - 1) * HLInstantValueMillisPerDay + (end - endDay * HLInstantValueMillisPerDay);
+    if (endRem < startRem) {
+        difference--;
+    }
+    return sign * difference;
+}
+
+//-----------------------------------------------------------------------
+void HLPeriodPoolFill(HLPeriodPool* pool, Class periodClass) {
+    for(NSInteger value = HL_PERIOD_POOL_MIN; value <= HL_PERIOD_POOL_MAX; value++) {
+        pool->values[value - HL_PERIOD_POOL_MIN] = [[periodClass alloc] initWithPeriod:value];
+    }
+}
+
 @implementation HLBaseSingleFieldPeriod
 
 //-----------------------------------------------------------------------
-+ (NSInteger)betweenStart:(id<HLReadableInstant>)start
-                       end:(id<HLReadableInstant>)end
-                 fieldType:(HLDurationFieldType*)field {
++ (NSInteger)betweenStartInstant:(id<HLReadableInstant>)start
+                      endInstant:(id<HLReadableInstant>)end
+                       fieldType:(HLDurationFieldType*)field {
     if (start == nil || end == nil) {
         [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
                     format:@"HLReadableInstant objects must not be nil"];
     }
     
     HLChronology* chrono = [HLDateTimeUtils instantChronology:start];
-    NSInteger amount = [[field field:chrono]
-                        difference:[end millis] 
-                        :[start millis]];
+    NSInteger amount = [[field fieldWithChronology:chrono]
+                        differenceBetweenMinuend:[end millis] 
+                        subtrahend:[start millis]];
     return amount;
 }
 
-//-----------------------------------------------------------------------
-+ (NSInteger)betweenStart:(id<HLReadablePartial>)start
-                       end:(id<HLReadablePartial>)end 
-                      zero:(id<HLReadablePeriod>)zeroInstance {
-    if (start == nil || end == nil) {
++ (void)betweenStartMillis:(const int64_t*)starts
+                 endMillis:(const int64_t*)ends
+                     count:(NSUInteger)count
+                 fieldType:(HLDurationFieldType*)field
+                chronology:(HLChronology*)chrono
+                   results:(NSInteger*)results {
+    if (field == nil) {
         [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
-                    format:@"ReadablePartial objects must not be nil"];
+                    format:@"HLDurationFieldType must not be nil"];
     }
-    if ([start size] != [end size]) {
+    HLChronology* isoUTC = [HLISOChronology instanceUTC];
+    if (chrono == nil) {
+        chrono = isoUTC;
+    }
+    
+    if (chrono == isoUTC) {
+        // days and weeks are precise in UTC, so the difference truncates
+        int64_t unitMillis = 0;
+        if (field == [HLDurationFieldType days]) {
+            unitMillis = HLInstantValueMillisPerDay;
+        } else if (field == [HLDurationFieldType weeks]) {
+            unitMillis = 7 * HLInstantValueMillisPerDay;
+        }
+        if (unitMillis != 0) {
+            for(NSUInteger i = 0; i < count; i++) {
+                results[i] = HLSafeToInteger(HLSafeSubtract(ends[i], starts[i]) / unitMillis);
+            }
+            return;
+        }
+    }
+    
+    HLDurationField* durationField = [field fieldWithChronology:chrono];
+    SEL selector = @selector(differenceBetweenMinuend:subtrahend:);
+    NSInteger (*difference)(id, SEL, int64_t, int64_t) =
+        (NSInteger (*)(id, SEL, int64_t, int64_t)) [durationField methodForSelector:selector];
+    
+    if (chrono == isoUTC && field == [HLDurationFieldType months]) {
+        for(NSUInteger i = 0; i < count; i++) {
+            int64_t start = starts[i];
+            int64_t end = ends[i];
+            if (start > -HLMonthsDirectLimit && start < HLMonthsDirectLimit &&
+                end > -HLMonthsDirectLimit && end < HLMonthsDirectLimit) {
+                results[i] = HLSafeToInteger(HLISOMonthsBetween(start, end));
+            } else {
+                results[i] = difference(durationField, selector, end, start);
+            }
+        }
+        return;
+    }
+    
+    for(NSUInteger i = 0; i < count; i++) {
+        results[i] = difference(durationField, selector, ends[i], starts[i]);
+    }
+}
+
++ (void)betweenStartInstants:(NSArray*)starts
+                 endInstants:(NSArray*)ends
+                   fieldType:(HLDurationFieldType*)field
+                     results:(NSInteger*)results {
+    if (starts == nil || ends == nil) {
         [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
-                    format:@"ReadablePartial objects must have the same set of fields"];
+                    format:@"HLReadableInstant arrays must not be nil"];
     }
-    for(NSInteger i = 0, isize = [start size]; i < isize; i++) {
-        if ([start fieldTypeAtIndex:i] != [end fieldTypeAtIndex:i]) {
-            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
-                        format:@"ReadablePartial objects must have the same set of fields"];
+    if (field == nil) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"HLDurationFieldType must not be nil"];
+    }
+    NSUInteger count = [starts count];
+    if ([ends count] != count) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"HLReadableInstant arrays must have the same count: %lu, %lu",
+         (unsigned long) count, (unsigned long) [ends count]];
+    }
+    if (count == 0) {
+        return;
+    }
+    
+    int64_t* millis = malloc(2 * count * sizeof(int64_t));
+    @try {
+        HLInstantArrayGetMillis(starts, millis);
+        HLInstantArrayGetMillis(ends, millis + count);
+    
+        // the chronologies are usually all the same, so compute in runs
+        NSUInteger runStart = 0;
+        HLChronology* runChrono = [HLDateTimeUtils instantChronology:[starts objectAtIndex:0]];
+        for(NSUInteger i = 1; i <= count; i++) {
+            HLChronology* chrono = (i < count ? [HLDateTimeUtils instantChronology:[starts objectAtIndex:i]] : nil);
+            if (i == count || chrono != runChrono) {
+                [self betweenStartMillis:millis + runStart
+                               endMillis:millis + count + runStart
+                                   count:i - runStart
+                               fieldType:field
+                              chronology:runChrono
+                                 results:results + runStart];
+                runStart = i;
+                runChrono = chrono;
+            }
         }
     }
-    if([HLDateTimeUtils isContiguous:start] == NO) {
+    @finally {
+        // the instants and the field computations may raise
+        free(millis);
+    }
+}
+
+//-----------------------------------------------------------------------
++ (NSInteger)betweenStart:(id<HLReadablePartial>)start
+                       end:(id<HLReadablePartial>)end 
+                      zero:(id<HLReadablePeriod>)zeroInstance {
+    NSString* problem = HLPartialsProblem(start, end);
+    if (problem != nil) {
         [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
-                    format:@"ReadablePartial objects must be contiguous"];
+                    format:@"%@", problem];
     }
-    HLChronology* chrono = [[HLDateTimeUtils chronology:[start chronology]] withUTC];
-    NSArray* values = [chrono valuesOfPeriod:zeroInstance
-                           startInstantValue:[chrono setPartial:start
-                                                    intoInstant:0]
-                             endInstantValue:[chrono setPartial:end
-                                                    intoInstant:0]];
-    return [values objectAtIndex:0];
+    return HLSafeToInteger(HLPartialsDifference(start, end, zeroInstance));
+}
+
++ (BOOL)tryBetweenStartPartial:(id<HLReadablePartial>)start
+                    endPartial:(id<HLReadablePartial>)end
+                          zero:(id<HLReadablePeriod>)zeroInstance
+                        result:(NSInteger*)result
+                         error:(NSError**)error {
+    NSString* problem = HLPartialsProblem(start, end);
+    if (problem != nil) {
+        HLSetError(error, HL_ERROR_ILLEGAL_ARGUMENT, @"%@", problem);
+        return NO;
+    }
+    int64_t difference = HLPartialsDifference(start, end, zeroInstance);
+    if (!HLTryToInteger(difference, result)) {
+        HLSetError(error, HL_ERROR_ARITHMETIC,
+                   @"Value cannot fit in (NSInteger): %lld", (long long) difference);
+        return NO;
+    }
+    return YES;
 }
 
 + (NSInteger)standardPeriodIn:(id<HLReadablePeriod>)period 
-                        millis:(NSInteger)millisPerUnit {
+                        millis:(int64_t)millisPerUnit {
     if (period == nil) {
         return 0;
     }
     
     HLChronology* iso = [HLISOChronology instanceUTC];
-    NSInteger duration = 0L;
+    int64_t duration = 0L;
     for(NSInteger i = 0; i < [period size]; i++) {
         int value = [period valueAtIndex:i];
         if (value != 0) {
@@ -97,12 +301,10 @@
                             format:@"Cannot convert period to duration as '%@' is not precise in the period '%@'",
                  [field name], period];
             }
-            duration = [HLFieldUtils safeAddValue:duration
-                                         andValue:[HLFieldUtils safeMultiplyValue:[field unitMillis]
-                                                                         andValue:value]];
+            duration = HLSafeAdd(duration, HLSafeMultiply([field unitMillis], value));
         }
     }
-    return [HLFieldUtils safeToInteger:(duration / millisPerUnit)];
+    return HLSafeToInteger(duration / millisPerUnit);
 }
 
 //-----------------------------------------------------------------------
@@ -109,20 +109,20 @@
 
 - (HLDateTimeZone*)dateTimeZone;
 
-- (NSInteger)dateTimeMillisWithYear:(NSInteger)year 
-                        monthOfYear:(NSInteger)monthOfYear
-                         dayOfMonth:(NSInteger)dayOfMonth
-                        millisOfDay:(NSInteger)millisOfDay;
-
-- (NSInteger)dateTimeMillisWithYear:(NSInteger)year 
-                        monthOfYear:(NSInteger)monthOfYear 
-                         dayOfMonth:(NSInteger)dayOfMonth
-                          hourOfDay:(NSInteger)hourOfDay 
-                       minuteOfHour:(NSInteger)minuteOfHour
-                     secondOfMinute:(NSInteger)secondOfMinute 
-                     millisOfSecond:(NSInteger)millisOfSecond;
-
-- (NSInteger)getDateTimeMillisWithInstantValue:(NSInteger)instant,
+- (int64_t)dateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear
+                       dayOfMonth:(NSInteger)dayOfMonth
+                      millisOfDay:(NSInteger)millisOfDay;
+
+- (int64_t)dateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear 
+                       dayOfMonth:(NSInteger)dayOfMonth
+                        hourOfDay:(NSInteger)hourOfDay 
+                     minuteOfHour:(NSInteger)minuteOfHour
+                   secondOfMinute:(NSInteger)secondOfMinute 
+                   millisOfSecond:(NSInteger)millisOfSecond;
+
+- (int64_t)getDateTimeMillisWithInstantValue:(int64_t)instant,
 hourOfDay:(NSInteger)hourOfDay 
 minuteOfHour:(NSInteger)minuteOfHour
 secondOfMinute:(NSInteger)secondOfMinute 
@@ -21,6 +21,8 @@
 
 #import <Foundation/Foundation.h>
 
+#import "HLChronology.h"
+
 
 @interface BaseChronology {
 
@@ -711,3 +713,63 @@ public abstract class BaseChronology
 
 
 @end
+
+
+/**
+ * The ported part of BaseChronology. Only the buffer based values methods
+ * and the non-raising datetime constructors are implemented so far; they
+ * are documented on HLChronology.
+ */
+@interface HLBaseChronology : HLChronology {
+
+}
+
+//-----------------------------------------------------------------------
+- (BOOL)tryDateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear 
+                       dayOfMonth:(NSInteger)dayOfMonth 
+                      millisOfDay:(NSInteger)millisOfDay
+                           result:(int64_t*)millis
+                            error:(NSError**)error;
+
+- (BOOL)tryDateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear 
+                       dayOfMonth:(NSInteger)dayOfMonth
+                        hourOfDay:(NSInteger)hourOfDay 
+                     minuteOfHour:(NSInteger)minuteOfHour
+                   secondOfMinute:(NSInteger)secondOfMinute 
+                   millisOfSecond:(NSInteger)millisOfSecond
+                           result:(int64_t*)millis
+                            error:(NSError**)error;
+
+//-----------------------------------------------------------------------
+- (void)valuesOfPartial:(id<HLReadablePartial>)partial
+            fromInstant:(int64_t)instant
+             intoBuffer:(int64_t*)values;
+
+- (void)valuesOfPartial:(id<HLReadablePartial>)partial
+           fromInstants:(const int64_t*)instants
+                  count:(NSUInteger)count
+             intoBuffer:(int64_t*)values;
+
+- (NSArray*)valuesOfPartial:(id<HLReadablePartial>)partial
+                fromInstant:(int64_t)instant;
+
+//-----------------------------------------------------------------------
+- (void)valuesOfPeriod:(id<HLReadablePeriod>)period
+     startInstantValue:(int64_t)startInstant
+       endInstantValue:(int64_t)endInstant
+            intoBuffer:(int64_t*)values;
+
+- (NSArray*)valuesOfPeriod:(id<HLReadablePeriod>)period
+         startInstantValue:(int64_t)startInstant
+           endInstantValue:(int64_t)endInstant;
+
+- (void)valuesOfPeriod:(id<HLReadablePeriod>)period
+          fromDuration:(int64_t)duration
+            intoBuffer:(int64_t*)values;
+
+- (NSArray*)valuesOfPeriod:(id<HLReadablePeriod>)period
+              fromDuration:(int64_t)duration;
+
+@end
@@ -19,7 +19,198 @@
  * limitations under the License.
  */
 
-#import "BaseChronology.h"
+#import "HLBaseChronology.h"
+
+#import "HLConstants.h"
+#import "HLDateTimeField.h"
+#import "HLDateTimeFieldType.h"
+#import "HLDateTimeZone.h"
+#import "HLDurationField.h"
+#import "HLDurationFieldType.h"
+#import "HLFieldKernel.h"
+#import "HLFieldUtils.h"
+#import "HLReadablePartial.h"
+#import "HLReadablePeriod.h"
+
+
+/*
+ * Boxes the first count values of a buffer for the NSArray based API.
+ */
+static NSArray* HLBoxedValues(const int64_t* values, NSInteger count) {
+    NSMutableArray* boxed = [NSMutableArray arrayWithCapacity:count];
+    for(NSInteger i = 0; i < count; i++) {
+        [boxed addObject:[NSNumber numberWithLongLong:values[i]]];
+    }
+    return boxed;
+}
+
+/*
+ * Converts local milliseconds built from UTC fields to an instant in the
+ * zone of the chronology, reporting a local time that falls in a zone
+ * offset transition gap through an error.
+ */
+static BOOL HLTryInstantFromLocal(HLChronology* chrono, int64_t local, int64_t* millis, NSError** error) {
+    HLDateTimeZone* zone = [chrono dateTimeZone];
+    if (zone == nil) {
+        *millis = local;
+        return YES;
+    }
+    NSInteger offset = [zone offsetFromLocal:local];
+    int64_t instant;
+    if (!HLTrySubtract(local, offset, &instant)) {
+        HLSetError(error, HL_ERROR_ARITHMETIC,
+                   @"The calculation caused an overflow: %lld - %ld", (long long) local, (long) offset);
+        return NO;
+    }
+    if (offset != [zone offsetWithInstantValue:instant]) {
+        HLSetError(error, HL_ERROR_ILLEGAL_ARGUMENT,
+                   @"Illegal instant due to time zone offset transition (%@)", zone);
+        return NO;
+    }
+    *millis = instant;
+    return YES;
+}
+
+@implementation HLBaseChronology
+
+//-----------------------------------------------------------------------
+- (BOOL)tryDateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear 
+                       dayOfMonth:(NSInteger)dayOfMonth 
+                      millisOfDay:(NSInteger)millisOfDay
+                           result:(int64_t*)millis
+                            error:(NSError**)error {
+    // each value is checked against the UTC field at the instant built so
+    // far, so month lengths and leap years are respected
+    HLChronology* utc = [self withUTC];
+    int64_t local = 0;
+    if (![[utc year] trySet:local value:year result:&local error:error] ||
+        ![[utc monthOfYear] trySet:local value:monthOfYear result:&local error:error] ||
+        ![[utc dayOfMonth] trySet:local value:dayOfMonth result:&local error:error] ||
+        ![[utc millisOfDay] trySet:local value:millisOfDay result:&local error:error]) {
+        return NO;
+    }
+    return HLTryInstantFromLocal(self, local, millis, error);
+}
+
+- (BOOL)tryDateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear 
+                       dayOfMonth:(NSInteger)dayOfMonth
+                        hourOfDay:(NSInteger)hourOfDay 
+                     minuteOfHour:(NSInteger)minuteOfHour
+                   secondOfMinute:(NSInteger)secondOfMinute 
+                   millisOfSecond:(NSInteger)millisOfSecond
+                           result:(int64_t*)millis
+                            error:(NSError**)error {
+    HLChronology* utc = [self withUTC];
+    int64_t local = 0;
+    if (![[utc year] trySet:local value:year result:&local error:error] ||
+        ![[utc monthOfYear] trySet:local value:monthOfYear result:&local error:error] ||
+        ![[utc dayOfMonth] trySet:local value:dayOfMonth result:&local error:error] ||
+        ![[utc hourOfDay] trySet:local value:hourOfDay result:&local error:error] ||
+        ![[utc minuteOfHour] trySet:local value:minuteOfHour result:&local error:error] ||
+        ![[utc secondOfMinute] trySet:local value:secondOfMinute result:&local error:error] ||
+        ![[utc millisOfSecond] trySet:local value:millisOfSecond result:&local error:error]) {
+        return NO;
+    }
+    return HLTryInstantFromLocal(self, local, millis, error);
+}
+
+//-----------------------------------------------------------------------
+- (void)valuesOfPartial:(id<HLReadablePartial>)partial
+            fromInstant:(int64_t)instant
+             intoBuffer:(int64_t*)values {
+    for(NSInteger i = 0, isize = [partial size]; i < isize; i++) {
+        values[i] = [[[partial fieldTypeAtIndex:i] field:self] valueWithMillis:instant];
+    }
+}
+
+- (void)valuesOfPartial:(id<HLReadablePartial>)partial
+           fromInstants:(const int64_t*)instants
+                  count:(NSUInteger)count
+             intoBuffer:(int64_t*)values {
+    NSInteger size = [partial size];
+    HLFieldKernel kernels[size > 0 ? size : 1];
+    for(NSInteger i = 0; i < size; i++) {
+        HLFieldKernelForType(self, [partial fieldTypeAtIndex:i], &kernels[i]);
+    }
+    for(NSUInteger row = 0; row < count; row++) {
+        int64_t* rowValues = values + row * size;
+        for(NSInteger i = 0; i < size; i++) {
+            rowValues[i] = HLFieldKernelGet(&kernels[i], instants[row]);
+        }
+    }
+}
+
+- (NSArray*)valuesOfPartial:(id<HLReadablePartial>)partial
+                fromInstant:(int64_t)instant {
+    NSInteger size = [partial size];
+    int64_t values[size > 0 ? size : 1];
+    [self valuesOfPartial:partial fromInstant:instant intoBuffer:values];
+    return HLBoxedValues(values, size);
+}
+
+//-----------------------------------------------------------------------
+- (void)valuesOfPeriod:(id<HLReadablePeriod>)period
+     startInstantValue:(int64_t)startInstant
+       endInstantValue:(int64_t)endInstant
+            intoBuffer:(int64_t*)values {
+    NSInteger size = [period size];
+    if (startInstant == endInstant) {
+        memset(values, 0, size * sizeof(int64_t));
+        return;
+    }
+    for(NSInteger i = 0; i < size; i++) {
+        HLDurationField* field = [[period fieldTypeAtIndex:i] fieldWithChronology:self];
+        NSInteger value = [field differenceBetweenMinuend:endInstant
+                                               subtrahend:startInstant];
+        startInstant = [field addInstant:startInstant value:value];
+        values[i] = value;
+    }
+}
+
+- (NSArray*)valuesOfPeriod:(id<HLReadablePeriod>)period
+         startInstantValue:(int64_t)startInstant
+           endInstantValue:(int64_t)endInstant {
+    NSInteger size = [period size];
+    int64_t values[size > 0 ? size : 1];
+    [self valuesOfPeriod:period
+       startInstantValue:startInstant
+         endInstantValue:endInstant
+              intoBuffer:values];
+    return HLBoxedValues(values, size);
+}
+
+- (void)valuesOfPeriod:(id<HLReadablePeriod>)period
+          fromDuration:(int64_t)duration
+            intoBuffer:(int64_t*)values {
+    NSInteger size = [period size];
+    memset(values, 0, size * sizeof(int64_t));
+    if (duration == 0) {
+        return;
+    }
+    // imprecise fields are left at zero
+    int64_t current = 0;
+    for(NSInteger i = 0; i < size; i++) {
+        HLDurationField* field = [[period fieldTypeAtIndex:i] fieldWithChronology:self];
+        if ([field isPrecise]) {
+            NSInteger value = [field differenceBetweenMinuend:duration
+                                                   subtrahend:current];
+            current = [field addInstant:current value:value];
+            values[i] = value;
+        }
+    }
+}
+
+- (NSArray*)valuesOfPeriod:(id<HLReadablePeriod>)period
+              fromDuration:(int64_t)duration {
+    NSInteger size = [period size];
+    int64_t values[size > 0 ? size : 1];
+    [self valuesOfPeriod:period fromDuration:duration intoBuffer:values];
+    return HLBoxedValues(values, size);
+}
+
+@end
 
 
 @implementation BaseChronology
@@ -52,8 +52,8 @@
  * @param chrono  the chronology to use, which is always non-nil
  * @return the millisecond value
  */
-- (NSInteger)instantMillis:(id)object
-                chronology:(HLChronology*)chrono;
+- (int64_t)instantMillis:(id)object
+              chronology:(HLChronology*)chrono;
 
 //-----------------------------------------------------------------------
 /**
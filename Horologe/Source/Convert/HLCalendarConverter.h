@@ -81,8 +81,8 @@
  * @throws NullPointerException if the object is nil
  * @throws ClassCastException if the object is an invalid type
  */
-- (NSInteger)instantMillisWithObject:(id)object
-                          chronology:(HLChronology*)chrono;
+- (int64_t)instantMillisWithObject:(id)object
+                        chronology:(HLChronology*)chrono;
 
 //-----------------------------------------------------------------------
 /**
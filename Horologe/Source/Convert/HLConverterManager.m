@@ -21,9 +21,191 @@
 
 #import "HLConverterManager.h"
 
+#import <libkern/OSAtomic.h>
+#import <objc/runtime.h>
+
+#import "HLConstants.h"
+#import "HLConverterSet.h"
+
+
+/** Slots per cache table, a power of two */
+#define HL_CONVERTER_CACHE_SLOTS 64
+/** Slots probed before a lookup gives up */
+#define HL_CONVERTER_CACHE_PROBES 8
+
+typedef struct {
+    Class type;
+    id converter;
+} HLConverterCacheEntry;
+
+/**
+ * An open addressed table from Class pointer to converter, built for exactly
+ * one converter set. Slots are filled once with a compare and swap and never
+ * cleared, so readers probe without taking a lock.
+ */
+typedef struct {
+    HLConverterSet* set;
+    HLConverterCacheEntry* volatile slots[HL_CONVERTER_CACHE_SLOTS];
+} HLConverterCacheTable;
+
+/**
+ * The current table for one kind of converter. Altering the converters
+ * replaces the set, which orphans the table; the next lookup publishes a
+ * fresh one. Orphaned tables are not freed as a reader may still be probing
+ * them, which is acceptable since altering the converters is rare.
+ */
+typedef struct {
+    HLConverterCacheTable* volatile table;
+} HLConverterCache;
+
+static HLConverterCache sInstantCache;
+static HLConverterCache sPartialCache;
+static HLConverterCache sDurationCache;
+static HLConverterCache sPeriodCache;
+static HLConverterCache sIntervalCache;
+
+static inline NSUInteger HLConverterCacheIndex(Class type) {
+    uintptr_t bits = (uintptr_t) type;
+    return (NSUInteger) ((bits >> 4) ^ (bits >> 12)) & (HL_CONVERTER_CACHE_SLOTS - 1);
+}
+
+static void HLConverterCachePut(HLConverterCache* cache, HLConverterSet* set, Class type, id converter) {
+    HLConverterCacheTable* table = cache->table;
+    if (table == NULL || table->set != set) {
+        HLConverterCacheTable* created = calloc(1, sizeof(HLConverterCacheTable));
+        if (created == NULL) {
+            return;
+        }
+        created->set = [set retain];
+        if (!OSAtomicCompareAndSwapPtrBarrier(table, created, (void* volatile*) &cache->table)) {
+            [set release];
+            free(created);
+        }
+        table = cache->table;
+        if (table == NULL || table->set != set) {
+            // lost to a lookup against a different set, leave the cache alone
+            return;
+        }
+    }
+
+    HLConverterCacheEntry* entry = malloc(sizeof(HLConverterCacheEntry));
+    if (entry == NULL) {
+        return;
+    }
+    entry->type = type;
+    entry->converter = [converter retain];
+
+    NSUInteger index = HLConverterCacheIndex(type);
+    for(NSUInteger probe = 0; probe < HL_CONVERTER_CACHE_PROBES; probe++) {
+        HLConverterCacheEntry* volatile* slot = &table->slots[(index + probe) & (HL_CONVERTER_CACHE_SLOTS - 1)];
+        if (*slot == NULL && OSAtomicCompareAndSwapPtrBarrier(NULL, entry, (void* volatile*) slot)) {
+            return;
+        }
+        if ((*slot)->type == type) {
+            break;
+        }
+    }
+    // already cached by another thread, or no room near the home slot
+    [entry->converter release];
+    free(entry);
+}
+
+/**
+ * Selects the converter for the object's class, consulting the cache before
+ * the converter set. A nil object selects with a Nil class, which caches
+ * like any other.
+ */
+static id HLConverterCacheSelect(HLConverterCache* cache, HLConverterSet* set, id object) {
+    Class type = object == nil ? Nil : object_getClass(object);
+    HLConverterCacheTable* table = cache->table;
+    if (table != NULL && table->set == set) {
+        NSUInteger index = HLConverterCacheIndex(type);
+        for(NSUInteger probe = 0; probe < HL_CONVERTER_CACHE_PROBES; probe++) {
+            HLConverterCacheEntry* entry = table->slots[(index + probe) & (HL_CONVERTER_CACHE_SLOTS - 1)];
+            if (entry == NULL) {
+                break;
+            }
+            if (entry->type == type) {
+                return entry->converter;
+            }
+        }
+    }
+
+    id converter = [set select:type];
+    if (converter != nil) {
+        HLConverterCachePut(cache, set, type, converter);
+    }
+    return converter;
+}
+
 
 @implementation HLConverterManager
 
+//-----------------------------------------------------------------------
+- (HLInstantConverter*)instantConverter:(id)object {
+    HLInstantConverter* converter = HLConverterCacheSelect(&sInstantCache, _iInstantConverters, object);
+    if (converter != nil) {
+        return converter;
+    }
+    [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                format:@"No instant converter found for type: %@",
+     object == nil ? @"nil" : NSStringFromClass([object class])];
+    return nil;
+}
+
+//-----------------------------------------------------------------------
+- (HLPartialConverter*)partialConverter:(id)object {
+    HLPartialConverter* converter = HLConverterCacheSelect(&sPartialCache, _iPartialConverters, object);
+    if (converter != nil) {
+        return converter;
+    }
+    [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                format:@"No partial converter found for type: %@",
+     object == nil ? @"nil" : NSStringFromClass([object class])];
+    return nil;
+}
+
+//-----------------------------------------------------------------------
+- (HLDurationConverter*)durationConverter:(id)object {
+    HLDurationConverter* converter = HLConverterCacheSelect(&sDurationCache, _iDurationConverters, object);
+    if (converter != nil) {
+        return converter;
+    }
+    [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                format:@"No duration converter found for type: %@",
+     object == nil ? @"nil" : NSStringFromClass([object class])];
+    return nil;
+}
+
+//-----------------------------------------------------------------------
+- (HLPeriodConverter*)periodConverter:(id)object {
+    HLPeriodConverter* converter = HLConverterCacheSelect(&sPeriodCache, _iPeriodConverters, object);
+    if (converter != nil) {
+        return converter;
+    }
+    [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                format:@"No period converter found for type: %@",
+     object == nil ? @"nil" : NSStringFromClass([object class])];
+    return nil;
+}
+
+//-----------------------------------------------------------------------
+- (HLIntervalConverter*)intervalConverter:(id)object {
+    HLIntervalConverter* converter = HLConverterCacheSelect(&sIntervalCache, _iIntervalConverters, object);
+    if (converter != nil) {
+        return converter;
+    }
+    [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                format:@"No interval converter found for type: %@",
+     object == nil ? @"nil" : NSStringFromClass([object class])];
+    return nil;
+}
+
+@end
+
+
+@implementation ConverterManager
+
 /*
  *  Copyright 2001-2005 Stephen Colebourne
  *
@@ -40,6 +40,6 @@
  * @return the millisecond duration
  * @throws ClassCastException if the object is invalid
  */
-- (NSInteger)durationMillis:(id)object;
+- (int64_t)durationMillis:(id)object;
 
 @end
@@ -78,7 +78,7 @@
  * @throws ClassCastException if the object is invalid
  * @throws IllegalArgumentException if object conversion fails
  */
-- (NSInteger)instantMillisFromInstant:(id)object
-                           chronology:(HLChronology*)chrono;
+- (int64_t)instantMillisFromInstant:(id)object
+                         chronology:(HLChronology*)chrono;
 
 @end
@@ -21,6 +21,46 @@
 
 #import <Foundation/Foundation.h>
 
+#import "HLAbstractConverter.h"
+
+
+@class HLChronology;
+
+/**
+ * StringConverter converts from a String to an instant, partial,
+ * duration, period or interval..
+ * <p>
+ * Only the instant conversion is ported so far; the rest remains in the
+ * Java text below.
+ *
+ * @author Stephen Colebourne
+ * @author Brian S O'Neill
+ * @since 1.0
+ */
+@interface HLStringConverter : HLAbstractConverter {
+    
+@private
+    
+}
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the millis, which is the ISO parsed string value.
+ * <p>
+ * Strings of the common shape yyyy-MM-dd'T'HH:mm:ss.SSSZZ, with the
+ * time, seconds, fraction and offset optional, are recognized directly
+ * for ISO chronologies. Anything else goes to the full ISO parser.
+ * 
+ * @param object  the String to convert, must not be nil
+ * @param chrono  the chronology to use, non-nil result of getChronology
+ * @return the millisecond value
+ * @throws IllegalArgumentException if the value if invalid
+ */
+- (int64_t)instantMillisFromInstant:(id)object
+                         chronology:(HLChronology*)chrono;
+
+@end
+
 
 @interface StringConverter {
 
@@ -19,7 +19,175 @@
  * limitations under the License.
  */
 
-#import "StringConverter.h"
+#import "HLStringConverter.h"
+
+#import "HLChronology.h"
+#import "HLDateTimeZone.h"
+#import "HLInstantValue.h"
+#import "HLISOChronology.h"
+#import "HLISODateTimeFormat.h"
+
+
+/** Longest string the fixed shape recognizer will look at */
+#define HL_ISO_FIXED_MAX_LENGTH (40)
+
+/**
+ * The result of recognizing the common ISO shape
+ * yyyy-MM-dd['T'HH:mm[:ss[.SSS]][Z|+HH[[:]mm]]].
+ */
+typedef struct {
+    /** The millis of the local date and time in UTC */
+    int64_t localMillis;
+    /** The parsed offset in millis, valid if hasOffset */
+    int32_t offsetMillis;
+    BOOL hasOffset;
+} HLISOFixedFields;
+
+static inline BOOL HLISOFixedDigits(const UniChar* chars, NSUInteger count, int32_t* value) {
+    int32_t result = 0;
+    for(NSUInteger i = 0; i < count; i++) {
+        UniChar c = chars[i];
+        if (c < '0' || c > '9') {
+            return NO;
+        }
+        result = result * 10 + (c - '0');
+    }
+    *value = result;
+    return YES;
+}
+
+static inline int32_t HLISOFixedDaysInMonth(int32_t year, int32_t month) {
+    static const int8_t days[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    if (month == 2 && (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0)) {
+        return 29;
+    }
+    return days[month - 1];
+}
+
+/*
+ * Recognizes the shape of timestamp that nearly all machine generated
+ * strings use, returning NO for anything else so that the full parser can
+ * accept or reject it with the proper message. Fraction digits beyond
+ * the millis are dropped, as the full parser does.
+ */
+static BOOL HLISOFixedRecognize(const UniChar* chars, NSUInteger length, HLISOFixedFields* fields) {
+    int32_t year, month, day, hour = 0, minute = 0, second = 0, millis = 0;
+    if (length < 10 || chars[4] != '-' || chars[7] != '-' ||
+        !HLISOFixedDigits(chars, 4, &year) ||
+        !HLISOFixedDigits(chars + 5, 2, &month) ||
+        !HLISOFixedDigits(chars + 8, 2, &day) ||
+        month < 1 || month > 12 || day < 1 || day > HLISOFixedDaysInMonth(year, month)) {
+        return NO;
+    }
+    
+    NSUInteger pos = 10;
+    fields->hasOffset = NO;
+    fields->offsetMillis = 0;
+    if (pos < length) {
+        if (length < pos + 6 || chars[pos] != 'T' || chars[pos + 3] != ':' ||
+            !HLISOFixedDigits(chars + pos + 1, 2, &hour) ||
+            !HLISOFixedDigits(chars + pos + 4, 2, &minute) ||
+            hour > 23 || minute > 59) {
+            return NO;
+        }
+        pos += 6;
+        if (pos < length && chars[pos] == ':') {
+            if (length < pos + 3 || !HLISOFixedDigits(chars + pos + 1, 2, &second) || second > 59) {
+                return NO;
+            }
+            pos += 3;
+            if (pos < length && (chars[pos] == '.' || chars[pos] == ',')) {
+                NSUInteger start = ++pos;
+                while (pos < length && chars[pos] >= '0' && chars[pos] <= '9' && pos - start < 9) {
+                    if (pos - start < 3) {
+                        millis = millis * 10 + (chars[pos] - '0');
+                    }
+                    pos++;
+                }
+                if (pos == start) {
+                    return NO;
+                }
+                for(NSUInteger scale = pos - start; scale < 3; scale++) {
+                    millis *= 10;
+                }
+            }
+        }
+        if (pos < length) {
+            UniChar sign = chars[pos];
+            if (sign == 'Z' && pos + 1 == length) {
+                fields->hasOffset = YES;
+            } else if (sign == '+' || sign == '-') {
+                int32_t offsetHours, offsetMinutes = 0;
+                NSUInteger rest = length - pos - 1;
+                if (rest == 2) {
+                    if (!HLISOFixedDigits(chars + pos + 1, 2, &offsetHours)) {
+                        return NO;
+                    }
+                } else if (rest == 4) {
+                    if (!HLISOFixedDigits(chars + pos + 1, 2, &offsetHours) ||
+                        !HLISOFixedDigits(chars + pos + 3, 2, &offsetMinutes)) {
+                        return NO;
+                    }
+                } else if (rest == 5 && chars[pos + 3] == ':') {
+                    if (!HLISOFixedDigits(chars + pos + 1, 2, &offsetHours) ||
+                        !HLISOFixedDigits(chars + pos + 4, 2, &offsetMinutes)) {
+                        return NO;
+                    }
+                } else {
+                    return NO;
+                }
+                if (offsetHours > 23 || offsetMinutes > 59) {
+                    return NO;
+                }
+                int32_t offset = (offsetHours * 60 + offsetMinutes) * 60000;
+                fields->offsetMillis = sign == '-' ? -offset : offset;
+                fields->hasOffset = YES;
+            } else {
+                return NO;
+            }
+        }
+    }
+    
+    int64_t epochDay = HLLocalDateValueMake(year, month, day).epochDay;
+    fields->localMillis = epochDay * HLInstantValueMillisPerDay +
+        ((hour * 60 + minute) * 60 + second) * 1000LL + millis;
+    return YES;
+}
+
+
+@implementation HLStringConverter
+
+//-----------------------------------------------------------------------
+- (int64_t)instantMillisFromInstant:(id)object
+                         chronology:(HLChronology*)chrono {
+    NSString* str = (NSString*) object;
+    NSUInteger length = [str length];
+    // the fixed shape is only ISO, other calendars need the full parser
+    if (length <= HL_ISO_FIXED_MAX_LENGTH && [chrono withUTC] == [HLISOChronology instanceUTC]) {
+        UniChar buffer[HL_ISO_FIXED_MAX_LENGTH];
+        const UniChar* chars = CFStringGetCharactersPtr((CFStringRef) str);
+        if (chars == NULL) {
+            [str getCharacters:buffer range:NSMakeRange(0, length)];
+            chars = buffer;
+        }
+        HLISOFixedFields fields;
+        if (HLISOFixedRecognize(chars, length, &fields)) {
+            if (fields.hasOffset) {
+                return fields.localMillis - fields.offsetMillis;
+            }
+            HLDateTimeZone* zone = [chrono dateTimeZone];
+            NSInteger offset = [zone offsetFromLocal:fields.localMillis];
+            int64_t millis = fields.localMillis - offset;
+            if (offset == [zone offsetWithInstantValue:millis]) {
+                return millis;
+            }
+            // in a zone transition gap, let the parser report it
+        }
+    }
+    return [[[HLISODateTimeFormat dateTimeParser] withChronology:chrono] parseMillis:str];
+}
+
+@end
 
 
 @implementation StringConverter
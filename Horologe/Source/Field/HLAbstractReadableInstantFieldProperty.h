@@ -77,7 +77,7 @@
  * 
  * @return the milliseconds
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 /**
  * Gets the chronology of the datetime that this property is linked to.
@@ -282,7 +282,7 @@
  * @see DateTimeField#remainder
  * @return remainder duration, in milliseconds
  */
-- (NSInteger)remainder;
+- (int64_t)remainder;
 
 /**
  * Returns the interval that represents the range of the minimum
@@ -69,7 +69,7 @@
  * @return the value of the field, in the units of the field, which may be
  * negative
  */
-- (NSInteger)valueWithDuration:(NSInteger)duration;
+- (NSInteger)valueWithDuration:(int64_t)duration;
 
 /**
  * Get the value of this field from the milliseconds relative to an
@@ -87,8 +87,8 @@
  * @return the value of the field, in the units of the field, which may be
  * negative
  */
-- (NSInteger)valueWithDurationValue:(NSInteger)duration 
-                       instantValue:(NSInteger)instant;
+- (NSInteger)valueWithDurationValue:(int64_t)duration 
+                       instantValue:(int64_t)instant;
 
 /**
  * Get the millisecond duration of this field from its value, which is
@@ -98,12 +98,12 @@
  * @return the milliseconds that the field represents, which may be
  * negative
  */
-- (NSInteger)millisWithValue:(NSInteger)value;
+- (int64_t)millisWithValue:(NSInteger)value;
 
 // Calculation API
 //------------------------------------------------------------------------
-- (NSInteger)differenceWithMinuend:(NSInteger)minuendInstant 
-                        subtrahend:(NSInteger)subtrahendInstant;
+- (NSInteger)differenceWithMinuend:(int64_t)minuendInstant 
+                        subtrahend:(int64_t)subtrahendInstant;
 
 //------------------------------------------------------------------------
 - (NSComparisonResult)compareToField:(id)durationField;
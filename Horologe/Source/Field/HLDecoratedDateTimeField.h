@@ -70,10 +70,10 @@
 
 - (BOOL)isLenient;
 
-- (NSInteger)getInstantValue:(NSInteger)instant;
+- (int64_t)getInstantValue:(int64_t)instant;
 
-- (NSInteger)setInstantValue:(NSInteger)instant 
-                       value:(NSInteger)value;
+- (int64_t)setInstantValue:(int64_t)instant 
+                     value:(NSInteger)value;
 
 - (HLDurationField*)durationField;
 
@@ -83,6 +83,6 @@
 
 - (NSInteger)maximumValue;
 
-- (NSInteger)roundFloor:(NSInteger)instant;
+- (int64_t)roundFloor:(int64_t)instant;
 
 @end
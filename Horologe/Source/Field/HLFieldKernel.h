@@ -0,0 +1,124 @@
+/*
+ * FieldKernel.h
+ * 
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#import <Foundation/Foundation.h>
+
+
+@class HLChronology;
+@class HLDateTimeField;
+@class HLDateTimeFieldType;
+
+/*
+ * Field kernels
+ *
+ * A field kernel is a datetime field resolved down to the C functions that
+ * implement its get, set, add and roundFloor operations, with the receiver
+ * they must be called on. Calling through a kernel costs an indirect call
+ * instead of a message send. Decorators that only shift values, such as
+ * OffsetDateTimeField once it is ported, can override resolveKernel: to
+ * resolve their wrapped field and record the offset and bounds, so the
+ * wrapped field is called directly.
+ *
+ * Kernels are meant for loops over many instants or many fields, such as
+ * extracting or setting the values of a partial. They hold no references:
+ * a kernel is valid for as long as the field it was resolved from.
+ */
+
+typedef NSInteger (*HLFieldGetFunction)(id field, SEL cmd, int64_t instant);
+typedef int64_t (*HLFieldSetFunction)(id field, SEL cmd, int64_t instant, NSInteger value);
+typedef int64_t (*HLFieldAddFunction)(id field, SEL cmd, NSInteger value, int64_t instant);
+typedef int64_t (*HLFieldRoundFunction)(id field, SEL cmd, int64_t instant);
+
+typedef struct {
+    /** The field the kernel was resolved from, used in error messages */
+    HLDateTimeField* field;
+    /** The field the functions are called on */
+    HLDateTimeField* target;
+    HLFieldGetFunction get;
+    HLFieldSetFunction set;
+    HLFieldAddFunction add;
+    HLFieldRoundFunction roundFloor;
+    /** Added to values of the target, non-zero for a folded offset field */
+    NSInteger offset;
+    /** The value bounds of a folded offset field */
+    NSInteger minimum;
+    NSInteger maximum;
+} HLFieldKernel;
+
+/**
+ * Resolves a field into a kernel, asking the field to describe itself
+ * through resolveKernel:.
+ *
+ * @param field  the field to resolve, not nil
+ * @param kernel  the kernel to fill in, not NULL
+ */
+extern void HLFieldKernelResolve(HLDateTimeField* field, 
+                                 HLFieldKernel* kernel);
+
+/**
+ * Gets the kernel of the field of a type in a chronology. The kernels of
+ * the standard field types are resolved once per chronology and cached;
+ * other field types are resolved on each call.
+ *
+ * @param chronology  the chronology to get the field from, nil means ISO
+ * @param type  the field type, not nil
+ * @param kernel  receives the kernel, not NULL
+ */
+extern void HLFieldKernelForType(HLChronology* chronology, 
+                                 HLDateTimeFieldType* type, 
+                                 HLFieldKernel* kernel);
+
+/**
+ * Raises the illegal field value exception for a value outside the bounds
+ * of a folded offset field. Kept out of line so the inline callers stay small.
+ */
+extern void HLFieldKernelRaiseBounds(const HLFieldKernel* kernel, 
+                                     NSInteger value);
+
+static inline NSInteger HLFieldKernelGet(const HLFieldKernel* kernel, int64_t instant) {
+    return kernel->get(kernel->target, @selector(valueWithMillis:), instant) + kernel->offset;
+}
+
+static inline int64_t HLFieldKernelSet(const HLFieldKernel* kernel, int64_t instant, NSInteger value) {
+    if (kernel->offset != 0) {
+        if (__builtin_expect(value < kernel->minimum || value > kernel->maximum, 0)) {
+            HLFieldKernelRaiseBounds(kernel, value);
+        }
+        value -= kernel->offset;
+    }
+    return kernel->set(kernel->target, @selector(set:value:), instant, value);
+}
+
+static inline int64_t HLFieldKernelAdd(const HLFieldKernel* kernel, int64_t instant, NSInteger value) {
+    instant = kernel->add(kernel->target, @selector(addValue:toInstantValue:), value, instant);
+    if (kernel->offset != 0) {
+        NSInteger result = HLFieldKernelGet(kernel, instant);
+        if (__builtin_expect(result < kernel->minimum || result > kernel->maximum, 0)) {
+            HLFieldKernelRaiseBounds(kernel, result);
+        }
+    }
+    return instant;
+}
+
+static inline int64_t HLFieldKernelRoundFloor(const HLFieldKernel* kernel, int64_t instant) {
+    return kernel->roundFloor(kernel->target, @selector(roundFloor:), instant);
+}
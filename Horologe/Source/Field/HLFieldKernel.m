@@ -0,0 +1,101 @@
+/*
+ * FieldKernel.m
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#import "HLFieldKernel.h"
+
+#import <libkern/OSAtomic.h>
+
+#import "HLConstants.h"
+#import "HLChronology.h"
+#import "HLDateTimeField.h"
+#import "HLDateTimeFieldType.h"
+#import "HLDateTimeUtils.h"
+#import "HLFieldUtils.h"
+#import "HLInstantValue.h"
+
+
+/** The number of standard field types, including the unused ordinal zero */
+#define HL_FIELD_KERNEL_SLOTS (MILLIS_OF_SECOND + 1)
+
+typedef struct {
+    volatile int32_t resolved;
+    HLFieldKernel kernel;
+} HLFieldKernelSlot;
+
+/** The cached kernels of each identified chronology, indexed by ordinal */
+static HLFieldKernelSlot* sKernelSlots[HL_CHRONOLOGY_ID_CAPACITY];
+/** Guards allocation and resolution of the cached kernels */
+static OSSpinLock sKernelLock = OS_SPINLOCK_INIT;
+
+void HLFieldKernelResolve(HLDateTimeField* field, 
+                          HLFieldKernel* kernel) {
+    memset(kernel, 0, sizeof(HLFieldKernel));
+    [field resolveKernel:kernel];
+}
+
+void HLFieldKernelForType(HLChronology* chronology, 
+                          HLDateTimeFieldType* type, 
+                          HLFieldKernel* kernel) {
+    chronology = [HLDateTimeUtils chronology:chronology];
+    if (![type isKindOfClass:[HLStandardDateTimeFieldType class]]) {
+        HLFieldKernelResolve([type field:chronology], kernel);
+        return;
+    }
+    NSInteger ordinal = [(HLStandardDateTimeFieldType*) type ordinal];
+    uint16_t chronoId = HLChronologyIdentifier(chronology);
+    
+    HLFieldKernelSlot* slots = sKernelSlots[chronoId];
+    if (slots != NULL && slots[ordinal].resolved) {
+        OSMemoryBarrier();
+        *kernel = slots[ordinal].kernel;
+        return;
+    }
+    
+    // resolve outside the lock, as fields may be created lazily
+    HLFieldKernel resolved;
+    HLFieldKernelResolve([type field:chronology], &resolved);
+    
+    OSSpinLockLock(&sKernelLock);
+    slots = sKernelSlots[chronoId];
+    if (slots == NULL) {
+        slots = calloc(HL_FIELD_KERNEL_SLOTS, sizeof(HLFieldKernelSlot));
+        OSMemoryBarrier();
+        sKernelSlots[chronoId] = slots;
+    }
+    if (!slots[ordinal].resolved) {
+        slots[ordinal].kernel = resolved;
+        // publish the kernel before the flag so readers never see a partial one
+        OSMemoryBarrier();
+        slots[ordinal].resolved = 1;
+    }
+    OSSpinLockUnlock(&sKernelLock);
+    
+    *kernel = resolved;
+}
+
+void HLFieldKernelRaiseBounds(const HLFieldKernel* kernel, 
+                              NSInteger value) {
+    [HLFieldUtils verifyValueBoundsOfField:kernel->field
+                                     value:value
+                                lowerBound:kernel->minimum
+                                upperBound:kernel->maximum];
+}
@@ -25,6 +25,172 @@
 @class HLDateTimeField;
 @class HLDateTimeFieldType;
 
+/*
+ * Checked arithmetic
+ *
+ * These inline functions are the arithmetic core behind the safe* class
+ * methods below. Field, period and chronology code should call them
+ * directly; they compile down to the compiler's overflow checking
+ * builtins where it has them, and to sign checks on wrapped unsigned
+ * arithmetic where it does not (llvm-gcc 4.2 and older clang), with no
+ * message send on the common path. On overflow they raise
+ * HL_ARITHMETIC_EXCEPTION exactly as the class methods do.
+ */
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_add_overflow) && __has_builtin(__builtin_sub_overflow) && __has_builtin(__builtin_mul_overflow)
+#define HL_HAS_OVERFLOW_BUILTINS 1
+#endif
+#endif
+
+/**
+ * Raises the arithmetic exception for an overflowing operation. Kept out
+ * of line so the inline callers stay small.
+ *
+ * @param op  the operator symbol, or a cast such as "(NSInteger)", for the
+ *            exception message
+ * @param val1  the first operand
+ * @param val2  the second operand
+ */
+extern void HLRaiseArithmeticOverflow(const char* op, 
+                                      int64_t val1, 
+                                      int64_t val2);
+
+/*
+ * Non-raising arithmetic
+ *
+ * These return NO on overflow instead of raising, leaving the result
+ * untouched, for callers such as the try* APIs that report bad input
+ * through a status rather than an exception.
+ */
+
+static inline BOOL HLTryAdd(int64_t val1, int64_t val2, int64_t* result) {
+    int64_t sum;
+#ifdef HL_HAS_OVERFLOW_BUILTINS
+    if (__builtin_add_overflow(val1, val2, &sum)) {
+        return NO;
+    }
+#else
+    sum = (int64_t) ((uint64_t) val1 + (uint64_t) val2);
+    // overflow gives a sum whose sign differs from both operands
+    if (((val1 ^ sum) & (val2 ^ sum)) < 0) {
+        return NO;
+    }
+#endif
+    *result = sum;
+    return YES;
+}
+
+static inline BOOL HLTrySubtract(int64_t val1, int64_t val2, int64_t* result) {
+    int64_t diff;
+#ifdef HL_HAS_OVERFLOW_BUILTINS
+    if (__builtin_sub_overflow(val1, val2, &diff)) {
+        return NO;
+    }
+#else
+    diff = (int64_t) ((uint64_t) val1 - (uint64_t) val2);
+    // overflow needs operands of differing sign and a result unlike the first
+    if (((val1 ^ val2) & (val1 ^ diff)) < 0) {
+        return NO;
+    }
+#endif
+    *result = diff;
+    return YES;
+}
+
+static inline BOOL HLTryMultiply(int64_t val1, int64_t val2, int64_t* result) {
+    int64_t total;
+#ifdef HL_HAS_OVERFLOW_BUILTINS
+    if (__builtin_mul_overflow(val1, val2, &total)) {
+        return NO;
+    }
+#else
+    switch (val2) {
+        case -1:
+            if (val1 == INT64_MIN) {
+                return NO;
+            }
+            total = -val1;
+            break;
+        case 0:
+        case 1:
+            total = val1 * val2;
+            break;
+        default:
+            total = (int64_t) ((uint64_t) val1 * (uint64_t) val2);
+            if (total / val2 != val1) {
+                return NO;
+            }
+            break;
+    }
+#endif
+    *result = total;
+    return YES;
+}
+
+static inline BOOL HLTryToInteger(int64_t value, NSInteger* result) {
+    if (value < NSIntegerMin || value > NSIntegerMax) {
+        return NO;
+    }
+    *result = (NSInteger) value;
+    return YES;
+}
+
+/*
+ * Raising arithmetic
+ */
+
+static inline int64_t HLSafeNegate(int64_t value) {
+    if (__builtin_expect(value == INT64_MIN, 0)) {
+        HLRaiseArithmeticOverflow("-", 0, value);
+    }
+    return -value;
+}
+
+static inline int64_t HLSafeAdd(int64_t val1, int64_t val2) {
+    int64_t sum;
+    if (__builtin_expect(!HLTryAdd(val1, val2, &sum), 0)) {
+        HLRaiseArithmeticOverflow("+", val1, val2);
+    }
+    return sum;
+}
+
+static inline int64_t HLSafeSubtract(int64_t val1, int64_t val2) {
+    int64_t diff;
+    if (__builtin_expect(!HLTrySubtract(val1, val2, &diff), 0)) {
+        HLRaiseArithmeticOverflow("-", val1, val2);
+    }
+    return diff;
+}
+
+static inline int64_t HLSafeMultiply(int64_t val1, int64_t val2) {
+    int64_t total;
+    if (__builtin_expect(!HLTryMultiply(val1, val2, &total), 0)) {
+        HLRaiseArithmeticOverflow("*", val1, val2);
+    }
+    return total;
+}
+
+static inline NSInteger HLSafeToInteger(int64_t value) {
+    if (__builtin_expect(value < NSIntegerMin || value > NSIntegerMax, 0)) {
+        HLRaiseArithmeticOverflow("(NSInteger)", value, 0);
+    }
+    return (NSInteger) value;
+}
+
+/**
+ * Stores an error in the HL_ERROR_DOMAIN into the given location, if the
+ * location is not NULL. The error is autoreleased, and carries the
+ * formatted message as its localized description.
+ *
+ * @param error  the location to store the error in, may be NULL
+ * @param code  the error code, one of the HL_ERROR_* constants
+ * @param format  the format of the message
+ */
+extern void HLSetError(NSError** error, 
+                       NSInteger code, 
+                       NSString* format, ...) NS_FORMAT_FUNCTION(3,4);
+
 /**
  * General utilities that don't fit elsewhere.
  * <p>
@@ -45,7 +211,7 @@
  * 
  * @param value  the value to negate
  * @return the negated value
- * @throws ArithmeticException if the value is Integer.MIN_VALUE
+ * @throws ArithmeticException if the value is NSIntegerMin
  * @since 1.1
  */
 + (NSInteger)safeNegate:(NSInteger)value;
@@ -76,45 +242,89 @@
  * Multiply two values throwing an exception if overflow occurs.
  * 
  * @param val1  the first value
- * @param val2  the second value
+ * @param scalar  the second value
  * @return the new total
  * @throws ArithmeticException if the value is too big or too small
  * @since 1.2
  */
 + (NSInteger)safeMultiplyValue:(NSInteger)val1 
-                      andValue:(NSInteger)val2;
+                     andScalar:(NSInteger)scalar;
 
 /**
  * Multiply two values throwing an exception if overflow occurs.
  * 
  * @param val1  the first value
- * @param scalar  the second value
+ * @param val2  the second value
  * @return the new total
  * @throws ArithmeticException if the value is too big or too small
- * @since 1.2
  */
 + (NSInteger)safeMultiplyValue:(NSInteger)val1 
-                     andScalar:(NSInteger)scalar;
+                      andValue:(NSInteger)val2;
 
+//------------------------------------------------------------------------
 /**
- * Multiply two values throwing an exception if overflow occurs.
+ * Negates a millisecond value throwing an exception if it can't negate it.
+ * 
+ * @param value  the value to negate
+ * @return the negated value
+ * @throws ArithmeticException if the value is INT64_MIN
+ */
++ (int64_t)safeNegateInt64:(int64_t)value;
+
+/**
+ * Add two millisecond values throwing an exception if overflow occurs.
  * 
  * @param val1  the first value
  * @param val2  the second value
  * @return the new total
  * @throws ArithmeticException if the value is too big or too small
  */
-+ (NSInteger)safeMultiplyValue:(NSInteger)val1 
-                      andValue:(NSInteger)val2;
++ (int64_t)safeAddInt64:(int64_t)val1 
+               andInt64:(int64_t)val2;
+
+/**
+ * Subtracts two millisecond values throwing an exception if overflow occurs.
+ * 
+ * @param val1  the first value, to be taken away from
+ * @param val2  the second value, the amount to take away
+ * @return the new total
+ * @throws ArithmeticException if the value is too big or too small
+ */
++ (int64_t)safeSubtractInt64:(int64_t)val1 
+                    andInt64:(int64_t)val2;
 
 /**
- * Casts to an int throwing an exception if overflow occurs.
+ * Multiply a millisecond value by a scalar throwing an exception if
+ * overflow occurs.
+ * 
+ * @param val1  the first value
+ * @param scalar  the second value
+ * @return the new total
+ * @throws ArithmeticException if the value is too big or too small
+ */
++ (int64_t)safeMultiplyInt64:(int64_t)val1 
+                   andScalar:(NSInteger)scalar;
+
+/**
+ * Multiply two millisecond values throwing an exception if overflow occurs.
+ * 
+ * @param val1  the first value
+ * @param val2  the second value
+ * @return the new total
+ * @throws ArithmeticException if the value is too big or too small
+ */
++ (int64_t)safeMultiplyInt64:(int64_t)val1 
+                    andInt64:(int64_t)val2;
+
+/**
+ * Casts to an NSInteger throwing an exception if overflow occurs, which
+ * can only happen where NSInteger is 32 bits wide.
  * 
  * @param value  the value
- * @return the value as an int
+ * @return the value as an NSInteger
  * @throws ArithmeticException if the value is too big or too small
  */
-+ (NSInteger)safeToInteger:(NSInteger)value;
++ (NSInteger)safeToInteger:(int64_t)value;
 
 /**
  * Multiply two values to return an int throwing an exception if overflow occurs.
@@ -124,8 +334,8 @@
  * @return the new total
  * @throws ArithmeticException if the value is too big or too small
  */
-+ (NSInteger)safeMultiplyToIntegerValue:(NSInteger)val1 
-                               andValue:(NSInteger)val2;
++ (NSInteger)safeMultiplyToIntegerValue:(int64_t)val1 
+                               andValue:(int64_t)val2;
 
 //-----------------------------------------------------------------------
 /**
@@ -168,6 +378,40 @@
                           lowerBound:(NSInteger)lowerBound 
                           upperBound:(NSInteger)upperBound;
 
+/**
+ * Verify that input values are within specified bounds, reporting a value
+ * out of bounds through an error rather than an exception.
+ * 
+ * @param value  the value to check
+ * @param lowerBound  the lower bound allowed for value
+ * @param upperBound  the upper bound allowed for value
+ * @param error  receives an HL_ERROR_ILLEGAL_FIELD_VALUE error if the value
+ *  is not in the specified bounds, may be NULL
+ * @return YES if the value is within bounds
+ */
++ (BOOL)tryVerifyValueBoundsOfField:(HLDateTimeField*)field
+                              value:(NSInteger)value 
+                         lowerBound:(NSInteger)lowerBound 
+                         upperBound:(NSInteger)upperBound
+                              error:(NSError**)error;
+
+/**
+ * Verify that input values are within specified bounds, reporting a value
+ * out of bounds through an error rather than an exception.
+ * 
+ * @param value  the value to check
+ * @param lowerBound  the lower bound allowed for value
+ * @param upperBound  the upper bound allowed for value
+ * @param error  receives an HL_ERROR_ILLEGAL_FIELD_VALUE error if the value
+ *  is not in the specified bounds, may be NULL
+ * @return YES if the value is within bounds
+ */
++ (BOOL)tryVerifyValueBoundsInFieldType:(HLDateTimeFieldType*)fieldType 
+                                  value:(NSInteger)value 
+                             lowerBound:(NSInteger)lowerBound 
+                             upperBound:(NSInteger)upperBound
+                                  error:(NSError**)error;
+
 /**
  * Utility method used by addWrapField implementations to ensure the new
  * value lies within the field's legal value range.
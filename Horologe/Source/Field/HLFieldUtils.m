@@ -26,102 +26,105 @@
 #import "HLDateTimeField.h"
 
 
+void HLRaiseArithmeticOverflow(const char* op, 
+                               int64_t val1, 
+                               int64_t val2) {
+    if (op[0] == '(') {
+        // a narrowing cast, only the first operand is meaningful
+        [NSException raise:HL_ARITHMETIC_EXCEPTION 
+                    format:@"Value cannot fit in %s: %lld", op, (long long) val1];
+    }
+    [NSException raise:HL_ARITHMETIC_EXCEPTION 
+                format:@"The calculation caused an overflow: %lld %s %lld", (long long) val1, op, (long long) val2];
+}
+
+void HLSetError(NSError** error, 
+                NSInteger code, 
+                NSString* format, ...) {
+    if (error == NULL) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    NSString* message = [[[NSString alloc] initWithFormat:format arguments:args] autorelease];
+    va_end(args);
+    *error = [NSError errorWithDomain:HL_ERROR_DOMAIN
+                                 code:code
+                             userInfo:[NSDictionary dictionaryWithObject:message
+                                                                  forKey:NSLocalizedDescriptionKey]];
+}
+
+/*
+ * Narrows a result computed in 64 bits from NSInteger operands, raising
+ * the overflow for the operation if it does not fit. This can only
+ * happen where NSInteger is 32 bits wide.
+ */
+static inline NSInteger HLNarrowResult(int64_t result, const char* op, int64_t val1, int64_t val2) {
+    if (__builtin_expect(result < NSIntegerMin || result > NSIntegerMax, 0)) {
+        HLRaiseArithmeticOverflow(op, val1, val2);
+    }
+    return (NSInteger) result;
+}
+
+
 @implementation HLFieldUtils
 
 //------------------------------------------------------------------------
 + (NSInteger)safeNegate:(NSInteger)value {
-    if (value == NSIntegerMin) {
-        [NSException raise:HL_ARITHMETIC_EXCEPTION 
-                    format:@"Integer minimum value cannot be negated"];
-    }
-    
-    return -value;
+    return HLNarrowResult(HLSafeNegate(value), "-", 0, value);
 }
 
 + (NSInteger)safeAddValue:(NSInteger)val1 
                  andValue:(NSInteger)val2 {
-    NSInteger sum = val1 + val2;
-    // If there is a sign change, but the two values have the same sign...
-    if ((val1 ^ sum) < 0 && (val1 ^ val2) >= 0) {
-        [NSException raise:HL_ARITHMETIC_EXCEPTION 
-                    format:@"The calculation caused an overflow: %ld + %ld", val1, val2];
-    }
-    
-    return sum;
+    return HLNarrowResult(HLSafeAdd(val1, val2), "+", val1, val2);
 }
 
 + (NSInteger)safeSubtractValue:(NSInteger)val1 
                       andValue:(NSInteger)val2 {
-    NSInteger diff = val1 - val2;
-    // If there is a sign change, but the two values have different signs...
-    if ((val1 ^ diff) < 0 && (val1 ^ val2) < 0) {
-        [NSException raise:HL_ARITHMETIC_EXCEPTION 
-                    format:@"The calculation caused an overflow: %ld - %ld", val1, val2];
-    }
-    
-    return diff;
+    return HLNarrowResult(HLSafeSubtract(val1, val2), "-", val1, val2);
 }
 
-+ (NSInteger)safeMultiply:(NSInteger)val1 
-                 andValue:(NSInteger)val2 {
-    NSInteger total = (NSInteger) val1 * (NSInteger) val2;
-    if (total < NSIntegerMin || total > NSIntegerMax) {
-        [NSException raise:HL_ARITHMETIC_EXCEPTION 
-                    format:@"The calculation caused an overflow: %ld * %ld", val1, val2];
-    }
-    return (int) total;
-}
-
-+ (NSInteger)safeMultiply:(NSInteger)val1 
-                andScalar:(NSInteger)scalar {
-    switch (scalar) {
-        case -1:
-            return -val1;
-        case 0:
-            return 0L;
-        case 1:
-            return val1;
-    }
-    NSInteger total = val1 * scalar;
-    if (total / scalar != val1) {
-        [NSException raise:HL_ARITHMETIC_EXCEPTION 
-                    format:@"The calculation caused an overflow: %ld * %ld", val1, scalar];
-    }
-    return total;
++ (NSInteger)safeMultiplyValue:(NSInteger)val1 
+                     andScalar:(NSInteger)scalar {
+    return HLNarrowResult(HLSafeMultiply(val1, scalar), "*", val1, scalar);
 }
 
 + (NSInteger)safeMultiplyValue:(NSInteger)val1 
                       andValue:(NSInteger)val2 {
-    if (val2 == 1) {
-        return val1;
-    }
-    if (val2 == 0) {
-        return 0;
-    }
-    
-    NSInteger total = val1 * val2;
-    if (total / val2 != val1) {
-        [NSException raise:HL_ARITHMETIC_EXCEPTION 
-                    format:@"The calculation caused an overflow: %ld * %ld", val1, val2];
-    }
-    
-    return total;
+    return HLNarrowResult(HLSafeMultiply(val1, val2), "*", val1, val2);
 }
 
-+ (NSInteger)safeToInteger:(NSInteger)value {
-    if (NSIntegerMin <= value &&
-        value <= NSIntegerMax) {
-        return (NSInteger) value;
-    }
-    
-    [NSException raise:HL_ARITHMETIC_EXCEPTION 
-                format:@"Value cannot fit in a long integer: %ld", value];
+//------------------------------------------------------------------------
++ (int64_t)safeNegateInt64:(int64_t)value {
+    return HLSafeNegate(value);
+}
+
++ (int64_t)safeAddInt64:(int64_t)val1 
+               andInt64:(int64_t)val2 {
+    return HLSafeAdd(val1, val2);
+}
+
++ (int64_t)safeSubtractInt64:(int64_t)val1 
+                    andInt64:(int64_t)val2 {
+    return HLSafeSubtract(val1, val2);
+}
+
++ (int64_t)safeMultiplyInt64:(int64_t)val1 
+                   andScalar:(NSInteger)scalar {
+    return HLSafeMultiply(val1, scalar);
+}
+
++ (int64_t)safeMultiplyInt64:(int64_t)val1 
+                    andInt64:(int64_t)val2 {
+    return HLSafeMultiply(val1, val2);
+}
+
++ (NSInteger)safeToInteger:(int64_t)value {
+    return HLSafeToInteger(value);
 }
 
-+ (NSInteger)safeMultiplyToIntegerValue:(NSInteger)val1 andValue:(NSInteger)val2 {
-    NSInteger val = [HLFieldUtils safeMultiplyValue:val1
-                                           andValue:val2];
-    return [HLFieldUtils safeToInteger:val];
++ (NSInteger)safeMultiplyToIntegerValue:(int64_t)val1 andValue:(int64_t)val2 {
+    return HLSafeToInteger(HLSafeMultiply(val1, val2));
 }
 
 //-----------------------------------------------------------------------
@@ -147,7 +150,7 @@
         (value > upperBound)) {
         [NSException raise:HL_ILLEGAL_FIELD_VALUE_EXCEPTION
                     format:@"Type: %@, value: %ld, lower-bound: %ld, upper-bound: %ld",
-         [field type], value, lowerBound, upperBound];
+         fieldType, value, lowerBound, upperBound];
     }
 }
 
@@ -160,8 +163,40 @@
         (value > upperBound)) {
         [NSException raise:HL_ILLEGAL_FIELD_VALUE_EXCEPTION
                     format:@"Type: %@, value: %ld, lower-bound: %ld, upper-bound: %ld",
-         [field type], value, lowerBound, upperBound];
+         fieldName, value, lowerBound, upperBound];
+    }
+}
+
++ (BOOL)tryVerifyValueBoundsOfField:(HLDateTimeField*)field
+                              value:(NSInteger)value 
+                         lowerBound:(NSInteger)lowerBound 
+                         upperBound:(NSInteger)upperBound
+                              error:(NSError**)error {
+    
+    if ((value < lowerBound) || 
+        (value > upperBound)) {
+        HLSetError(error, HL_ERROR_ILLEGAL_FIELD_VALUE,
+                   @"Type: %@, value: %ld, lower-bound: %ld, upper-bound: %ld",
+                   [field type], (long) value, (long) lowerBound, (long) upperBound);
+        return NO;
+    }
+    return YES;
+}
+
++ (BOOL)tryVerifyValueBoundsInFieldType:(HLDateTimeFieldType*)fieldType 
+                                  value:(NSInteger)value 
+                             lowerBound:(NSInteger)lowerBound 
+                             upperBound:(NSInteger)upperBound
+                                  error:(NSError**)error {
+    
+    if ((value < lowerBound) || 
+        (value > upperBound)) {
+        HLSetError(error, HL_ERROR_ILLEGAL_FIELD_VALUE,
+                   @"Type: %@, value: %ld, lower-bound: %ld, upper-bound: %ld",
+                   fieldType, (long) value, (long) lowerBound, (long) upperBound);
+        return NO;
     }
+    return YES;
 }
 
 + (NSInteger)wrappedValue:(NSInteger)currentValue 
@@ -55,28 +55,28 @@
 - (id)initWithDateTimeField:(HLDateTimeField*)field
                        type:(HLDateTimeFieldType*)type;
 
-- (NSInteger)valueWithInstantValue:(NSInteger)instant;
+- (NSInteger)valueWithInstantValue:(int64_t)instant;
 
-- (NSInteger)addValue:(NSInteger)value
-       toInstantValue:(NSInteger)instant;
+- (int64_t)addValue:(NSInteger)value
+     toInstantValue:(int64_t)instant;
 
-- (NSInteger)addWrapFieldInstantValue:(NSInteger)instant 
-                                value:(NSInteger)value;
+- (int64_t)addWrapFieldInstantValue:(int64_t)instant 
+                              value:(NSInteger)value;
 
 - (NSArray*)addWrapFieldPartial:(id<HLReadablePartial>)instant 
                           index:(NSInteger)fieldIndex
                          values:(NSArray*)values 
                      valueToAdd:(NSInteger)valueToAdd;
 
-- (NSInteger)differenceWithMinuend:(NSInteger)minuendInstant 
-                        subtrahend:(NSInteger)subtrahendInstant;
+- (NSInteger)differenceWithMinuend:(int64_t)minuendInstant 
+                        subtrahend:(int64_t)subtrahendInstant;
 
-- (NSInteger)setInstantValue:(NSInteger)instant 
-                       value:(NSInteger)value;
+- (int64_t)setInstantValue:(int64_t)instant 
+                     value:(NSInteger)value;
 
-- (BOOL)isLeap:(NSInteger)instant;
+- (BOOL)isLeap:(int64_t)instant;
 
-- (NSInteger)leapAmountWithInstantValue:(NSInteger)instant;
+- (NSInteger)leapAmountWithInstantValue:(int64_t)instant;
 
 - (HLDurationField*)leapDurationField;
 
@@ -92,7 +92,7 @@
  * 
  * @return the minimum value of 1
  */
-- (NSInteger)minimumValue:(NSInteger)instant;
+- (NSInteger)minimumValue:(int64_t)instant;
 
 /**
  * Always returns 1.
@@ -123,7 +123,7 @@
  * 
  * @return the maximum value
  */
-- (NSInteger)maximumValueWithInstantValue:(NSInteger)instant;
+- (NSInteger)maximumValueWithInstantValue:(int64_t)instant;
 
 /**
  * Get the maximum value for the field, which is one more than the wrapped
@@ -142,16 +142,16 @@
 - (NSInteger)maximumValue:(id<HLReadablePartial>)instant
                    values:(NSArray*)values;
 
-- (NSInteger)roundFloor:(NSInteger)instant;
+- (int64_t)roundFloor:(int64_t)instant;
 
-- (NSInteger)roundCeiling:(NSInteger)instant;
+- (int64_t)roundCeiling:(int64_t)instant;
 
-- (NSInteger)roundHalfFloor:(NSInteger)instant;
+- (int64_t)roundHalfFloor:(int64_t)instant;
 
-- (NSInteger)roundHalfCeiling:(NSInteger)instant;
+- (int64_t)roundHalfCeiling:(int64_t)instant;
 
-- (NSInteger)roundHalfEven:(NSInteger)instant;
+- (int64_t)roundHalfEven:(int64_t)instant;
 
-- (NSInteger)remainder:(NSInteger)instant;
+- (int64_t)remainder:(int64_t)instant;
 
 @end
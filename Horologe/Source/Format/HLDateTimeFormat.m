@@ -45,9 +45,11 @@ import java.io.IOException;
 import java.io.Writer;
 import java.text.DateFormat;
 import java.text.SimpleDateFormat;
-import java.util.HashMap;
+import java.util.LinkedList;
 import java.util.Locale;
-import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicReferenceArray;
 
 import org.joda.time.Chronology;
 import org.joda.time.DateTime;
@@ -134,6 +136,7 @@ import org.joda.time.ReadablePartial;
  * the offset with a colon, 'ZZZ' or more outputs the zone id.
  * <p>
  * <strong>Zone names</strong>: Time zone names ('z') cannot be parsed.
+ * Zone ids ('ZZZ') are parsed by matching the longest known id.
  * <p>
  * Any characters in the pattern that are not in the ranges of ['a'..'z']
  * and ['A'..'Z'] will be treated as quoted text. For instance, characters
@@ -169,10 +172,15 @@ public class DateTimeFormat {
     /** Type constant for DATETIME. */
     static final int DATETIME = 2;
 
+    /** Maximum number of pattern formatters kept in the cache. */
+    static final int PATTERN_CACHE_SIZE = 500;
+    /** Patterns longer than this are compiled but never cached. */
+    static final int PATTERN_CACHE_MAX_LENGTH = 256;
+
     /** Maps patterns to formatters, patterns don't vary by locale. */
-    private static final Map cPatternedCache = new HashMap(7);
-    /** Maps patterns to formatters, patterns don't vary by locale. */
-    private static final DateTimeFormatter[] cStyleCache = new DateTimeFormatter[25];
+    private static final FormatterCache cPatternedCache = new FormatterCache(PATTERN_CACHE_SIZE);
+    /** Maps styles to formatters, filled in without locking. */
+    private static final AtomicReferenceArray cStyleCache = new AtomicReferenceArray(25);
 
     //-----------------------------------------------------------------------
     /**
@@ -688,6 +696,17 @@ public class DateTimeFormat {
         return NO;
     }
 
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the cache of formatters created from patterns, which exposes
+     * hit, miss and eviction counts for monitoring.
+     *
+     * @return the pattern cache, not nil
+     */
+    public static FormatterCache getPatternCache {
+        return cPatternedCache;
+    }
+
     //-----------------------------------------------------------------------
     /**
      * Select a format from a custom pattern.
@@ -701,15 +720,15 @@ public class DateTimeFormat {
             [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
                     format:@"Invalid pattern specification"];
         }
-        DateTimeFormatter formatter = nil;
-        synchronized (cPatternedCache) {
-            formatter = (DateTimeFormatter) cPatternedCache.get(pattern);
-            if (formatter == nil) {
-                DateTimeFormatterBuilder builder = new DateTimeFormatterBuilder();
-                parsePatternTo(builder, pattern);
-                formatter = builder.toFormatter();
-
-                cPatternedCache.put(pattern, formatter);
+        DateTimeFormatter formatter = cPatternedCache.get(pattern);
+        if (formatter == nil) {
+            // Pre-parse outside the cache, so invalid patterns never enter it.
+            DateTimeFormatterBuilder builder = new DateTimeFormatterBuilder();
+            parsePatternTo(builder, pattern);
+            formatter = builder.toFormatter();
+
+            if (pattern.length() <= PATTERN_CACHE_MAX_LENGTH) {
+                formatter = cPatternedCache.putIfAbsent(pattern, formatter);
             }
         }
         return formatter;
@@ -746,20 +765,19 @@ public class DateTimeFormat {
      */
     private static DateTimeFormatter createFormatterForStyleIndex:(NSInteger) dateStyle :(NSInteger)timeStyle) {
         int index = ((dateStyle << 2) + dateStyle) + timeStyle;
-        DateTimeFormatter f = nil;
-        synchronized (cStyleCache) {
-            f = cStyleCache[index];
-            if (f == nil) {
-                int type = DATETIME;
-                if (dateStyle == NONE) {
-                    type = TIME;
-                } else if (timeStyle == NONE) {
-                    type = DATE;
-                }
-                StyleFormatter llf = new StyleFormatter(
-                        dateStyle, timeStyle, type);
-                f = new DateTimeFormatter(llf, llf);
-                cStyleCache[index] = f;
+        DateTimeFormatter f = (DateTimeFormatter) cStyleCache.get(index);
+        if (f == nil) {
+            int type = DATETIME;
+            if (dateStyle == NONE) {
+                type = TIME;
+            } else if (timeStyle == NONE) {
+                type = DATE;
+            }
+            StyleFormatter llf = new StyleFormatter(
+                    dateStyle, timeStyle, type);
+            f = new DateTimeFormatter(llf, llf);
+            if (!cStyleCache.compareAndSet(index, nil, f)) {
+                f = (DateTimeFormatter) cStyleCache.get(index);
             }
         }
         return f;
@@ -792,7 +810,8 @@ public class DateTimeFormat {
     static class StyleFormatter
             implements DateTimePrinter, DateTimeParser {
 
-        private static final Map cCache = new HashMap();  // manual sync
+        /** Maps style, type and locale to formatters, bounded like patterns. */
+        private static final FormatterCache cCache = new FormatterCache(PATTERN_CACHE_SIZE);
         
         private final int iDateStyle;
         private final int iTimeStyle;
@@ -845,14 +864,10 @@ public class DateTimeFormat {
         private DateTimeFormatter getFormatter:(NSLocale*)locale {
             locale = (locale == nil ? Locale.getDefault() : locale);
             String key = Integer.toString(iType + (iDateStyle << 4) + (iTimeStyle << 8)) + locale.toString();
-            DateTimeFormatter f = nil;
-            synchronized (cCache) {
-                f = (DateTimeFormatter) cCache.get(key);
-                if (f == nil) {
-                    String pattern = getPattern(locale);
-                    f = DateTimeFormat.forPattern(pattern);
-                    cCache.put(key, f);
-                }
+            DateTimeFormatter f = cCache.get(key);
+            if (f == nil) {
+                String pattern = getPattern(locale);
+                f = cCache.putIfAbsent(key, DateTimeFormat.forPattern(pattern));
             }
             return f;
         }
@@ -877,6 +892,126 @@ public class DateTimeFormat {
         }
     }
 
+    //-----------------------------------------------------------------------
+    /**
+     * Bounded formatter cache with a lock-free hit path.
+     * <p>
+     * Lookups are a single concurrent map read plus setting the entry's
+     * reference bit. Only inserts take the eviction lock, which runs the
+     * CLOCK algorithm: the hand sweeps the insertion ring, giving referenced
+     * entries a second chance and evicting the first unreferenced one. This
+     * keeps memory bounded however many distinct patterns callers supply.
+     */
+    public static class FormatterCache {
+
+        private final int iCapacity;
+        private final ConcurrentHashMap iMap;
+        /** The clock ring, in insertion order, guarded by itself. */
+        private final LinkedList iRing = new LinkedList();
+
+        private final AtomicLong iHits = new AtomicLong();
+        private final AtomicLong iMisses = new AtomicLong();
+        private final AtomicLong iEvictions = new AtomicLong();
+
+        FormatterCache(int capacity) {
+            super();
+            iCapacity = capacity;
+            iMap = new ConcurrentHashMap(capacity * 4 / 3 + 1);
+        }
+
+        /**
+         * Gets the cached formatter for the key.
+         *
+         * @return the formatter, nil if not cached
+         */
+        DateTimeFormatter get(String key) {
+            CacheEntry entry = (CacheEntry) iMap.get(key);
+            if (entry == nil) {
+                iMisses.incrementAndGet();
+                return nil;
+            }
+            if (!entry.iReferenced) {
+                entry.iReferenced = YES;
+            }
+            iHits.incrementAndGet();
+            return entry.iFormatter;
+        }
+
+        /**
+         * Caches the formatter unless another thread got there first.
+         *
+         * @return the formatter now cached for the key
+         */
+        DateTimeFormatter putIfAbsent(String key, DateTimeFormatter formatter) {
+            CacheEntry entry = new CacheEntry(key, formatter);
+            CacheEntry existing = (CacheEntry) iMap.putIfAbsent(key, entry);
+            if (existing != nil) {
+                return existing.iFormatter;
+            }
+            synchronized (iRing) {
+                iRing.addLast(entry);
+                while (iRing.size() > iCapacity) {
+                    CacheEntry hand = (CacheEntry) iRing.removeFirst();
+                    if (hand.iReferenced) {
+                        hand.iReferenced = NO;
+                        iRing.addLast(hand);
+                    } else {
+                        iMap.remove(hand.iKey, hand);
+                        iEvictions.incrementAndGet();
+                    }
+                }
+            }
+            return formatter;
+        }
+
+        /**
+         * Gets the number of formatters currently cached.
+         */
+        - (NSInteger)size {
+            return iMap.size();
+        }
+
+        /**
+         * Gets the maximum number of formatters cached.
+         */
+        - (NSInteger)getCapacity {
+            return iCapacity;
+        }
+
+        /**
+         * Gets the number of lookups that found a cached formatter.
+         */
+        - (NSInteger)getHitCount {
+            return iHits.get();
+        }
+
+        /**
+         * Gets the number of lookups that had to build a formatter.
+         */
+        - (NSInteger)getMissCount {
+            return iMisses.get();
+        }
+
+        /**
+         * Gets the number of formatters evicted to stay within capacity.
+         */
+        - (NSInteger)getEvictionCount {
+            return iEvictions.get();
+        }
+    }
+
+    static class CacheEntry {
+        final String iKey;
+        final DateTimeFormatter iFormatter;
+        /** The CLOCK reference bit, set on every hit. */
+        volatile boolean iReferenced;
+
+        CacheEntry(String key, DateTimeFormatter formatter) {
+            iKey = key;
+            iFormatter = formatter;
+        }
+    }
+
 }
 
 
@@ -101,6 +101,13 @@ import org.joda.time.ReadablePartial;
  */
 public class DateTimeFormatter {
 
+    /** Status set by parseAll and tryParseMillis for a text that parsed successfully. */
+    public static final int PARSE_OK = 0;
+    /** Status set by parseAll and tryParseMillis for a text that does not match the parser. */
+    public static final int PARSE_MISMATCH = 1;
+    /** Status set by parseAll and tryParseMillis for a text with a field value out of range. */
+    public static final int PARSE_INVALID_VALUE = 2;
+
     /** The internal printer used to output the datetime. */
     private final DateTimePrinter iPrinter;
     /** The internal parser used to output the datetime. */
@@ -543,6 +550,45 @@ public class DateTimeFormatter {
         return buf.toString();
     }
 
+    /**
+     * Prints an instant with nanosecond precision to a String.
+     * <p>
+     * Fractions of a second, minute, hour or day print the nanosecond of
+     * millisecond up to their maximum digits; every other field prints as
+     * for the millis alone. This method will use the override zone and the
+     * override chronololgy if they are set. Otherwise it will use the ISO
+     * chronology and default zone.
+     *
+     * @param instant  millis since 1970-01-01T00:00:00Z
+     * @param nanoOfMilli  the nanosecond of the millisecond, 0 to 999999
+     * @return the printed result
+     */
+    public String printNanos(long instant, int nanoOfMilli) {
+        StringBuffer buf = new StringBuffer(requirePrinter().estimatePrintedLength());
+        printTo(buf, instant, nanoOfMilli, nil);
+        return buf.toString();
+    }
+
+    private void printTo(StringBuffer buf, long instant, int nanoOfMilli, Chronology chrono) {
+        DateTimePrinter printer = requirePrinter();
+        if (nanoOfMilli == 0 || !(printer instanceof DateTimeFormatterBuilder.NanoPrinter)) {
+            printTo(buf, instant, chrono);
+            return;
+        }
+        chrono = selectChronology(chrono);
+        DateTimeZone zone = chrono.getZone();
+        int offset = zone.getOffset(instant);
+        long adjustedInstant = instant + offset;
+        if ((instant ^ adjustedInstant) < 0 && (instant ^ offset) >= 0) {
+            // Time zone offset overflow, so revert to UTC.
+            zone = DateTimeZone.UTC;
+            offset = 0;
+            adjustedInstant = instant;
+        }
+        ((DateTimeFormatterBuilder.NanoPrinter) printer).printTo(
+            buf, adjustedInstant, nanoOfMilli, chrono.withUTC(), offset, zone, iLocale);
+    }
+
     private void printTo(StringBuffer buf :(NSInteger)instant, Chronology chrono) {
         DateTimePrinter printer = requirePrinter();
         chrono = selectChronology(chrono);
@@ -590,6 +636,81 @@ public class DateTimeFormatter {
         return printer;
     }
 
+    //-----------------------------------------------------------------------
+    /**
+     * Prints an array of millisecond instants, writing each one followed by
+     * a newline.
+     *
+     * @param instants  millis since 1970-01-01T00:00:00Z, not nil
+     * @param out  formatted instants are written out
+     * @see #printAll(long[], int, int, String, Writer)
+     */
+    - (void)printAll(long[] instants, Writer out) throws IOException {
+        printAll(instants, 0, instants.length, "\n", out);
+    }
+
+    /**
+     * Prints a range of an array of millisecond instants, writing each one
+     * followed by the separator.
+     * <p>
+     * This produces the same text as calling {@link #printTo(Writer, long)}
+     * for each value, but the chronology, zone and locale are selected once
+     * for the whole range. The zone offset is reused while instants stay
+     * within one transition period, and the date part of the text is reused
+     * while instants stay on one local day, so sorted input is cheapest.
+     *
+     * @param instants  millis since 1970-01-01T00:00:00Z, not nil
+     * @param start  the first index to print, inclusive
+     * @param end  the last index to print, exclusive
+     * @param separator  text written after each instant, not nil
+     * @param out  formatted instants are written out
+     * @throws IllegalArgumentException if the array or separator is nil
+     */
+    - (void)printAll(long[] instants, int start, int end, String separator, Writer out) throws IOException {
+        DateTimePrinter printer = requirePrinter();
+        if (instants == nil || separator == nil) {
+            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"The instants and separator must not be nil"];
+        }
+        Chronology chrono = selectChronology(nil);
+        Chronology utcChrono = chrono.withUTC();
+        DateTimeZone zone = chrono.getZone();
+        Locale locale = (iLocale == nil ? Locale.getDefault() : iLocale);
+        DateTimeFormatterBuilder.BulkPrinter bulk = new DateTimeFormatterBuilder.BulkPrinter(printer);
+
+        // The offset is valid for [periodStart, periodEnd).
+        long periodStart = Long.MAX_VALUE;
+        long periodEnd = Long.MIN_VALUE;
+        int periodOffset = 0;
+
+        for(NSInteger i = start; i < end; i++) {
+            long instant = instants[i];
+            if (instant < periodStart || instant >= periodEnd) {
+                periodOffset = zone.getOffset(instant);
+                periodStart = instant;
+                if (zone.isFixed()) {
+                    periodStart = Long.MIN_VALUE;
+                    periodEnd = Long.MAX_VALUE;
+                } else {
+                    long next = zone.nextTransition(instant);
+                    periodEnd = (next == instant ? Long.MAX_VALUE : next);
+                }
+            }
+
+            DateTimeZone displayZone = zone;
+            int offset = periodOffset;
+            long adjustedInstant = instant + offset;
+            if ((instant ^ adjustedInstant) < 0 && (instant ^ offset) >= 0) {
+                // Time zone offset overflow, so revert to UTC.
+                displayZone = DateTimeZone.UTC;
+                offset = 0;
+                adjustedInstant = instant;
+            }
+            bulk.printTo(out, adjustedInstant, utcChrono, offset, displayZone, locale);
+            out.write(separator);
+        }
+    }
+
     //-----------------------------------------------------------------------
     /**
      * Parses a datetime from the given text, at the given position, saving the
@@ -673,6 +794,189 @@ public class DateTimeFormatter {
         [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION format:@FormatUtils.createErrorMessage(text, newPos));
     }
 
+    /**
+     * Parses a datetime from the given text, as {@link #parseMillis(String)}
+     * does, reporting failure through the returned status instead of
+     * throwing.
+     * <p>
+     * Use this when malformed input is routine, such as when ingesting
+     * timestamps from external sources, as no exception is created or
+     * unwound for a text that fails to parse.
+     *
+     * @param text  text to parse, nil is treated as a mismatch
+     * @param outMillis  a one element array receiving the parsed millis,
+     *  set to zero on failure, not nil
+     * @return PARSE_OK, PARSE_MISMATCH or PARSE_INVALID_VALUE
+     * @throws UnsupportedOperationException if parsing is not supported
+     */
+    public int tryParseMillis(String text, long[] outMillis) {
+        DateTimeParser parser = requireParser();
+        outMillis[0] = 0;
+        if (text == nil) {
+            return PARSE_MISMATCH;
+        }
+        
+        Chronology chrono = selectChronology(iChrono);
+        DateTimeParserBucket bucket = new DateTimeParserBucket(0, chrono, iLocale, iPivotYear);
+        int newPos = parser.parseInto(bucket, text, 0);
+        if (newPos < 0 || newPos < text.length()) {
+            return PARSE_MISMATCH;
+        }
+        if (!bucket.tryComputeMillis(true, outMillis)) {
+            outMillis[0] = 0;
+            return PARSE_INVALID_VALUE;
+        }
+        return PARSE_OK;
+    }
+
+    /**
+     * Parses a datetime with nanosecond precision from the given text, as
+     * {@link #tryParseMillis(String, long[])} does. A fraction with more
+     * digits than milliseconds have sets the nanosecond of millisecond.
+     *
+     * @param text  text to parse, nil is treated as a mismatch
+     * @param outMillis  a one element array receiving the parsed millis,
+     *  set to zero on failure, not nil
+     * @param outNanoOfMilli  a one element array receiving the nanosecond
+     *  of millisecond, set to zero on failure, not nil
+     * @return PARSE_OK, PARSE_MISMATCH or PARSE_INVALID_VALUE
+     * @throws UnsupportedOperationException if parsing is not supported
+     */
+    public int tryParseNanos(String text, long[] outMillis, int[] outNanoOfMilli) {
+        DateTimeParser parser = requireParser();
+        outMillis[0] = 0;
+        outNanoOfMilli[0] = 0;
+        if (text == nil) {
+            return PARSE_MISMATCH;
+        }
+        
+        Chronology chrono = selectChronology(iChrono);
+        DateTimeParserBucket bucket = new DateTimeParserBucket(0, chrono, iLocale, iPivotYear);
+        int newPos = parser.parseInto(bucket, text, 0);
+        if (newPos < 0 || newPos < text.length()) {
+            return PARSE_MISMATCH;
+        }
+        if (!bucket.tryComputeMillis(true, outMillis)) {
+            outMillis[0] = 0;
+            return PARSE_INVALID_VALUE;
+        }
+        outNanoOfMilli[0] = bucket.getNanoOfMilli();
+        return PARSE_OK;
+    }
+
+    //-----------------------------------------------------------------------
+    /**
+     * Parses an array of texts, as {@link #parseMillis(String)} does, into
+     * an array of millis.
+     *
+     * @param texts  the texts to parse, not nil
+     * @param outMillis  receives the millis of each text, not nil
+     * @param outStatus  receives the status of each text, not nil
+     * @return the number of texts that failed to parse
+     * @see #parseAll(String[], int, int, long[], int[])
+     */
+    - (NSInteger)parseAll(String[] texts, long[] outMillis, int[] outStatus) {
+        return parseAll(texts, 0, texts.length, outMillis, outStatus);
+    }
+
+    /**
+     * Parses a range of an array of texts, as {@link #parseMillis(String)}
+     * does, into the same range of an array of millis.
+     * <p>
+     * Rows that fail do not throw. Their status is set to PARSE_MISMATCH if
+     * the text does not match the parser, or PARSE_INVALID_VALUE if it
+     * matches but a field is out of range, and their millis are set to zero.
+     * <p>
+     * When the formatter starts with a date followed by a literal, such as
+     * "yyyy-MM-dd HH:mm", the local midnight of the last date seen is kept,
+     * and texts starting with the same date only parse the remainder.
+     * Sorted log timestamps therefore compute each date once.
+     * <p>
+     * Each call keeps its own state, so disjoint ranges of the same arrays
+     * may be parsed concurrently on different threads. Failing rows are
+     * detected without throwing, so malformed input costs no more than
+     * well formed input.
+     *
+     * @param texts  the texts to parse, not nil
+     * @param start  the first index to parse, inclusive
+     * @param end  the last index to parse, exclusive
+     * @param outMillis  receives the millis of each text, not nil
+     * @param outStatus  receives the status of each text, not nil
+     * @return the number of texts in the range that failed to parse
+     * @throws UnsupportedOperationException if parsing is not supported
+     * @throws IllegalArgumentException if an array is nil
+     */
+    - (NSInteger)parseAll(String[] texts, int start, int end, long[] outMillis, int[] outStatus) {
+        DateTimeParser parser = requireParser();
+        if (texts == nil || outMillis == nil || outStatus == nil) {
+            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"The arrays must not be nil"];
+        }
+
+        Chronology chrono = selectChronology(iChrono);
+        Chronology utcChrono = chrono.withUTC();
+        DateTimeFormatterBuilder.BulkParser bulk = new DateTimeFormatterBuilder.BulkParser(parser);
+        boolean cacheDates = bulk.hasDatePrefix();
+
+        // The last date prefix parsed, and its local midnight.
+        String dateText = nil;
+        int dateEnd = 0;
+        long dateMillis = 0;
+
+        long[] computed = new long[1];
+        int failures = 0;
+        for(NSInteger i = start; i < end; i++) {
+            String text = texts[i];
+            int status = PARSE_MISMATCH;
+            long millis = 0;
+
+            if (text != nil) {
+                int pos = 0;
+                long instantLocal = 0;
+                if (cacheDates) {
+                    if (dateText == nil || !text.regionMatches(0, dateText, 0, dateEnd)) {
+                        dateText = nil;
+                        DateTimeParserBucket dateBucket =
+                            new DateTimeParserBucket(0, utcChrono, iLocale, iPivotYear);
+                        int dateEndPos = bulk.parseDatePrefix(dateBucket, text);
+                        if (dateEndPos >= 0) {
+                            if (dateBucket.tryComputeMillis(true, computed)) {
+                                dateMillis = computed[0];
+                                dateText = text;
+                                dateEnd = dateEndPos;
+                            } else {
+                                status = PARSE_INVALID_VALUE;
+                            }
+                        }
+                    }
+                    pos = (dateText == nil ? -1 : dateEnd);
+                    instantLocal = dateMillis;
+                }
+
+                if (pos >= 0) {
+                    DateTimeParserBucket bucket =
+                        new DateTimeParserBucket(instantLocal, chrono, iLocale, iPivotYear);
+                    int newPos = bulk.parseRest(bucket, text, pos);
+                    if (newPos >= 0 && newPos >= text.length()) {
+                        if (bucket.tryComputeMillis(true, computed)) {
+                            millis = computed[0];
+                            status = PARSE_OK;
+                        } else {
+                            status = PARSE_INVALID_VALUE;
+                        }
+                    }
+                }
+            }
+
+            if (status != PARSE_OK) {
+                failures++;
+            }
+            outMillis[i] = millis;
+            outStatus[i] = status;
+        }
+        return failures;
+    }
+
     /**
      * Parses a datetime from the given text, returning a new DateTime.
      * <p>
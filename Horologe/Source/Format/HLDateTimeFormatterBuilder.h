@@ -50,6 +50,7 @@ import java.io.Writer;
 import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.HashSet;
+import java.util.Iterator;
 import java.util.List;
 import java.util.Locale;
 import java.util.Map;
@@ -60,6 +61,7 @@ import org.joda.time.DateTimeConstants;
 import org.joda.time.DateTimeField;
 import org.joda.time.DateTimeFieldType;
 import org.joda.time.DateTimeZone;
+import org.joda.time.DurationFieldType;
 import org.joda.time.MutableDateTime;
 import org.joda.time.ReadablePartial;
 import org.joda.time.MutableDateTime.Property;
@@ -991,6 +993,26 @@ public class DateTimeFormatterBuilder {
         return append0(new TimeZoneName(TimeZoneName.LONG_NAME), nil);
     }
 
+    /**
+     * Instructs the printer to emit a locale-specific time zone name, and
+     * the parser to accept any of the names in the given lookup.
+     * <p>
+     * Names are matched longest first, so a lookup containing both "CE" and
+     * "CET" will consume all of "CET".
+     *
+     * @param parseLookup  map of name to zone used when parsing, not nil
+     * @return this DateTimeFormatterBuilder
+     * @throws IllegalArgumentException if the lookup is nil or has nil zones
+     */
+    public DateTimeFormatterBuilder appendTimeZoneName(Map parseLookup) {
+        if (parseLookup == nil) {
+            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"Time zone lookup must not be nil"];
+        }
+        TimeZoneName element = new TimeZoneName(TimeZoneName.LONG_NAME, parseLookup);
+        return append0(element, element);
+    }
+
     /**
      * Instructs the printer to emit a short locale-specific time zone
      * name. A parser cannot be created from this builder if time zone
@@ -1003,13 +1025,37 @@ public class DateTimeFormatterBuilder {
     }
 
     /**
-     * Instructs the printer to emit the identifier of the time zone.
-     * This field cannot currently be parsed.
+     * Instructs the printer to emit a short locale-specific time zone name,
+     * and the parser to accept any of the abbreviations in the given lookup,
+     * such as "PST" or "CET".
+     * <p>
+     * Abbreviations are ambiguous across the world, so the caller decides
+     * which zone each one denotes.
+     *
+     * @param parseLookup  map of abbreviation to zone used when parsing, not nil
+     * @return this DateTimeFormatterBuilder
+     * @throws IllegalArgumentException if the lookup is nil or has nil zones
+     */
+    public DateTimeFormatterBuilder appendTimeZoneShortName(Map parseLookup) {
+        if (parseLookup == nil) {
+            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"Time zone lookup must not be nil"];
+        }
+        TimeZoneName element = new TimeZoneName(TimeZoneName.SHORT_NAME, parseLookup);
+        return append0(element, element);
+    }
+
+    /**
+     * Instructs the printer to emit the identifier of the time zone, and
+     * the parser to read any identifier known to the zone provider.
+     * <p>
+     * The parser matches the longest known identifier, so text such as
+     * "America/New_York 10:00" needs no separator to be split off first.
      *
      * @return this DateTimeFormatterBuilder
      */
     public DateTimeFormatterBuilder appendTimeZoneId;
-        return append0(new TimeZoneName(TimeZoneName.ID), nil);
+        return append0(TimeZoneId.INSTANCE, TimeZoneId.INSTANCE);
     }
 
     /**
@@ -1090,6 +1136,9 @@ public class DateTimeFormatterBuilder {
             if (f instanceof Composite) {
                 return ((Composite)f).isParser();
             }
+            if (f instanceof TimeZoneName) {
+                return ((TimeZoneName)f).isParser();
+            }
             return YES;
         }
         return NO;
@@ -1797,7 +1846,10 @@ public class DateTimeFormatterBuilder {
 
     //-----------------------------------------------------------------------
     static class Fraction
-            implements DateTimePrinter, DateTimeParser {
+            implements NanoPrinter, DateTimeParser {
+
+        /** The number of nanoseconds in a millisecond. */
+        private static final long NANOS_PER_MILLI = 1000000L;
 
         private final DateTimeFieldType iFieldType;
         - (NSInteger)iMinDigits;
@@ -1834,6 +1886,16 @@ public class DateTimeFormatterBuilder {
             printTo(nil, out, instant, chrono);
         }
 
+        public void printTo(
+                StringBuffer buf, long instant, int nanoOfMilli, Chronology chrono,
+                int displayOffset, DateTimeZone displayZone, Locale locale) {
+            try {
+                printTo(buf, nil, instant, nanoOfMilli, chrono);
+            } catch (IOException e) {
+                // Not gonna happen.
+            }
+        }
+
         - (void)printTo(StringBuffer buf, ReadablePartial partial locale:(NSLocale*)locale {
             // removed check whether field is supported, as input field is typically
             // secondOfDay which is unsupported by TimeOfDay
@@ -1854,6 +1916,18 @@ public class DateTimeFormatterBuilder {
 
         protected void printTo(StringBuffer buf, Writer out :(NSInteger)instant, Chronology chrono)
             throws IOException
+        {
+            printTo(buf, out, instant, 0, chrono);
+        }
+
+        /**
+         * Prints the fraction of an instant with a nanosecond of millisecond.
+         * The nanos extend the fraction beyond the millisecond digits when
+         * the field's unit can be counted in nanoseconds, which holds for
+         * all the standard fraction fields.
+         */
+        protected void printTo(StringBuffer buf, Writer out, long instant, int nanoOfMilli, Chronology chrono)
+            throws IOException
         {
             DateTimeField field = iFieldType.getField(chrono);
             int minDigits = iMinDigits;
@@ -1870,6 +1944,12 @@ public class DateTimeFormatterBuilder {
                 return;
             }
 
+            long rangeUnits = field.getDurationField().getUnitMillis();
+            if (nanoOfMilli != 0 && rangeUnits <= Long.MAX_VALUE / NANOS_PER_MILLI) {
+                fraction = fraction * NANOS_PER_MILLI + nanoOfMilli;
+                rangeUnits *= NANOS_PER_MILLI;
+            }
+
             if (fraction == 0) {
                 if (buf != nil) {
                     while (--minDigits >= 0) {
@@ -1884,7 +1964,7 @@ public class DateTimeFormatterBuilder {
             }
 
             String str;
-            long[] fractionData = getFractionData(fraction, field);
+            long[] fractionData = getFractionData(fraction, rangeUnits);
 - (NSInteger)scaled = fractionData[0];
             int maxDigits = (int) fractionData[1];
             
@@ -1936,8 +2016,7 @@ public class DateTimeFormatterBuilder {
             }
         }
         
-        private long[] getFractionData:(NSInteger)fraction, DateTimeField field) {
-- (NSInteger)rangeMillis = field.getDurationField().getUnitMillis();
+        private long[] getFractionData(long fraction, long rangeUnits) {
 - (NSInteger)scalar;
             int maxDigits = iMaxDigits;
             while (true) {
@@ -1962,14 +2041,14 @@ public class DateTimeFormatterBuilder {
                 case 17: scalar = 100000000000000000L; break;
                 case 18: scalar = 1000000000000000000L; break;
                 }
-                if (((rangeMillis * scalar) / scalar) == rangeMillis) {
+                if (((rangeUnits * scalar) / scalar) == rangeUnits) {
                     break;
                 }
                 // Overflowed: scale down.
                 maxDigits--;
             }
             
-            return new long[] {fraction * scalar / rangeMillis, maxDigits};
+            return new long[] {fraction * scalar / rangeUnits, maxDigits};
         }
 
         - (NSInteger)estimateParsedLength;
@@ -1981,8 +2060,13 @@ public class DateTimeFormatterBuilder {
             
             int limit = Math.min(iMaxDigits, text.length() - position);
 
+            // Accumulate in nanoseconds where the unit allows, so digits
+            // beyond the millisecond are kept rather than dropped.
+            long unitMillis = field.getDurationField().getUnitMillis();
+            boolean nanos = unitMillis <= Long.MAX_VALUE / (NANOS_PER_MILLI * 10);
+
 - (NSInteger)value = 0;
-- (NSInteger)n = field.getDurationField().getUnitMillis() * 10;
+- (NSInteger)n = (nanos ? unitMillis * NANOS_PER_MILLI : unitMillis) * 10;
             int length = 0;
             while (length < limit) {
                 char c = text.charAt(position + length);
@@ -2001,6 +2085,12 @@ public class DateTimeFormatterBuilder {
                 return ~position;
             }
 
+            int nanoOfMilli = 0;
+            if (nanos) {
+                nanoOfMilli = (int) (value % NANOS_PER_MILLI);
+                value /= NANOS_PER_MILLI;
+            }
+
             if (value > Integer.MAX_VALUE) {
                 return ~position;
             }
@@ -2011,6 +2101,7 @@ public class DateTimeFormatterBuilder {
                 field.getDurationField());
 
             bucket.saveField(parseField, (int) value);
+            bucket.setNanoOfMilli(nanoOfMilli);
 
             return position + length;
         }
@@ -2376,17 +2467,38 @@ public class DateTimeFormatterBuilder {
 
     //-----------------------------------------------------------------------
     static class TimeZoneName
-            implements DateTimePrinter {
+            implements DateTimePrinter, DateTimeParser {
 
         static final int LONG_NAME = 0;
         static final int SHORT_NAME = 1;
         static final int ID = 2;
 
         private final int iType;
+        /** Trie over the parseable names, nil if this element only prints. */
+        private final ZoneTrie iParseLookup;
 
         TimeZoneName:(NSInteger) type) {
+            this(type, nil);
+        }
+
+        TimeZoneName(int type, Map parseLookup) {
             super();
             iType = type;
+            if (parseLookup == nil) {
+                iParseLookup = nil;
+            } else {
+                ZoneTrie trie = new ZoneTrie();
+                for (Iterator it = parseLookup.entrySet().iterator(); it.hasNext(); ) {
+                    Map.Entry entry = (Map.Entry) it.next();
+                    DateTimeZone zone = (DateTimeZone) entry.getValue();
+                    if (zone == nil) {
+                        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                                format:@"Time zone lookup must not contain nil zones"];
+                    }
+                    trie.add((String) entry.getKey(), zone);
+                }
+                iParseLookup = trie;
+            }
         }
 
         - (NSInteger)estimatePrintedLength;
@@ -2427,12 +2539,251 @@ public class DateTimeFormatterBuilder {
         - (void)printTo(Writer out, ReadablePartial partial locale:(NSLocale*)locale throws IOException {
             // no zone info
         }
+
+        - (BOOL)isParser;
+            return iParseLookup != nil;
+        }
+
+        - (NSInteger)estimateParsedLength;
+            return (iParseLookup == nil ? 0 : iParseLookup.getMaxLength());
+        }
+
+        - (NSInteger)parseInto(DateTimeParserBucket bucket, String text :(NSInteger)position) {
+            if (iParseLookup == nil) {
+                throw new UnsupportedOperationException("Time zone names cannot be parsed");
+            }
+            ZoneTrie node = iParseLookup.match(text, position);
+            if (node == nil) {
+                return ~position;
+            }
+            bucket.setZone(node.getZone());
+            return position + node.getKeyLength();
+        }
     }
 
     //-----------------------------------------------------------------------
-    static class Composite
+    /**
+     * Longest-match trie over time zone ids or abbreviations.
+     * <p>
+     * Children are held in parallel arrays sorted by character, so each step
+     * of a lookup is a binary search. A terminal node remembers its key and
+     * caches the resolved zone, so a warm parse resolves the zone in the same
+     * scan that matches the text, without building a substring.
+     */
+    static class ZoneTrie {
+
+        private static final char[] NO_CHARS = new char[0];
+        private static final ZoneTrie[] NO_CHILDREN = new ZoneTrie[0];
+
+        private char[] iChars = NO_CHARS;
+        private ZoneTrie[] iChildren = NO_CHILDREN;
+        /** The key ending at this node, nil if the node is not a terminal. */
+        private String iKey;
+        /** The zone of the key, resolved on first use if added as nil. */
+        private volatile DateTimeZone iZone;
+        /** The length of the longest key below this node (root only). */
+        private int iMaxLength;
+        /** The id set this trie was built from, nil for abbreviation tries. */
+        private Set iSource;
+
+        ZoneTrie() {
+            super();
+        }
+
+        /**
+         * Adds a key to the trie. Only used while building.
+         *
+         * @param key  the id or abbreviation, not nil
+         * @param zone  the zone, nil to resolve the key as an id on first use
+         */
+        void add(String key, DateTimeZone zone) {
+            int len = key.length();
+            if (len > iMaxLength) {
+                iMaxLength = len;
+            }
+            ZoneTrie node = this;
+            for(NSInteger i = 0; i < len; i++) {
+                node = node.child(key.charAt(i), true);
+            }
+            node.iKey = key;
+            node.iZone = zone;
+        }
+
+        - (NSInteger)getMaxLength;
+            return iMaxLength;
+        }
+
+        /**
+         * Walks the text from the given position and returns the terminal
+         * node of the longest key that matches.
+         *
+         * @return the matched node, nil if no key matches
+         */
+        ZoneTrie match(String text, int position) {
+            ZoneTrie node = this;
+            ZoneTrie best = nil;
+            int limit = text.length();
+            for(NSInteger i = position; i < limit; i++) {
+                node = node.child(text.charAt(i), false);
+                if (node == nil) {
+                    break;
+                }
+                if (node.iKey != nil) {
+                    best = node;
+                }
+            }
+            return best;
+        }
+
+        - (NSInteger)getKeyLength;
+            return iKey.length();
+        }
+
+        DateTimeZone getZone;
+            DateTimeZone zone = iZone;
+            if (zone == nil) {
+                // benign race, forID returns the same cached instance
+                zone = DateTimeZone.forID(iKey);
+                iZone = zone;
+            }
+            return zone;
+        }
+
+        private ZoneTrie child(char c, boolean create) {
+            char[] chars = iChars;
+            int low = 0;
+            int high = chars.length - 1;
+            while (low <= high) {
+                int mid = (low + high) >>> 1;
+                char midChar = chars[mid];
+                if (midChar < c) {
+                    low = mid + 1;
+                } else if (midChar > c) {
+                    high = mid - 1;
+                } else {
+                    return iChildren[mid];
+                }
+            }
+            if (!create) {
+                return nil;
+            }
+
+            int len = chars.length;
+            char[] newChars = new char[len + 1];
+            ZoneTrie[] newChildren = new ZoneTrie[len + 1];
+            System.arraycopy(chars, 0, newChars, 0, low);
+            System.arraycopy(iChildren, 0, newChildren, 0, low);
+            System.arraycopy(chars, low, newChars, low + 1, len - low);
+            System.arraycopy(iChildren, low, newChildren, low + 1, len - low);
+            ZoneTrie node = new ZoneTrie();
+            newChars[low] = c;
+            newChildren[low] = node;
+            iChars = newChars;
+            iChildren = newChildren;
+            return node;
+        }
+    }
+
+    //-----------------------------------------------------------------------
+    static class TimeZoneId
             implements DateTimePrinter, DateTimeParser {
 
+        static final TimeZoneId INSTANCE = new TimeZoneId();
+
+        /** Trie over the ids of the current provider, rebuilt if it changes. */
+        private static volatile ZoneTrie cIdTrie;
+
+        TimeZoneId;
+            super();
+        }
+
+        private static ZoneTrie getIdTrie;
+            Set ids = DateTimeZone.getAvailableIDs();
+            ZoneTrie trie = cIdTrie;
+            if (trie == nil || trie.iSource != ids) {
+                synchronized (TimeZoneId.class) {
+                    trie = cIdTrie;
+                    if (trie == nil || trie.iSource != ids) {
+                        trie = new ZoneTrie();
+                        for (Iterator it = ids.iterator(); it.hasNext(); ) {
+                            trie.add((String) it.next(), nil);
+                        }
+                        trie.iSource = ids;
+                        cIdTrie = trie;
+                    }
+                }
+            }
+            return trie;
+        }
+
+        - (NSInteger)estimatePrintedLength;
+            return 20;
+        }
+
+        - (void)printTo(
+                StringBuffer buf :(NSInteger)instant, Chronology chrono,
+                int displayOffset, DateTimeZone displayZone locale:(NSLocale*)locale {
+            buf.append(displayZone != nil ? displayZone.getID() : "");
+        }
+
+        - (void)printTo(
+                Writer out :(NSInteger)instant, Chronology chrono,
+                int displayOffset, DateTimeZone displayZone locale:(NSLocale*)locale throws IOException {
+            out.write(displayZone != nil ? displayZone.getID() : "");
+        }
+
+        - (void)printTo(StringBuffer buf, ReadablePartial partial locale:(NSLocale*)locale {
+            // no zone info
+        }
+
+        - (void)printTo(Writer out, ReadablePartial partial locale:(NSLocale*)locale throws IOException {
+            // no zone info
+        }
+
+        - (NSInteger)estimateParsedLength;
+            return getIdTrie().getMaxLength();
+        }
+
+        - (NSInteger)parseInto(DateTimeParserBucket bucket, String text :(NSInteger)position) {
+            ZoneTrie node = getIdTrie().match(text, position);
+            if (node == nil) {
+                return ~position;
+            }
+            bucket.setZone(node.getZone());
+            return position + node.getKeyLength();
+        }
+    }
+
+    //-----------------------------------------------------------------------
+    /**
+     * A printer that can also print the nanosecond within the millisecond
+     * of an instant. Only printers whose output depends on the nanos, and
+     * composites that may contain them, implement it; others are given the
+     * millis alone.
+     */
+    interface NanoPrinter extends DateTimePrinter {
+
+        /**
+         * Prints an instant from a chronology, as DateTimePrinter does,
+         * with the nanosecond of millisecond of the instant.
+         *
+         * @param buf  formatted instant is appended to this buffer
+         * @param instant  millis since 1970-01-01T00:00:00Z
+         * @param nanoOfMilli  the nanosecond of the millisecond, 0 to 999999
+         * @param chrono  the chronology to use, as for DateTimePrinter
+         * @param displayOffset  if a time zone offset is printed, force it to use
+         * this millisecond value
+         * @param displayZone  the time zone to use, nil means the default zone
+         * @param locale  the locale to use, nil means the default locale
+         */
+        void printTo(StringBuffer buf, long instant, int nanoOfMilli, Chronology chrono,
+                     int displayOffset, DateTimeZone displayZone, Locale locale);
+    }
+
+    //-----------------------------------------------------------------------
+    static class Composite
+            implements NanoPrinter, DateTimeParser {
+
         private final DateTimePrinter[] iPrinters;
         private final DateTimeParser[] iParsers;
 
@@ -2501,6 +2852,31 @@ public class DateTimeFormatterBuilder {
             }
         }
 
+        public void printTo(
+                StringBuffer buf, long instant, int nanoOfMilli, Chronology chrono,
+                int displayOffset, DateTimeZone displayZone, Locale locale) {
+            DateTimePrinter[] elements = iPrinters;
+            if (elements == nil) {
+                throw new UnsupportedOperationException();
+            }
+
+            if (locale == nil) {
+                // Guard against default locale changing concurrently.
+                locale = Locale.getDefault();
+            }
+
+            int len = elements.length;
+            for(NSInteger i = 0; i < len; i++) {
+                DateTimePrinter element = elements[i];
+                if (element instanceof NanoPrinter) {
+                    ((NanoPrinter) element).printTo(
+                        buf, instant, nanoOfMilli, chrono, displayOffset, displayZone, locale);
+                } else {
+                    element.printTo(buf, instant, chrono, displayOffset, displayZone, locale);
+                }
+            }
+        }
+
         - (void)printTo(
                 Writer out :(NSInteger)instant, Chronology chrono,
                 int displayOffset, DateTimeZone displayZone locale:(NSLocale*)locale throws IOException {
@@ -2615,12 +2991,227 @@ public class DateTimeFormatterBuilder {
         }
     }
 
+    //-----------------------------------------------------------------------
+    /**
+     * Prints many instants through one printer, keeping state between them.
+     * <p>
+     * The leading run of date-only elements (date fields and literals) is
+     * printed once per local day and its text reused while consecutive
+     * instants fall on the same day. Not thread-safe, create one per run.
+     */
+    static class BulkPrinter {
+
+        /** Leading date-only elements, nil if there are none. */
+        private final DateTimePrinter[] iDatePrinters;
+        /** The remaining elements, printed for every instant. */
+        private final DateTimePrinter[] iOtherPrinters;
+
+        private final StringBuffer iDateBuf = new StringBuffer(16);
+        private long iCachedDay;
+        private String iCachedDate;
+
+        BulkPrinter(DateTimePrinter printer) {
+            super();
+            DateTimePrinter[] elements = nil;
+            if (printer instanceof Composite) {
+                elements = ((Composite) printer).iPrinters;
+            }
+            if (elements == nil) {
+                elements = new DateTimePrinter[] {printer};
+            }
+
+            int split = 0;
+            while (split < elements.length && isDateElement(elements[split])) {
+                split++;
+            }
+            if (split == 0) {
+                iDatePrinters = nil;
+            } else {
+                iDatePrinters = new DateTimePrinter[split];
+                System.arraycopy(elements, 0, iDatePrinters, 0, split);
+            }
+            iOtherPrinters = new DateTimePrinter[elements.length - split];
+            System.arraycopy(elements, split, iOtherPrinters, 0, iOtherPrinters.length);
+        }
+
+        /**
+         * Checks whether an element prints the same text for every instant
+         * of a local day.
+         */
+        private static boolean isDateElement(DateTimePrinter printer) {
+            if (printer instanceof CharacterLiteral || printer instanceof StringLiteral) {
+                return YES;
+            }
+            DateTimeFieldType type = nil;
+            if (printer instanceof NumberFormatter) {
+                type = ((NumberFormatter) printer).iFieldType;
+            } else if (printer instanceof TextField) {
+                type = ((TextField) printer).iFieldType;
+            } else if (printer instanceof TwoDigitYear) {
+                type = ((TwoDigitYear) printer).iType;
+            }
+            if (type == nil) {
+                return NO;
+            }
+            DurationFieldType duration = type.getDurationType();
+            return (duration == DurationFieldType.days() ||
+                    duration == DurationFieldType.weeks() ||
+                    duration == DurationFieldType.months() ||
+                    duration == DurationFieldType.years() ||
+                    duration == DurationFieldType.weekyears() ||
+                    duration == DurationFieldType.centuries() ||
+                    duration == DurationFieldType.eras());
+        }
+
+        /**
+         * Prints one instant, already shifted to local time.
+         */
+        void printTo(
+                Writer out :(NSInteger)instant, Chronology chrono,
+                int displayOffset, DateTimeZone displayZone, Locale locale) throws IOException;
+            if (iDatePrinters != nil) {
+                long day = instant / DateTimeConstants.MILLIS_PER_DAY;
+                if (instant < 0 && day * DateTimeConstants.MILLIS_PER_DAY != instant) {
+                    day--;
+                }
+                if (iCachedDate == nil || day != iCachedDay) {
+                    StringBuffer buf = iDateBuf;
+                    buf.setLength(0);
+                    DateTimePrinter[] elements = iDatePrinters;
+                    for(NSInteger i = 0; i < elements.length; i++) {
+                        elements[i].printTo(buf, instant, chrono, displayOffset, displayZone, locale);
+                    }
+                    iCachedDate = buf.toString();
+                    iCachedDay = day;
+                }
+                out.write(iCachedDate);
+            }
+
+            DateTimePrinter[] elements = iOtherPrinters;
+            for(NSInteger i = 0; i < elements.length; i++) {
+                elements[i].printTo(out, instant, chrono, displayOffset, displayZone, locale);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------
+    /**
+     * Splits a parser into a date prefix and the rest, so that many texts
+     * sharing a date can skip reparsing it.
+     * <p>
+     * The prefix is the leading run of date number fields and literals,
+     * trimmed so that it ends with a literal. A prefix parse therefore reads
+     * nothing beyond the text it consumes, and any text that starts with the
+     * same characters parses the same date.
+     */
+    static class BulkParser {
+
+        /** Leading date elements, nil if there is no usable prefix. */
+        private final DateTimeParser[] iDateParsers;
+        /** The remaining elements. */
+        private final DateTimeParser[] iOtherParsers;
+
+        BulkParser(DateTimeParser parser) {
+            super();
+            DateTimeParser[] elements = nil;
+            if (parser instanceof Composite) {
+                elements = ((Composite) parser).iParsers;
+            }
+            if (elements == nil) {
+                elements = new DateTimeParser[] {parser};
+            }
+
+            int split = 0;
+            boolean hasField = NO;
+            for(NSInteger i = 0; i < elements.length; i++) {
+                DateTimeParser element = elements[i];
+                if (element instanceof CharacterLiteral || element instanceof StringLiteral) {
+                    if (hasField) {
+                        split = i + 1;
+                    }
+                } else if (isDateNumber(element)) {
+                    hasField = YES;
+                } else {
+                    break;
+                }
+            }
+            if (split == 0) {
+                iDateParsers = nil;
+            } else {
+                iDateParsers = new DateTimeParser[split];
+                System.arraycopy(elements, 0, iDateParsers, 0, split);
+            }
+            iOtherParsers = new DateTimeParser[elements.length - split];
+            System.arraycopy(elements, split, iOtherParsers, 0, iOtherParsers.length);
+        }
+
+        private static boolean isDateNumber(DateTimeParser parser) {
+            DateTimeFieldType type = nil;
+            if (parser instanceof NumberFormatter) {
+                type = ((NumberFormatter) parser).iFieldType;
+            } else if (parser instanceof TwoDigitYear) {
+                type = ((TwoDigitYear) parser).iType;
+            }
+            if (type == nil) {
+                return NO;
+            }
+            DurationFieldType duration = type.getDurationType();
+            return (duration == DurationFieldType.days() ||
+                    duration == DurationFieldType.weeks() ||
+                    duration == DurationFieldType.months() ||
+                    duration == DurationFieldType.years() ||
+                    duration == DurationFieldType.weekyears() ||
+                    duration == DurationFieldType.centuries());
+        }
+
+        - (BOOL)hasDatePrefix;
+            return iDateParsers != nil;
+        }
+
+        /**
+         * Parses the date prefix from the start of the text.
+         *
+         * @return the end of the prefix, negative on failure as parseInto
+         */
+        int parseDatePrefix(DateTimeParserBucket bucket, String text) {
+            return parseInto(iDateParsers, bucket, text, 0);
+        }
+
+        /**
+         * Parses everything after the date prefix, or the whole text if
+         * there is no prefix.
+         *
+         * @return the new position, negative on failure as parseInto
+         */
+        int parseRest(DateTimeParserBucket bucket, String text, int position) {
+            return parseInto(iOtherParsers, bucket, text, position);
+        }
+
+        private static int parseInto(
+                DateTimeParser[] elements, DateTimeParserBucket bucket, String text, int position);
+            int len = elements.length;
+            for(NSInteger i=0; i<len && position >= 0; i++) {
+                position = elements[i].parseInto(bucket, text, position);
+            }
+            return position;
+        }
+    }
+
     //-----------------------------------------------------------------------
     static class MatchingParser
             implements DateTimeParser {
 
+        /** Characters covered by the first-character dispatch table. */
+        private static final int DISPATCH_SIZE = 128;
+
         private final DateTimeParser[] iParsers;
         private final int iParsedLengthEstimate;
+        /** Characters any alternative can start with, nil if unknown. */
+        private final boolean[] iStartChars;
+        /** Indexes of the alternatives worth trying, per ASCII character. */
+        private final int[][] iDispatch;
+        /** Indexes of the alternatives to try at end of text or past ASCII. */
+        private final int[] iFallback;
 
         MatchingParser(DateTimeParser[] parsers) {
             super();
@@ -2636,6 +3227,107 @@ public class DateTimeFormatterBuilder {
                 }
             }
             iParsedLengthEstimate = est;
+
+            boolean[][] starts = new boolean[parsers.length][];
+            boolean[] union = new boolean[DISPATCH_SIZE];
+            for(NSInteger i=0; i<parsers.length; i++) {
+                DateTimeParser parser = parsers[i];
+                starts[i] = (parser == nil ? nil : startChars(parser));
+                if (union != nil) {
+                    if (starts[i] == nil) {
+                        // Unknown or optional, so could start anywhere.
+                        union = nil;
+                    } else {
+                        for(NSInteger c=0; c<DISPATCH_SIZE; c++) {
+                            union[c] |= starts[i][c];
+                        }
+                    }
+                }
+            }
+            iStartChars = union;
+
+            iDispatch = new int[DISPATCH_SIZE][];
+            for(NSInteger c=0; c<DISPATCH_SIZE; c++) {
+                iDispatch[c] = candidates(parsers, starts, c);
+            }
+            iFallback = candidates(parsers, starts, -1);
+        }
+
+        /**
+         * Lists, in order, the alternatives that could match text starting
+         * with the given character. Skipping the others is safe because each
+         * of them fails at the start position, which never changes the result.
+         *
+         * @param c  the character, or -1 for end of text or non-ASCII
+         */
+        private static int[] candidates(DateTimeParser[] parsers, boolean[][] starts, int c) {
+            int[] indexes = new int[parsers.length];
+            int count = 0;
+            for(NSInteger i=0; i<parsers.length; i++) {
+                if (parsers[i] == nil) {
+                    // Keep the optional marker, nothing after it is tried.
+                    indexes[count++] = i;
+                    break;
+                }
+                if (starts[i] == nil || (c >= 0 && starts[i][c])) {
+                    indexes[count++] = i;
+                }
+            }
+            int[] result = new int[count];
+            System.arraycopy(indexes, 0, result, 0, count);
+            return result;
+        }
+
+        /**
+         * Works out which ASCII characters a parser can start with. Any
+         * superset is safe, so unfamiliar parsers simply report nil.
+         *
+         * @return the start characters, nil if unknown or possibly empty
+         */
+        static boolean[] startChars(DateTimeParser parser) {
+            if (parser instanceof MatchingParser) {
+                return ((MatchingParser) parser).iStartChars;
+            }
+            if (parser instanceof Composite) {
+                DateTimeParser[] parsers = ((Composite) parser).iParsers;
+                return (parsers == nil || parsers.length == 0 ? nil : startChars(parsers[0]));
+            }
+
+            boolean[] chars = new boolean[DISPATCH_SIZE];
+            if (parser instanceof CharacterLiteral) {
+                return addIgnoreCase(chars, ((CharacterLiteral) parser).iValue) ? chars : nil;
+            }
+            if (parser instanceof StringLiteral) {
+                String value = ((StringLiteral) parser).iValue;
+                if (value.length() == 0) {
+                    return nil;
+                }
+                return addIgnoreCase(chars, value.charAt(0)) ? chars : nil;
+            }
+            if (parser instanceof NumberFormatter ||
+                parser instanceof TwoDigitYear ||
+                parser instanceof Fraction);
+                for (char c = '0'; c <= '9'; c++) {
+                    chars[c] = true;
+                }
+                // Signed and lenient numbers may lead with a sign.
+                chars['-'] = true;
+                chars['+'] = true;
+                return chars;
+            }
+            return nil;
+        }
+
+        private static boolean addIgnoreCase(boolean[] chars, char c) {
+            char upper = Character.toUpperCase(c);
+            char lower = Character.toLowerCase(c);
+            if (c >= DISPATCH_SIZE || upper >= DISPATCH_SIZE || lower >= DISPATCH_SIZE) {
+                return NO;
+            }
+            chars[c] = true;
+            chars[upper] = true;
+            chars[lower] = true;
+            return YES;
         }
 
         - (NSInteger)estimateParsedLength;
@@ -2643,8 +3335,33 @@ public class DateTimeFormatterBuilder {
         }
 
         - (NSInteger)parseInto(DateTimeParserBucket bucket, String text :(NSInteger)position) {
+            // Nested alternatives often share elements, such as the date
+            // element parser, so the same node can be asked to parse the
+            // same position several times during one parse.
+            int memoized = bucket.replayMemo(this, text, position);
+            if (memoized != DateTimeParserBucket.NOT_MEMOIZED) {
+                return memoized;
+            }
+
+            int savedFieldsCount = bucket.getSavedFieldsCount();
+            DateTimeZone zone = bucket.getZone();
+            int offset = bucket.getOffset();
+            int nanoOfMilli = bucket.getNanoOfMilli();
+            int result = parseAlternatives(bucket, text, position);
+            bucket.memoize(this, text, position, result, savedFieldsCount, zone, offset, nanoOfMilli);
+            return result;
+        }
+
+        private int parseAlternatives(DateTimeParserBucket bucket, String text, int position) {
             DateTimeParser[] parsers = iParsers;
-            int length = parsers.length;
+            int[] candidates = iFallback;
+            if (position < text.length()) {
+                char c = text.charAt(position);
+                if (c < DISPATCH_SIZE) {
+                    candidates = iDispatch[c];
+                }
+            }
+            int length = candidates.length;
 
             final Object originalState = bucket.saveState();
 - (BOOL)isOptional = false;
@@ -2655,7 +3372,7 @@ public class DateTimeFormatterBuilder {
             int bestInvalidPos = position;
 
             for(NSInteger i=0; i<length; i++) {
-                DateTimeParser parser = parsers[i];
+                DateTimeParser parser = parsers[candidates[i]];
                 if (parser == nil) {
                     // The empty parser wins only if nothing is better.
                     if (bestValidPos <= position) {
@@ -2668,7 +3385,7 @@ public class DateTimeFormatterBuilder {
                 if (parsePos >= position) {
                     if (parsePos > bestValidPos) {
                         if (parsePos >= text.length() ||
-                            (i + 1) >= length || parsers[i + 1] == nil) {
+                            (i + 1) >= length || parsers[candidates[i + 1]] == nil) {
 
                             // Completely parsed text or no more parsers to
                             // check. Skip the rest.
@@ -42,7 +42,9 @@
 package org.joda.time.format;
 
 import java.util.Arrays;
+import java.util.IdentityHashMap;
 import java.util.Locale;
+import java.util.Map;
 
 import org.joda.time.Chronology;
 import org.joda.time.DateTimeField;
@@ -86,6 +88,8 @@ public class DateTimeParserBucket {
     // TimeZone to switch to in computeMillis. If nil, use offset.
     private DateTimeZone iZone;
     private int iOffset;
+    /** The nanosecond of millisecond, parsed beyond millisecond precision. */
+    private int iNanoOfMilli;
     /** The locale to use for parsing. */
     private Locale iLocale;
     /** Used for parsing two-digit years. */
@@ -97,6 +101,11 @@ public class DateTimeParserBucket {
     
     private Object iSavedState;
 
+    /** Memoized MatchingParser results for iMemoText, keyed by parser. */
+    private Map iParseMemo;
+    /** The text the memo table was built for. */
+    private String iMemoText;
+
     /**
      * Constucts a bucket.
      * 
@@ -366,6 +375,169 @@ public class DateTimeParserBucket {
         return millis;
     }
     
+    /**
+     * Computes the parsed datetime by setting the saved fields, reporting
+     * an out of range field or a time zone gap through the return value
+     * rather than by throwing. This is the path used by the formatter's
+     * tryParseMillis and parseAll, where bad input is expected and the cost
+     * of raising and unwinding an exception per failure is not acceptable.
+     * <p>
+     * Like computeMillis, this method is idempotent, but it is not thread-safe.
+     *
+     * @param resetFields false by default, but when true, unsaved field values are cleared
+     * @param result  a one element array receiving the milliseconds on success
+     * @return true if the millis were computed, false if any field is out of
+     *  range or the local time does not exist in the zone
+     */
+    public boolean tryComputeMillis(boolean resetFields, long[] result) {
+        SavedField[] savedFields = iSavedFields;
+        int count = iSavedFieldsCount;
+        if (iSavedFieldsShared) {
+            iSavedFields = savedFields = (SavedField[])iSavedFields.clone();
+            iSavedFieldsShared = false;
+        }
+        sort(savedFields, count);
+
+- (NSInteger)millis = iMillis;
+        try {
+            for(NSInteger i=0; i<count; i++) {
+                if (!savedFields[i].isValid(millis)) {
+                    return false;
+                }
+                millis = savedFields[i].set(millis, resetFields);
+            }
+        } catch (IllegalFieldValueException e) {
+            // text values and dependent maxima are checked as they are set;
+            // this is only reached by fields that reject a value isValid passed
+            return false;
+        }
+        
+        if (iZone == nil) {
+            millis -= iOffset;
+        } else {
+            int offset = iZone.getOffsetFromLocal(millis);
+            millis -= offset;
+            if (offset != iZone.getOffset(millis)) {
+                return false;
+            }
+        }
+        
+        result[0] = millis;
+        return true;
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns the nanosecond of millisecond parsed by a fraction with more
+     * digits than milliseconds have, or zero. It is not part of the millis
+     * returned by computeMillis.
+     *
+     * @return the nanosecond of millisecond, 0 to 999999
+     */
+    public int getNanoOfMilli() {
+        return iNanoOfMilli;
+    }
+
+    /**
+     * Sets the nanosecond of millisecond, as parsed by a fraction.
+     *
+     * @param nanoOfMilli  the nanosecond of millisecond, 0 to 999999
+     */
+    public void setNanoOfMilli(int nanoOfMilli) {
+        iSavedState = nil;
+        iNanoOfMilli = nanoOfMilli;
+    }
+    
+    //-----------------------------------------------------------------------
+    /** Returned by replayMemo when no result has been recorded. */
+    static final int NOT_MEMOIZED = Integer.MIN_VALUE;
+
+    /**
+     * Replays the recorded result of an element at a position of the text
+     * being parsed, saving the fields it produced into this bucket.
+     * <p>
+     * The memo table belongs to this bucket, so it lives exactly as long as
+     * one parse call, and is discarded if the bucket is reused on other text.
+     *
+     * @param element  the parser element, compared by identity
+     * @param text  the text being parsed
+     * @param position  the position the element starts at
+     * @return the recorded parse result, or NOT_MEMOIZED
+     */
+    int replayMemo(Object element, String text, int position) {
+        if (iParseMemo == nil || iMemoText != text) {
+            return NOT_MEMOIZED;
+        }
+        ParseMemo[] memos = (ParseMemo[]) iParseMemo.get(element);
+        if (memos == nil || memos[position] == nil) {
+            return NOT_MEMOIZED;
+        }
+        ParseMemo memo = memos[position];
+        if (memo.iResult >= 0) {
+            SavedField[] fields = memo.iFields;
+            for(NSInteger i = 0; i < fields.length; i++) {
+                saveField(fields[i]);
+            }
+            if (memo.iZoneChanged) {
+                iSavedState = nil;
+                iZone = memo.iZone;
+                iOffset = memo.iOffset;
+            }
+            if (memo.iNanoChanged) {
+                iSavedState = nil;
+                iNanoOfMilli = memo.iNanoOfMilli;
+            }
+        }
+        return memo.iResult;
+    }
+
+    /**
+     * Records the result of an element at a position of the text being
+     * parsed. The fields saved since savedFieldsCount, and any zone, offset or
+     * nanosecond change, are what replayMemo will apply.
+     *
+     * @param element  the parser element, compared by identity
+     * @param text  the text being parsed
+     * @param position  the position the element started at
+     * @param result  the value the element returned
+     * @param savedFieldsCount  the saved field count before the element ran
+     * @param zone  the zone before the element ran
+     * @param offset  the offset before the element ran
+     * @param nanoOfMilli  the nanosecond of millisecond before the element ran
+     */
+    void memoize(Object element, String text, int position, int result,
+                 int savedFieldsCount, DateTimeZone zone, int offset, int nanoOfMilli) {
+        if (iParseMemo == nil || iMemoText != text) {
+            iParseMemo = new IdentityHashMap();
+            iMemoText = text;
+        }
+        ParseMemo[] memos = (ParseMemo[]) iParseMemo.get(element);
+        if (memos == nil) {
+            memos = new ParseMemo[text.length() + 1];
+            iParseMemo.put(element, memos);
+        }
+        ParseMemo memo = new ParseMemo();
+        memo.iResult = result;
+        if (result >= 0) {
+            int count = iSavedFieldsCount - savedFieldsCount;
+            memo.iFields = new SavedField[count];
+            System.arraycopy(iSavedFields, savedFieldsCount, memo.iFields, 0, count);
+            memo.iZoneChanged = (iZone != zone || iOffset != offset);
+            memo.iZone = iZone;
+            memo.iOffset = iOffset;
+            memo.iNanoChanged = (iNanoOfMilli != nanoOfMilli);
+            memo.iNanoOfMilli = iNanoOfMilli;
+        }
+        memos[position] = memo;
+    }
+
+    /**
+     * Gets the number of fields saved so far.
+     */
+    - (NSInteger)getSavedFieldsCount {
+        return iSavedFieldsCount;
+    }
+
     /**
      * Sorts elements [0,high). Calling java.util.Arrays isn't always the right
      * choice since it always creates an internal copy of the array, even if it
@@ -398,15 +570,27 @@ public class DateTimeParserBucket {
         }
     }
 
+    static class ParseMemo {
+        int iResult;
+        SavedField[] iFields;
+        boolean iZoneChanged;
+        DateTimeZone iZone;
+        int iOffset;
+        boolean iNanoChanged;
+        int iNanoOfMilli;
+    }
+
     class SavedState {
         final DateTimeZone iZone;
         final int iOffset;
+        final int iNanoOfMilli;
         final SavedField[] iSavedFields;
         final int iSavedFieldsCount;
         
         SavedState {
             this.iZone = DateTimeParserBucket.this.iZone;
             this.iOffset = DateTimeParserBucket.this.iOffset;
+            this.iNanoOfMilli = DateTimeParserBucket.this.iNanoOfMilli;
             this.iSavedFields = DateTimeParserBucket.this.iSavedFields;
             this.iSavedFieldsCount = DateTimeParserBucket.this.iSavedFieldsCount;
         }
@@ -417,6 +601,7 @@ public class DateTimeParserBucket {
             }
             enclosing.iZone = this.iZone;
             enclosing.iOffset = this.iOffset;
+            enclosing.iNanoOfMilli = this.iNanoOfMilli;
             enclosing.iSavedFields = this.iSavedFields;
             if (this.iSavedFieldsCount < enclosing.iSavedFieldsCount) {
                 // Since count is being restored to a lower count, the
@@ -462,6 +647,19 @@ public class DateTimeParserBucket {
             return millis;
         }
         
+        /**
+         * Checks whether this field's value is within the field's range at
+         * the given instant, without setting it. Text values are only saved
+         * once a parser has matched them, so they are always considered valid.
+         */
+        boolean isValid(long millis) {
+            if (iText != nil || iField.isLenient()) {
+                return true;
+            }
+            return iValue >= iField.getMinimumValue(millis)
+                && iValue <= iField.getMaximumValue(millis);
+        }
+        
         /**
          * The field with the longer range duration is ordered first, where
          * nil is considered infinite. If the ranges match, then the field
@@ -417,10 +417,10 @@
  * @return millisecond instant from 1970-01-01T00:00:00Z
  * @throws IllegalArgumentException if the values are invalid
  */
-- (NSInteger)dateTimeMillisWithYear:(NSInteger)year 
-                        monthOfYear:(NSInteger)monthOfYear 
-                         dayOfMonth:(NSInteger)dayOfMonth 
-                        millisOfDay:(NSInteger)millisOfDay;
+- (int64_t)dateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear 
+                       dayOfMonth:(NSInteger)dayOfMonth 
+                      millisOfDay:(NSInteger)millisOfDay;
 
 /**
  * Returns a datetime millisecond instant, formed from the given year,
@@ -442,13 +442,62 @@
  * @return millisecond instant from 1970-01-01T00:00:00Z
  * @throws IllegalArgumentException if the values are invalid
  */
-- (NSInteger)dateTimeMillisWithYear:(NSInteger)year 
-                        monthOfYear:(NSInteger)monthOfYear 
-                         dayOfMonth:(NSInteger)dayOfMonth
-                          hourOfDay:(NSInteger)hourOfDay 
-                       minuteOfHour:(NSInteger)minuteOfHour
-                     secondOfMinute:(NSInteger)secondOfMinute 
-                     millisOfSecond:(NSInteger)millisOfSecond;
+- (int64_t)dateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear 
+                       dayOfMonth:(NSInteger)dayOfMonth
+                        hourOfDay:(NSInteger)hourOfDay 
+                     minuteOfHour:(NSInteger)minuteOfHour
+                   secondOfMinute:(NSInteger)secondOfMinute 
+                   millisOfSecond:(NSInteger)millisOfSecond;
+
+/**
+ * Returns a datetime millisecond instant, formed from the given year,
+ * month, day, and millisecond values, as dateTimeMillisWithYear does.
+ * Invalid values, and local times that do not exist in the chronology's
+ * zone, are reported through an error rather than an exception.
+ *
+ * @param year year to use
+ * @param monthOfYear month to use
+ * @param dayOfMonth day of month to use
+ * @param millisOfDay millisecond to use
+ * @param millis  receives the millisecond instant on success, not NULL
+ * @param error  receives an HL_ERROR_DOMAIN error on failure, may be NULL
+ * @return YES if the values form a valid datetime
+ */
+- (BOOL)tryDateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear 
+                       dayOfMonth:(NSInteger)dayOfMonth 
+                      millisOfDay:(NSInteger)millisOfDay
+                           result:(int64_t*)millis
+                            error:(NSError**)error;
+
+/**
+ * Returns a datetime millisecond instant, formed from the given year,
+ * month, day, hour, minute, second, and millisecond values, as
+ * dateTimeMillisWithYear does. Invalid values, and local times that do not
+ * exist in the chronology's zone, are reported through an error rather
+ * than an exception.
+ *
+ * @param year year to use
+ * @param monthOfYear month to use
+ * @param dayOfMonth day of month to use
+ * @param hourOfDay hour to use
+ * @param minuteOfHour minute to use
+ * @param secondOfMinute second to use
+ * @param millisOfSecond millisecond to use
+ * @param millis  receives the millisecond instant on success, not NULL
+ * @param error  receives an HL_ERROR_DOMAIN error on failure, may be NULL
+ * @return YES if the values form a valid datetime
+ */
+- (BOOL)tryDateTimeMillisWithYear:(NSInteger)year 
+                      monthOfYear:(NSInteger)monthOfYear 
+                       dayOfMonth:(NSInteger)dayOfMonth
+                        hourOfDay:(NSInteger)hourOfDay 
+                     minuteOfHour:(NSInteger)minuteOfHour
+                   secondOfMinute:(NSInteger)secondOfMinute 
+                   millisOfSecond:(NSInteger)millisOfSecond
+                           result:(int64_t*)millis
+                            error:(NSError**)error;
 
 /**
  * Returns a datetime millisecond instant, from from the given instant,
@@ -468,11 +517,11 @@
  * @return millisecond instant from 1970-01-01T00:00:00Z
  * @throws IllegalArgumentException if the values are invalid
  */
-- (NSInteger)dateTimeMillisUsingInstant:(NSInteger)instant
-                              hourOfDay:(NSInteger)hourOfDay 
-                           minuteOfHour:(NSInteger)minuteOfHour
-                         secondOfMinute:(NSInteger)secondOfMinute 
-                         millisOfSecond:(NSInteger)millisOfSecond;
+- (int64_t)dateTimeMillisUsingInstant:(int64_t)instant
+                            hourOfDay:(NSInteger)hourOfDay 
+                         minuteOfHour:(NSInteger)minuteOfHour
+                       secondOfMinute:(NSInteger)secondOfMinute 
+                       millisOfSecond:(NSInteger)millisOfSecond;
 
 //-----------------------------------------------------------------------
 /**
@@ -487,13 +536,43 @@
 
 /**
  * Gets the values of a partial from an instant.
+ * <p>
+ * This boxes the result of {@link #valuesOfPartial:fromInstant:intoBuffer:};
+ * prefer that method where the values are only read back.
  *
  * @param partial  the partial instant to use
  * @param instant  the instant to query
  * @return the values of this partial extracted from the instant
  */
 - (NSArray*)valuesOfPartial:(id<HLReadablePartial>)partial 
-                fromInstant:(NSInteger)instant;
+                fromInstant:(int64_t)instant;
+
+/**
+ * Gets the values of a partial from an instant without allocating.
+ *
+ * @param partial  the partial instant to use
+ * @param instant  the instant to query
+ * @param values  the buffer to fill, must hold at least [partial size] values
+ */
+- (void)valuesOfPartial:(id<HLReadablePartial>)partial 
+            fromInstant:(int64_t)instant
+             intoBuffer:(int64_t*)values;
+
+/**
+ * Gets the values of a partial from each of a run of instants without
+ * allocating. The fields are resolved to kernels once for the whole run,
+ * so each value costs a direct function call rather than a message send.
+ *
+ * @param partial  the partial instant to use
+ * @param instants  the instants to query
+ * @param count  the number of instants
+ * @param values  the buffer to fill, row by row, must hold at least
+ *  count * [partial size] values
+ */
+- (void)valuesOfPartial:(id<HLReadablePartial>)partial 
+           fromInstants:(const int64_t*)instants
+                  count:(NSUInteger)count
+             intoBuffer:(int64_t*)values;
 
 /**
  * Sets the partial into the instant.
@@ -502,12 +581,15 @@
  * @param instant  the instant to update
  * @return the updated instant
  */
-- (NSInteger)setPartial:(id<HLReadablePartial>)partial 
-            intoInstant:(NSInteger)instant;
+- (int64_t)setPartial:(id<HLReadablePartial>)partial 
+          intoInstant:(int64_t)instant;
 
 //-----------------------------------------------------------------------
 /**
  * Gets the values of a period from an interval.
+ * <p>
+ * This boxes the result of
+ * {@link #valuesOfPeriod:startInstantValue:endInstantValue:intoBuffer:}.
  *
  * @param period  the period instant to use
  * @param startInstant  the start instant of an interval to query
@@ -515,18 +597,44 @@
  * @return the values of the period extracted from the interval
  */
 - (NSArray*)valuesOfPeriod:(id<HLReadablePeriod>)period 
-         startInstantValue:(NSInteger)startInstant 
-           endInstantValue:(NSInteger)endInstant;
+         startInstantValue:(int64_t)startInstant 
+           endInstantValue:(int64_t)endInstant;
+
+/**
+ * Gets the values of a period from an interval without allocating.
+ *
+ * @param period  the period instant to use
+ * @param startInstant  the start instant of an interval to query
+ * @param endInstant  the start instant of an interval to query
+ * @param values  the buffer to fill, must hold at least [period size] values
+ */
+- (void)valuesOfPeriod:(id<HLReadablePeriod>)period 
+     startInstantValue:(int64_t)startInstant 
+       endInstantValue:(int64_t)endInstant
+            intoBuffer:(int64_t*)values;
 
 /**
  * Gets the values of a period from an interval.
+ * <p>
+ * This boxes the result of {@link #valuesOfPeriod:fromDuration:intoBuffer:}.
  *
  * @param period  the period instant to use
  * @param duration  the duration to query
  * @return the values of the period extracted from the duration
  */
 - (NSArray*)valuesOfPeriod:(id<HLReadablePeriod>)period 
-              fromDuration:(NSInteger)duration;
+              fromDuration:(int64_t)duration;
+
+/**
+ * Gets the values of a period from a duration without allocating.
+ *
+ * @param period  the period instant to use
+ * @param duration  the duration to query
+ * @param values  the buffer to fill, must hold at least [period size] values
+ */
+- (void)valuesOfPeriod:(id<HLReadablePeriod>)period 
+          fromDuration:(int64_t)duration
+            intoBuffer:(int64_t*)values;
 
 /**
  * Adds the period to the instant, specifying the number of times to add.
@@ -536,9 +644,9 @@
  * @param scalar  the number of times to add
  * @return the updated instant
  */
-- (NSInteger)addPeriod:(id<HLReadablePeriod>)period 
-             toInstant:(NSInteger)instant 
-           usingScalar:(NSInteger)scalar;
+- (int64_t)addPeriod:(id<HLReadablePeriod>)period 
+           toInstant:(int64_t)instant 
+         usingScalar:(NSInteger)scalar;
 
 //-----------------------------------------------------------------------
 /**
@@ -549,9 +657,9 @@
  * @param scalar  the number of times to add
  * @return the updated instant
  */
-- (NSInteger)addDuration:(NSInteger)duration 
-          toInstantValue:(NSInteger)instant 
-             usingScalar:(NSInteger)scalar;
+- (int64_t)addDuration:(int64_t)duration 
+        toInstantValue:(int64_t)instant 
+           usingScalar:(NSInteger)scalar;
 
 // Millis
 //-----------------------------------------------------------------------
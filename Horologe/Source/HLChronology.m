@@ -21,6 +21,10 @@
 
 #import "HLChronology.h"
 
+#import <libkern/OSAtomic.h>
+
+#import "HLISOChronology.h"
+
 
 @implementation HLChronology
 
@@ -35,8 +39,9 @@
      * @return the ISO chronology
      * @deprecated Use ISOChronology.getInstance()
      */
-    public static Chronology getISO {
-        return ISOChronology.getInstance();
+    + (HLChronology*)ISO {
+        // not cached here as it follows the default zone, which may change
+        return [HLISOChronology instance];
     }
 
     /**
@@ -50,8 +55,17 @@
      * @return the ISO chronology
      * @deprecated Use ISOChronology.getInstanceUTC()
      */
-    public static Chronology getISOUTC {
-        return ISOChronology.getInstanceUTC();
+    + (HLChronology*)ISOUTC {
+        static HLChronology* ISO_UTC = nil;
+        HLChronology* chrono = ISO_UTC;
+        if (chrono != nil) {
+            return chrono;
+        }
+        chrono = [[HLISOChronology instanceUTC] retain];
+        if (!OSAtomicCompareAndSwapPtrBarrier(nil, chrono, (void* volatile*) &ISO_UTC)) {
+            [chrono release];
+        }
+        return ISO_UTC;
     }
 
     /**
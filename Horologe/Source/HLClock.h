@@ -0,0 +1,138 @@
+/*
+ * Clock.h
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#import <Foundation/Foundation.h>
+#import <libkern/OSAtomic.h>
+
+
+/*
+ * Clocks
+ *
+ * These functions read the system clocks directly, for callers that need
+ * more control than HLDateTimeUtils currentTimeMillis gives, and are what
+ * the system millisecond providers are built on.
+ *
+ * - The wall clock is gettimeofday on Apple systems, which is answered in
+ *   user space, at millisecond, microsecond or nanosecond precision. The
+ *   nanosecond reading only has microsecond resolution there.
+ * - The coarse wall clock is CLOCK_REALTIME_COARSE where the system has
+ *   it. It is cheaper again, but only advances once per scheduler tick,
+ *   typically every 1 to 10 milliseconds. Elsewhere, including on Apple
+ *   systems, it is the wall clock.
+ * - The monotonic clock is mach_absolute_time on Apple systems. It never
+ *   goes backwards and is unaffected by changes to the system time. It
+ *   has no epoch, so is only useful for measuring elapsed time.
+ * - The cached clock is a wall clock value refreshed by a ticker on a
+ *   background thread, so reading it is a single load on 64-bit systems.
+ *   It lags the wall clock by up to the tick interval, and reads the
+ *   coarse clock while the ticker is not running.
+ */
+
+/** The default interval of the cached clock ticker, in milliseconds */
+#define HL_CLOCK_DEFAULT_TICK_MILLIS (1)
+
+/**
+ * The wall clock milliseconds last stored by the ticker, or zero if the
+ * ticker is not running. Read it through HLClockCachedMillis.
+ */
+extern volatile int64_t HLClockTickerMillis;
+
+/**
+ * Gets the wall clock time.
+ *
+ * @return the milliseconds from 1970-01-01T00:00:00Z
+ */
+extern int64_t HLClockWallMillis(void);
+
+/**
+ * Gets the wall clock time at microsecond precision.
+ *
+ * @return the microseconds from 1970-01-01T00:00:00Z
+ */
+extern int64_t HLClockWallMicros(void);
+
+/**
+ * Gets the wall clock time at nanosecond precision. The actual resolution
+ * depends on the system.
+ *
+ * @return the nanoseconds from 1970-01-01T00:00:00Z
+ */
+extern int64_t HLClockWallNanos(void);
+
+/**
+ * Gets the coarse wall clock time.
+ *
+ * @return the milliseconds from 1970-01-01T00:00:00Z, as of the last tick
+ */
+extern int64_t HLClockCoarseMillis(void);
+
+/**
+ * Gets the monotonic clock time.
+ *
+ * @return nanoseconds from an arbitrary fixed point
+ */
+extern int64_t HLClockMonotonicNanos(void);
+
+/**
+ * Starts the ticker that refreshes the cached clock, or changes its
+ * interval if it is already running. The cached clock is current when
+ * this returns.
+ *
+ * @param tickMillis  the refresh interval in milliseconds, at least 1
+ * @throws IllegalArgumentException if the interval is less than 1
+ */
+extern void HLClockStartTicker(int64_t tickMillis);
+
+/**
+ * Stops the ticker that refreshes the cached clock. Afterwards the cached
+ * clock reads the coarse clock.
+ */
+extern void HLClockStopTicker(void);
+
+/**
+ * Gets the cached wall clock time.
+ *
+ * @return the milliseconds from 1970-01-01T00:00:00Z, as of the last tick
+ */
+static inline int64_t HLClockCachedMillis(void) {
+#if defined(__LP64__)
+    int64_t millis = HLClockTickerMillis;
+#else
+    // a plain 64-bit load may tear on 32-bit systems
+    int64_t millis = OSAtomicAdd64(0, &HLClockTickerMillis);
+#endif
+    if (__builtin_expect(millis == 0, 0)) {
+        return HLClockCoarseMillis();
+    }
+    return millis;
+}
+
+/**
+ * Gets the nanoseconds elapsed on the monotonic clock since an earlier
+ * reading of it.
+ *
+ * @param startNanos  an earlier result of HLClockMonotonicNanos
+ * @return the elapsed nanoseconds
+ */
+static inline int64_t HLClockElapsedNanos(int64_t startNanos) {
+    return HLClockMonotonicNanos() - startNanos;
+}
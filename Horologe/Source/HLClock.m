@@ -0,0 +1,191 @@
+/*
+ * Clock.m
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#import "HLClock.h"
+
+#import <pthread.h>
+#import <sys/time.h>
+#import <time.h>
+#if defined(__APPLE__)
+#import <mach/mach_time.h>
+#endif
+
+#import "HLConstants.h"
+
+
+volatile int64_t HLClockTickerMillis = 0;
+
+/*
+ * The ticker is a detached thread rather than a dispatch source, as GCD
+ * is not available on Mac OS X 10.5. Each start of the ticker bumps the
+ * generation, and a thread exits once the generation it was started for
+ * is no longer current. The interval and generation are guarded by
+ * sTickerLock.
+ */
+static int64_t sTickerInterval = HL_CLOCK_DEFAULT_TICK_MILLIS;
+static int32_t sTickerGeneration = 0;
+static BOOL sTickerRunning = NO;
+static pthread_mutex_t sTickerLock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Reads the realtime clock. On Apple systems this is gettimeofday, as
+ * clock_gettime only arrived with Mac OS X 10.12 and iOS 10.
+ */
+static inline void HLClockRead(struct timespec* ts) {
+#if defined(__APPLE__)
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    ts->tv_sec = tv.tv_sec;
+    ts->tv_nsec = tv.tv_usec * 1000;
+#else
+    clock_gettime(CLOCK_REALTIME, ts);
+#endif
+}
+
+int64_t HLClockWallMillis(void) {
+    struct timespec ts;
+    HLClockRead(&ts);
+    return (int64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+int64_t HLClockWallMicros(void) {
+    struct timespec ts;
+    HLClockRead(&ts);
+    return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int64_t HLClockWallNanos(void) {
+    struct timespec ts;
+    HLClockRead(&ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+int64_t HLClockCoarseMillis(void) {
+#if defined(CLOCK_REALTIME_COARSE) && !defined(__APPLE__)
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+    return (int64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#else
+    return HLClockWallMillis();
+#endif
+}
+
+int64_t HLClockMonotonicNanos(void) {
+#if defined(__APPLE__)
+    // mach_timebase_info always answers the same, so racing first callers
+    // at worst both fill it in
+    static volatile uint32_t timebaseNumer = 0;
+    static volatile uint32_t timebaseDenom = 0;
+    uint32_t denom = timebaseDenom;
+    if (__builtin_expect(denom == 0, 0)) {
+        mach_timebase_info_data_t info;
+        mach_timebase_info(&info);
+        timebaseNumer = info.numer;
+        // publish the numerator before the denominator that guards it
+        OSMemoryBarrier();
+        timebaseDenom = info.denom;
+        denom = info.denom;
+    } else {
+        // pairs with the barrier above, so the numerator read is not stale
+        OSMemoryBarrier();
+    }
+    uint32_t numer = timebaseNumer;
+    uint64_t ticks = mach_absolute_time();
+    if (numer == denom) {
+        return (int64_t) ticks;
+    }
+    // split the scaling so the multiply cannot overflow
+    return (int64_t) ((ticks / denom) * numer + (ticks % denom) * numer / denom);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+//-----------------------------------------------------------------------
+static void* HLClockTickerMain(void* arg) {
+    int32_t generation = (int32_t) (intptr_t) arg;
+    
+    for (;;) {
+        pthread_mutex_lock(&sTickerLock);
+        BOOL current = sTickerRunning && sTickerGeneration == generation;
+        int64_t interval = sTickerInterval;
+        pthread_mutex_unlock(&sTickerLock);
+        if (!current) {
+            break;
+        }
+        
+        struct timespec delay;
+        delay.tv_sec = (time_t) (interval / 1000);
+        delay.tv_nsec = (long) (interval % 1000) * 1000000;
+        nanosleep(&delay, NULL);
+        
+        // only replace a live value, so a tick racing with
+        // HLClockStopTicker cannot resurrect a stale one
+        int64_t previous = HLClockTickerMillis;
+        if (previous != 0) {
+            OSAtomicCompareAndSwap64Barrier(previous, HLClockWallMillis(), &HLClockTickerMillis);
+        }
+    }
+    return NULL;
+}
+
+void HLClockStartTicker(int64_t tickMillis) {
+    if (tickMillis < 1) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"The tick interval must be at least 1ms: %lld", (long long) tickMillis];
+    }
+    
+    pthread_mutex_lock(&sTickerLock);
+    OSAtomicCompareAndSwap64Barrier(HLClockTickerMillis, HLClockWallMillis(), &HLClockTickerMillis);
+    sTickerInterval = tickMillis;
+    if (!sTickerRunning) {
+        pthread_t thread;
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        sTickerGeneration++;
+        int failed = pthread_create(&thread, &attr, HLClockTickerMain, 
+                                    (void*) (intptr_t) sTickerGeneration);
+        pthread_attr_destroy(&attr);
+        if (failed) {
+            OSAtomicCompareAndSwap64Barrier(HLClockTickerMillis, 0, &HLClockTickerMillis);
+            pthread_mutex_unlock(&sTickerLock);
+            [NSException raise:NSInternalInconsistencyException
+                        format:@"The clock ticker thread could not be started: %d", failed];
+        }
+        sTickerRunning = YES;
+    }
+    pthread_mutex_unlock(&sTickerLock);
+}
+
+void HLClockStopTicker(void) {
+    pthread_mutex_lock(&sTickerLock);
+    // the thread sees this within one interval and exits
+    sTickerRunning = NO;
+    int64_t previous;
+    do {
+        previous = HLClockTickerMillis;
+    } while (!OSAtomicCompareAndSwap64Barrier(previous, 0, &HLClockTickerMillis));
+    pthread_mutex_unlock(&sTickerLock);
+}
@@ -12,6 +12,14 @@
 #define HL_UNIMPLEMENTED_EXCEPTION (@"HLUnimplemented")
 #define HL_OBJECT_MISMATCH_EXCEPTION (@"HLObjectMismatch")
 #define HL_INDEX_OUT_OF_BOUNDS_EXCEPTION (@"HLIndexOutOfBounds")
+#define HL_UNSUPPORTED_OPERATION_EXCEPTION (@"HLUnsupportedOperation")
 
 #define HL_INTERNAL_ERROR (@"HLInternalError")
 
+#define HL_ERROR_DOMAIN (@"HLErrorDomain")
+
+#define HL_ERROR_ILLEGAL_ARGUMENT (1)
+#define HL_ERROR_ARITHMETIC (2)
+#define HL_ERROR_ILLEGAL_FIELD_VALUE (3)
+#define HL_ERROR_PARSE (4)
+
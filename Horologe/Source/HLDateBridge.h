@@ -0,0 +1,195 @@
+/*
+ * DateBridge.h
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+#import <CoreFoundation/CoreFoundation.h>
+#import <float.h>
+
+
+@class HLInstant;
+
+/*
+ * Foundation date bridging
+ *
+ * Foundation counts time as fractional seconds, either from 2001-01-01
+ * (CFAbsoluteTime, and NSTimeInterval since the reference date) or from
+ * 1970-01-01 (NSTimeInterval since 1970). Horologe counts whole millis
+ * from 1970-01-01. These functions convert between the two directly,
+ * without going through ConverterManager and DateConverter.
+ *
+ * Seconds convert to millis by rounding down, so instants before the epoch
+ * land on the millisecond that contains them, as with HLFloorDivide. Few
+ * millis are an exact binary fraction of a second, so 1.001 seconds is
+ * held as slightly less. A value within a few ulps below a whole milli is
+ * therefore taken as that milli rather than rounded down past it.
+ * Millis convert to the nearest double number of seconds. Converting
+ * millis to seconds and back returns the same millis for any instant
+ * within 2^51 millis, about 70,000 years, of the epoch.
+ *
+ * The buffer functions are a single scale-and-offset pass with no calls or
+ * branches in the loop body, which the compiler vectorizes.
+ */
+
+/** The millis from 1970-01-01T00:00:00Z to 2001-01-01T00:00:00Z. */
+static const int64_t HLAbsoluteTimeEpochMillis = 978307200000LL;
+
+/** How many ulps below a whole milli a value of seconds may be and still convert to it. */
+#define HL_SECONDS_ROUNDING_ULPS (4.0)
+
+/**
+ * Converts seconds from an epoch to millis from 1970 as a double, rounding
+ * down except within HL_SECONDS_ROUNDING_ULPS below a whole milli. The
+ * selection has no branch, so buffer loops built on this still vectorize.
+ *
+ * @param seconds  the seconds
+ * @param epochMillis  the millis from 1970 of the epoch of the seconds
+ * @return the whole millis from 1970, which may be out of the range of int64_t
+ */
+static inline double HLWholeMillisFromSeconds(double seconds, int64_t epochMillis) {
+    const double offset = (double) epochMillis;
+    double product = seconds * 1000.0;
+    double scaled = product + offset;
+    double nearest = __builtin_floor(scaled + 0.5);
+    // both the multiply and the offset may have rounded
+    double slack = HL_SECONDS_ROUNDING_ULPS * DBL_EPSILON * (__builtin_fabs(product) + __builtin_fabs(offset));
+    return nearest - scaled <= slack ? nearest : __builtin_floor(scaled);
+}
+
+/**
+ * Converts seconds from an epoch to millis from 1970, rounding down.
+ *
+ * @param seconds  the seconds, must be finite and in the range of millis
+ * @param epochMillis  the millis from 1970 of the epoch of the seconds
+ * @return the millis from 1970
+ */
+static inline int64_t HLMillisFromSeconds(double seconds, int64_t epochMillis) {
+    return (int64_t) HLWholeMillisFromSeconds(seconds, epochMillis);
+}
+
+/**
+ * Converts millis from 1970 to seconds from an epoch, to the nearest double.
+ */
+static inline double HLSecondsFromMillis(int64_t millis, int64_t epochMillis) {
+    return ((double) millis - (double) epochMillis) / 1000.0;
+}
+
+static inline int64_t HLMillisFromAbsoluteTime(CFAbsoluteTime time) {
+    return HLMillisFromSeconds(time, HLAbsoluteTimeEpochMillis);
+}
+
+static inline CFAbsoluteTime HLAbsoluteTimeFromMillis(int64_t millis) {
+    return HLSecondsFromMillis(millis, HLAbsoluteTimeEpochMillis);
+}
+
+static inline int64_t HLMillisFromTimeIntervalSince1970(NSTimeInterval interval) {
+    return HLMillisFromSeconds(interval, 0);
+}
+
+static inline NSTimeInterval HLTimeIntervalSince1970FromMillis(int64_t millis) {
+    return HLSecondsFromMillis(millis, 0);
+}
+
+//-----------------------------------------------------------------------
+/**
+ * Converts a buffer of CFAbsoluteTime, or NSTimeInterval since the
+ * reference date, to millis.
+ *
+ * @param times  the times to convert
+ * @param millis  receives count millis, may not overlap times
+ * @param count  the number of times
+ * @throws ArithmeticException if a time is not finite or out of range
+ */
+extern void HLMillisFromAbsoluteTimes(const CFAbsoluteTime* times, int64_t* millis, NSUInteger count);
+
+/**
+ * Converts a buffer of millis to CFAbsoluteTime, which is also the
+ * NSTimeInterval since the reference date.
+ *
+ * @param millis  the millis to convert
+ * @param times  receives count times, may not overlap millis
+ * @param count  the number of millis
+ */
+extern void HLAbsoluteTimesFromMillis(const int64_t* millis, CFAbsoluteTime* times, NSUInteger count);
+
+/**
+ * Converts a buffer of NSTimeInterval since 1970 to millis.
+ *
+ * @param intervals  the intervals to convert
+ * @param millis  receives count millis, may not overlap intervals
+ * @param count  the number of intervals
+ * @throws ArithmeticException if an interval is not finite or out of range
+ */
+extern void HLMillisFromTimeIntervalsSince1970(const NSTimeInterval* intervals, int64_t* millis, NSUInteger count);
+
+/**
+ * Converts a buffer of millis to NSTimeInterval since 1970.
+ *
+ * @param millis  the millis to convert
+ * @param intervals  receives count intervals, may not overlap millis
+ * @param count  the number of millis
+ */
+extern void HLTimeIntervalsSince1970FromMillis(const int64_t* millis, NSTimeInterval* intervals, NSUInteger count);
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the millis of a date without allocating.
+ *
+ * @param date  the date, not nil
+ * @return the millis from 1970, rounded down
+ */
+extern int64_t HLMillisFromDate(NSDate* date);
+
+/**
+ * Creates a date from millis.
+ *
+ * @param millis  the millis from 1970
+ * @return the autoreleased date
+ */
+extern NSDate* HLDateFromMillis(int64_t millis);
+
+/**
+ * Creates an instant from a date directly, rather than through
+ * ConverterManager as [HLInstant initWithInstant:] does. The only
+ * allocation is the instant itself.
+ *
+ * @param date  the date, nil means now
+ * @return the autoreleased instant
+ */
+extern HLInstant* HLInstantFromDate(NSDate* date);
+
+/**
+ * Gets the millis of an array of dates. The time getter is looked up once
+ * per class rather than sent to each date.
+ *
+ * @param dates  the NSDates
+ * @param millis  receives [dates count] millis
+ * @throws ArithmeticException if a date is out of range
+ */
+extern void HLMillisFromDateArray(NSArray* dates, int64_t* millis);
+
+/**
+ * Creates an array of dates from millis.
+ *
+ * @param millis  the millis to convert
+ * @param count  the number of millis
+ * @return the autoreleased array of NSDates
+ */
+extern NSArray* HLDateArrayFromMillis(const int64_t* millis, NSUInteger count);
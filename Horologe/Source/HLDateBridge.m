@@ -0,0 +1,167 @@
+/*
+ * DateBridge.m
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "HLDateBridge.h"
+
+#import "HLConstants.h"
+#import "HLDateTimeUtils.h"
+#import "HLInstant.h"
+
+
+/** Millis at or beyond these bounds do not fit in int64_t */
+static const double HLMillisLowerLimit = -9223372036854775808.0;
+static const double HLMillisUpperLimit = 9223372036854775808.0;
+
+/*
+ * Converts seconds to millis, clearing ok when any value is not finite or
+ * out of range. Bad values are zeroed before the cast, which is undefined
+ * for them, and reported by the caller once the pass is done.
+ */
+static BOOL HLMillisFromSecondsBuffer(const double* restrict seconds, int64_t* restrict millis,
+                                      NSUInteger count, int64_t epochMillis) {
+    int valid = 1;
+    for(NSUInteger i = 0; i < count; i++) {
+        double value = HLWholeMillisFromSeconds(seconds[i], epochMillis);
+        int inRange = value >= HLMillisLowerLimit && value < HLMillisUpperLimit;
+        valid &= inRange;
+        millis[i] = (int64_t) (inRange ? value : 0.0);
+    }
+    return valid != 0;
+}
+
+static void HLSecondsFromMillisBuffer(const int64_t* restrict millis, double* restrict seconds,
+                                      NSUInteger count, int64_t epochMillis) {
+    const double offset = (double) epochMillis;
+    for(NSUInteger i = 0; i < count; i++) {
+        seconds[i] = ((double) millis[i] - offset) / 1000.0;
+    }
+}
+
+static NSUInteger HLSecondsOutOfRangeIndex(const double* seconds, NSUInteger count, int64_t epochMillis) {
+    for(NSUInteger i = 0; i < count; i++) {
+        double value = HLWholeMillisFromSeconds(seconds[i], epochMillis);
+        if (!(value >= HLMillisLowerLimit && value < HLMillisUpperLimit)) {
+            return i;
+        }
+    }
+    return count;
+}
+
+static void HLRaiseSecondsOutOfRange(const double* seconds, NSUInteger count, int64_t epochMillis) {
+    NSUInteger index = HLSecondsOutOfRangeIndex(seconds, count, epochMillis);
+    [NSException raise:HL_ARITHMETIC_EXCEPTION
+                format:@"Time at index %lu cannot be represented in millis: %f",
+     (unsigned long) index, seconds[index]];
+}
+
+//-----------------------------------------------------------------------
+void HLMillisFromAbsoluteTimes(const CFAbsoluteTime* times, int64_t* millis, NSUInteger count) {
+    if (!HLMillisFromSecondsBuffer(times, millis, count, HLAbsoluteTimeEpochMillis)) {
+        HLRaiseSecondsOutOfRange(times, count, HLAbsoluteTimeEpochMillis);
+    }
+}
+
+void HLAbsoluteTimesFromMillis(const int64_t* millis, CFAbsoluteTime* times, NSUInteger count) {
+    HLSecondsFromMillisBuffer(millis, times, count, HLAbsoluteTimeEpochMillis);
+}
+
+void HLMillisFromTimeIntervalsSince1970(const NSTimeInterval* intervals, int64_t* millis, NSUInteger count) {
+    if (!HLMillisFromSecondsBuffer(intervals, millis, count, 0)) {
+        HLRaiseSecondsOutOfRange(intervals, count, 0);
+    }
+}
+
+void HLTimeIntervalsSince1970FromMillis(const int64_t* millis, NSTimeInterval* intervals, NSUInteger count) {
+    HLSecondsFromMillisBuffer(millis, intervals, count, 0);
+}
+
+//-----------------------------------------------------------------------
+int64_t HLMillisFromDate(NSDate* date) {
+    int64_t millis;
+    CFAbsoluteTime time = [date timeIntervalSinceReferenceDate];
+    if (!HLMillisFromSecondsBuffer(&time, &millis, 1, HLAbsoluteTimeEpochMillis)) {
+        HLRaiseSecondsOutOfRange(&time, 1, HLAbsoluteTimeEpochMillis);
+    }
+    return millis;
+}
+
+NSDate* HLDateFromMillis(int64_t millis) {
+    return [NSDate dateWithTimeIntervalSinceReferenceDate:HLAbsoluteTimeFromMillis(millis)];
+}
+
+HLInstant* HLInstantFromDate(NSDate* date) {
+    int64_t millis = date == nil ? HLCurrentTimeMillis() : HLMillisFromDate(date);
+    return [[[HLInstant alloc] initWithInstantValue:millis] autorelease];
+}
+
+void HLMillisFromDateArray(NSArray* dates, int64_t* millis) {
+    NSUInteger count = [dates count];
+    if (count == 0) {
+        return;
+    }
+    CFAbsoluteTime* times = malloc(count * sizeof(CFAbsoluteTime));
+    @try {
+        // look the getter up once per class rather than dispatching per date,
+        // which raises for an element that is not a date
+        SEL selector = @selector(timeIntervalSinceReferenceDate);
+        Class lastClass = Nil;
+        CFAbsoluteTime (*getter)(id, SEL) = NULL;
+        NSUInteger i = 0;
+        for (NSDate* date in dates) {
+            Class dateClass = [date class];
+            if (dateClass != lastClass) {
+                getter = (CFAbsoluteTime (*)(id, SEL)) [date methodForSelector:selector];
+                lastClass = dateClass;
+            }
+            times[i++] = getter(date, selector);
+        }
+
+        if (!HLMillisFromSecondsBuffer(times, millis, count, HLAbsoluteTimeEpochMillis)) {
+            NSUInteger index = HLSecondsOutOfRangeIndex(times, count, HLAbsoluteTimeEpochMillis);
+            [NSException raise:HL_ARITHMETIC_EXCEPTION
+                        format:@"Date at index %lu cannot be represented in millis: %@",
+             (unsigned long) index, [dates objectAtIndex:index]];
+        }
+    }
+    @finally {
+        free(times);
+    }
+}
+
+NSArray* HLDateArrayFromMillis(const int64_t* millis, NSUInteger count) {
+    if (count == 0) {
+        return [NSArray array];
+    }
+    CFAbsoluteTime* times = malloc(count * sizeof(CFAbsoluteTime));
+    HLSecondsFromMillisBuffer(millis, times, count, HLAbsoluteTimeEpochMillis);
+
+    id* dates = malloc(count * sizeof(id));
+    for(NSUInteger i = 0; i < count; i++) {
+        dates[i] = [[NSDate alloc] initWithTimeIntervalSinceReferenceDate:times[i]];
+    }
+    NSArray* result = [NSArray arrayWithObjects:dates count:count];
+    for(NSUInteger i = 0; i < count; i++) {
+        [dates[i] release];
+    }
+    free(dates);
+    free(times);
+    return result;
+}
@@ -112,7 +112,7 @@
  *
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  */
-- (id)initWithInstantValue:(NSInteger)instant;
+- (id)initWithInstantValue:(int64_t)instant;
 
 /**
  * Constructs an instance set to the milliseconds from 1970-01-01T00:00:00Z
@@ -124,7 +124,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param zone  the time zone, nil means default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant
+- (id)initWithInstantValue:(int64_t)instant
               dateTimeZone:(HLDateTimeZone*)zone;
 
 /**
@@ -138,7 +138,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param chronology  the chronology, nil means ISOChronology in default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant
+- (id)initWithInstantValue:(int64_t)instant
                 chronology:(HLChronology*)chronology;
 
 //-----------------------------------------------------------------------
@@ -262,7 +262,7 @@
  * @param chronology  the chronology to use, not nil
  * @return the updated instant, rounded to midnight
  */
-- (long)checkInstant:(NSInteger)instant
+- (long)checkInstant:(int64_t)instant
           chronology:(HLChronology*)chronology;
 
 //-----------------------------------------------------------------------
@@ -276,7 +276,7 @@
  * @param newMillis  the new millis, from 1970-01-01T00:00:00Z
  * @return a copy of this instant with different millis
  */
-- (HLDateMidnight*)withMillis:(NSInteger)newMillis;
+- (HLDateMidnight*)withMillis:(int64_t)newMillis;
 
 /**
  * Returns a copy of this date with a different chronology, potentially
@@ -380,7 +380,7 @@
  * @return a copy of this datetime with the duration added
  * @throws ArithmeticException if the new datetime exceeds the capacity of a long
  */
-- (HLDateMidnight*)withDurationAdded:(NSInteger)durationToAdd 
+- (HLDateMidnight*)withDurationAdded:(int64_t)durationToAdd 
                          usingScalar:(NSInteger)scalar;
 
 /**
@@ -424,7 +424,7 @@
  * @return a copy of this datetime with the duration added
  * @throws ArithmeticException if the new datetime exceeds the capacity of a long
  */
-- (HLDateMidnight*)plusDurationValue:(NSInteger)duration;
+- (HLDateMidnight*)plusDurationValue:(int64_t)duration;
 
 /**
  * Returns a copy of this date with the specified duration added.
@@ -535,7 +535,7 @@
  * @return a copy of this datetime with the duration taken away
  * @throws ArithmeticException if the new datetime exceeds the capacity of a long
  */
-- (HLDateMidnight*)minusDurationValue:(NSInteger)duration;
+- (HLDateMidnight*)minusDurationValue:(int64_t)duration;
 
 /**
  * Returns a copy of this date with the specified duration taken away.
@@ -974,7 +974,7 @@
  * 
  * @return the milliseconds
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 /**
  * Gets the chronology of the datetime that this property is linked to.
@@ -102,7 +102,7 @@
  *
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  */
-- (id)initWithInstantValue:(NSInteger)instant;
+- (id)initWithInstantValue:(int64_t)instant;
 
 /**
  * Constructs an instance set to the milliseconds from 1970-01-01T00:00:00Z
@@ -113,7 +113,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param zone  the time zone, nil means default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant 
+- (id)initWithInstantValue:(int64_t)instant 
                       zone:(HLDateTimeZone*)zone;
 
 /**
@@ -126,7 +126,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param chronology  the chronology, nil means ISOChronology in default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant 
+- (id)initWithInstantValue:(int64_t)instant 
                 chronology:(HLChronology*)chronology;
 
 //-----------------------------------------------------------------------
@@ -303,7 +303,7 @@
  * @param newMillis  the new millis, from 1970-01-01T00:00:00Z
  * @return a copy of this datetime with different millis
  */
-- (HLDateTime*)withMillis:(NSInteger)newMillis;
+- (HLDateTime*)withMillis:(int64_t)newMillis;
 
 /**
  * Returns a copy of this datetime with a different chronology.
@@ -467,7 +467,7 @@
  * @return a copy of this datetime with the duration added
  * @throws ArithmeticException if the new datetime exceeds the capacity of a long
  */
-- (HLDateTime*)withDurationAdded:(NSInteger)durationToAdd 
+- (HLDateTime*)withDurationAdded:(int64_t)durationToAdd 
                      usingScalar:(NSInteger)scalar;
 
 /**
@@ -512,7 +512,7 @@
  * @return a copy of this datetime with the duration added
  * @throws ArithmeticException if the new datetime exceeds the capacity of a long
  */
-- (HLDateTime*)plusDurationValue:(NSInteger)duration;
+- (HLDateTime*)plusDurationValue:(int64_t)duration;
 
 /**
  * Returns a copy of this datetime with the specified duration added.
@@ -733,7 +733,7 @@
  * @return the new datetime plus the increased millis
  * @since 1.1
  */
-- (HLDateTime*)plusMillis:(NSInteger)millis;
+- (HLDateTime*)plusMillis:(int64_t)millis;
 
 //-----------------------------------------------------------------------
 /**
@@ -746,7 +746,7 @@
  * @return a copy of this datetime with the duration taken away
  * @throws ArithmeticException if the new datetime exceeds the capacity of a long
  */
-- (HLDateTime*)minusDurationValue:(NSInteger)duration;
+- (HLDateTime*)minusDurationValue:(int64_t)duration;
 
 /**
  * Returns a copy of this datetime with the specified duration taken away.
@@ -970,7 +970,7 @@
  * @return the new datetime minus the increased millis
  * @since 1.1
  */
-- (HLDateTime*)minusMillis:(NSInteger)millis;
+- (HLDateTime*)minusMillis:(int64_t)millis;
 
 //-----------------------------------------------------------------------
 /**
@@ -1246,7 +1246,7 @@
  * @throws IllegalArgumentException if the value is invalid
  * @since 1.3
  */
-- (HLDateTime*)withMillisOfSecond:(NSInteger)millis;
+- (HLDateTime*)withMillisOfSecond:(int64_t)millis;
 
 /**
  * Returns a copy of this datetime with the millis of day field updated.
@@ -1260,7 +1260,7 @@
  * @throws IllegalArgumentException if the value is invalid
  * @since 1.3
  */
-- (HLDateTime*)withMillisOfDay:(NSInteger)millis;
+- (HLDateTime*)withMillisOfDay:(int64_t)millis;
 
 // Date properties
 //-----------------------------------------------------------------------
@@ -1457,7 +1457,7 @@
  * 
  * @return the milliseconds
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 /**
  * Gets the chronology of the datetime that this property is linked to.
@@ -21,6 +21,8 @@
 
 #import <Foundation/Foundation.h>
 
+#import "HLInstantValue.h"
+
 
 @class HLDateTimeFieldType;
 
@@ -144,6 +146,58 @@
 - (NSComparisonResult)compareLeftSide:(id)lhsObj
                           toRightSide:(id)rhsObj;
 
+/**
+ * Compare two nano instants against only the range of date time fields as
+ * specified in the constructor. Each instant's fields are taken from its
+ * own chronology. The nanosecond of millisecond only takes part when there
+ * is no lower limit.
+ * 
+ * @param lhs  the first instant, logically on the left of a &lt; comparison
+ * @param rhs  the second instant, logically on the right of a &lt; comparison
+ * @return the ordering of the instants within the compared fields
+ */
+- (NSComparisonResult)compareNanoInstant:(HLNanoInstant)lhs
+                           toNanoInstant:(HLNanoInstant)rhs;
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the sort key of an object, such that comparing the keys of two
+ * objects as integers orders them as compareLeftSide:toRightSide: does.
+ * <p>
+ * The key is the instant millis of the object with the lower limit rounded
+ * away and the upper limit taken as a remainder, in the object's own
+ * chronology. Computing keys once and comparing them avoids the converter
+ * lookup and field rounding that each comparison repeats.
+ * 
+ * @param object  the object, nil means now
+ * @return the sort key
+ * @throws IllegalArgumentException if the object is not supported
+ */
+- (int64_t)sortKeyForObject:(id)object;
+
+/**
+ * Gets the sort keys of an array of objects. Consecutive objects of the
+ * same class share a converter lookup, and of the same chronology share
+ * the limit fields, so this is cheaper than a key per call.
+ * 
+ * @param objects  the objects, not nil, where NSNull means now
+ * @param keys  receives a key for each object, not NULL
+ * @throws IllegalArgumentException if an object is not supported
+ */
+- (void)sortKeysForObjects:(NSArray*)objects
+                intoBuffer:(int64_t*)keys;
+
+/**
+ * Sorts an array of objects by the fields of this comparator, computing
+ * the key of each object once and radix sorting the keys. The sort is
+ * stable, so objects that compare equal keep their order.
+ * 
+ * @param objects  the objects to sort, not nil, where NSNull means now
+ * @return a new sorted array
+ * @throws IllegalArgumentException if an object is not supported
+ */
+- (NSArray*)sortArray:(NSArray*)objects;
+
 //-----------------------------------------------------------------------
 /**
  * Compares this comparator to another.
@@ -21,9 +21,132 @@
 
 #import "HLDateTimeComparator.h"
 
+#import "HLChronology.h"
+#import "HLConverterManager.h"
+#import "HLDateTimeField.h"
+#import "HLDateTimeFieldType.h"
+#import "HLInstantConverter.h"
+#import "HLInstantSort.h"
+
 
 @implementation HLDateTimeComparator
 
+//-----------------------------------------------------------------------
+- (NSComparisonResult)compareNanoInstant:(HLNanoInstant)lhs
+                           toNanoInstant:(HLNanoInstant)rhs {
+    int64_t lhsMillis = lhs.millis;
+    int64_t rhsMillis = rhs.millis;
+    int32_t lhsNanos = lhs.nanoOfMilli;
+    int32_t rhsNanos = rhs.nanoOfMilli;
+
+    if (_iLowerLimit != nil) {
+        lhsMillis = [[_iLowerLimit field:HLChronologyForIdentifier(lhs.chronoId)] roundFloor:lhsMillis];
+        rhsMillis = [[_iLowerLimit field:HLChronologyForIdentifier(rhs.chronoId)] roundFloor:rhsMillis];
+        // every field is at least a millisecond, so the nanos round away
+        lhsNanos = rhsNanos = 0;
+    }
+
+    if (_iUpperLimit != nil) {
+        lhsMillis = [[_iUpperLimit field:HLChronologyForIdentifier(lhs.chronoId)] remainder:lhsMillis];
+        rhsMillis = [[_iUpperLimit field:HLChronologyForIdentifier(rhs.chronoId)] remainder:rhsMillis];
+    }
+
+    return HLNanoInstantCompare(HLNanoInstantMake(lhsMillis, lhsNanos, lhs.chronoId),
+                                HLNanoInstantMake(rhsMillis, rhsNanos, rhs.chronoId));
+}
+
+//-----------------------------------------------------------------------
+- (int64_t)sortKeyForObject:(id)object {
+    id<HLInstantConverter> converter = [[HLConverterManager instance] instantConverter:object];
+    HLChronology* chrono = [converter chronologyFromInstant:object
+                                                 chronology:nil];
+    int64_t millis = [converter instantMillisFromInstant:object
+                                              chronology:chrono];
+    if (_iLowerLimit != nil) {
+        millis = [[_iLowerLimit field:chrono] roundFloor:millis];
+    }
+    if (_iUpperLimit != nil) {
+        millis = [[_iUpperLimit field:chrono] remainder:millis];
+    }
+    return millis;
+}
+
+- (void)sortKeysForObjects:(NSArray*)objects
+                intoBuffer:(int64_t*)keys {
+    HLConverterManager* manager = [HLConverterManager instance];
+    Class lastClass = Nil;
+    id<HLInstantConverter> converter = nil;
+    HLChronology* lastChrono = nil;
+    HLDateTimeField* lowerField = nil;
+    HLDateTimeField* upperField = nil;
+    
+    NSUInteger i = 0;
+    for (id object in objects) {
+        if (object == [NSNull null]) {
+            // stands for nil, which is now
+            object = nil;
+        }
+        if (converter == nil || [object class] != lastClass) {
+            converter = [manager instantConverter:object];
+            lastClass = [object class];
+        }
+        HLChronology* chrono = [converter chronologyFromInstant:object
+                                                     chronology:nil];
+        int64_t millis = [converter instantMillisFromInstant:object
+                                                  chronology:chrono];
+        if (chrono != lastChrono) {
+            lowerField = [_iLowerLimit field:chrono];
+            upperField = [_iUpperLimit field:chrono];
+            lastChrono = chrono;
+        }
+        if (lowerField != nil) {
+            millis = [lowerField roundFloor:millis];
+        }
+        if (upperField != nil) {
+            millis = [upperField remainder:millis];
+        }
+        keys[i++] = millis;
+    }
+}
+
+- (NSArray*)sortArray:(NSArray*)objects {
+    NSUInteger count = [objects count];
+    if (count < 2) {
+        return [NSArray arrayWithArray:objects];
+    }
+    
+    int64_t* keys = malloc(count * sizeof(int64_t));
+    NSUInteger* permutation = NULL;
+    id* sorted = NULL;
+    NSArray* result = nil;
+    @try {
+        // the keys are the only step that can raise
+        [self sortKeysForObjects:objects
+                      intoBuffer:keys];
+        
+        permutation = malloc(count * sizeof(NSUInteger));
+        HLInstantSortPermutation(keys, count, permutation);
+        
+        sorted = malloc(count * sizeof(id));
+        for(NSUInteger i = 0; i < count; i++) {
+            sorted[i] = [objects objectAtIndex:permutation[i]];
+        }
+        result = [NSArray arrayWithObjects:sorted
+                                     count:count];
+    }
+    @finally {
+        free(keys);
+        free(permutation);
+        free(sorted);
+    }
+    return result;
+}
+
+@end
+
+
+@implementation DateTimeComparator
+
 /*
  *  Copyright 2001-2005 Stephen Colebourne
  *
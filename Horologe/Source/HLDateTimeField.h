@@ -21,6 +21,8 @@
 
 #import <Foundation/Foundation.h>
 
+#import "HLFieldKernel.h"
+
 
 @class HLDateTimeFieldType;
 @protocol HLReadablePartial;
@@ -87,7 +89,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to query
  * @return the value of the field, in the units of the field
  */
-- (NSInteger)valueWithMillis:(NSInteger)instant;
+- (NSInteger)valueWithMillis:(int64_t)instant;
 
 /**
  * Get the human-readable, text value of this field from the milliseconds.
@@ -97,7 +99,7 @@
  * @param locale the locale to use for selecting a text symbol, nil for default
  * @return the text value of the field
  */
-- (NSString*)valueAsTextWithInstantValue:(NSInteger)instant 
+- (NSString*)valueAsTextWithInstantValue:(int64_t)instant 
                   locale:(NSLocale*)locale;
 
 /**
@@ -106,7 +108,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to query
  * @return the text value of the field
  */
-- (NSString*)valueAsTextWithInstantValue:(NSInteger)instant;
+- (NSString*)valueAsTextWithInstantValue:(int64_t)instant;
 
 /**
  * Get the human-readable, text value of this field from a partial instant.
@@ -151,7 +153,7 @@
  * @param locale the locale to use for selecting a text symbol, nil for default
  * @return the short text value of the field
  */
-- (NSString*)valueAsShortTextWithInstantValue:(NSInteger)instant
+- (NSString*)valueAsShortTextWithInstantValue:(int64_t)instant
                        locale:(NSLocale*)locale;
 
 /**
@@ -161,7 +163,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to query
  * @return the short text value of the field
  */
-- (NSString*)valueAsShortTextWithInstantValue:(NSInteger)instant;
+- (NSString*)valueAsShortTextWithInstantValue:(int64_t)instant;
 
 /**
  * Get the human-readable, short text value of this field from a partial instant.
@@ -219,8 +221,8 @@
  * @param value  the value to add, in the units of the field
  * @return the updated milliseconds
  */
-- (NSInteger)addValue:(NSInteger)value
-       toInstantValue:(NSInteger)instant;
+- (int64_t)addValue:(NSInteger)value
+     toInstantValue:(int64_t)instant;
 
 /**
  * Adds a value (which may be negative) to the partial instant,
@@ -307,8 +309,8 @@
  * @param value  the value to add, in the units of the field
  * @return the updated milliseconds
  */
-- (NSInteger)addWrapField:(NSInteger)instant 
-                    value:(NSInteger)value;
+- (int64_t)addWrapField:(int64_t)instant 
+                  value:(NSInteger)value;
 
 /**
  * Adds a value (which may be negative) to the partial instant,
@@ -358,8 +360,8 @@
  * subtract off the minuend
  * @return the difference in the units of this field
  */
-- (NSInteger)differenceWithMinuend:(NSInteger)minuendInstant
-                        subtrahend:(NSInteger)subtrahendInstant;
+- (NSInteger)differenceWithMinuend:(int64_t)minuendInstant
+                        subtrahend:(int64_t)subtrahendInstant;
 
 /**
  * Sets a value in the milliseconds supplied.
@@ -377,8 +379,27 @@
  * @return the updated milliseconds
  * @throws IllegalArgumentException if the value is invalid
  */
-- (NSInteger)set:(NSInteger)instant 
-           value:(NSInteger)value;
+- (int64_t)set:(int64_t)instant 
+         value:(NSInteger)value;
+
+/**
+ * Sets a value in the milliseconds supplied, reporting an invalid value
+ * through an error rather than an exception.
+ * <p>
+ * The value is checked against the minimum and maximum of this field at
+ * the given instant before it is set, unless the field is lenient.
+ * 
+ * @param instant  the milliseconds from 1970-01-01T00:00:00Z to set in
+ * @param value  the value to set, in the units of the field
+ * @param result  receives the updated milliseconds on success, not NULL
+ * @param error  receives an HL_ERROR_ILLEGAL_FIELD_VALUE error if the value
+ *  is invalid, may be NULL
+ * @return YES if the value was set
+ */
+- (BOOL)trySet:(int64_t)instant 
+         value:(NSInteger)value
+        result:(int64_t*)result
+         error:(NSError**)error;
 
 /**
  * Sets a value using the specified partial instant.
@@ -418,9 +439,9 @@
  * @return the updated milliseconds
  * @throws IllegalArgumentException if the text value is invalid
  */
-- (NSInteger)set:(NSInteger)instant
-            text:(NSString*)text
-          locale:(NSLocale*)locale;
+- (int64_t)set:(int64_t)instant
+          text:(NSString*)text
+        locale:(NSLocale*)locale;
 
 /**
  * Sets a value in the milliseconds supplied from a human-readable, text value.
@@ -435,8 +456,8 @@
  * @return the updated milliseconds
  * @throws IllegalArgumentException if the text value is invalid
  */
-- (NSInteger)set:(NSInteger)instant
-            text:(NSString*)text;
+- (int64_t)set:(int64_t)instant
+          text:(NSString*)text;
 
 /**
  * Sets a value in the milliseconds supplied from a human-readable, text value.
@@ -489,7 +510,7 @@
  * @param instant  the instant to check for leap status
  * @return true if the field is 'leap'
  */
-- (BOOL)isLeap:(NSInteger)instant;
+- (BOOL)isLeap:(int64_t)instant;
 
 /**
  * Gets the amount by which this field is 'leap' for the specified instant.
@@ -500,7 +521,7 @@
  * @param instant  the instant to check for leap status
  * @return the amount, in units of the leap duration field, that the field is leap
  */
-- (NSInteger)leapAmount:(NSInteger)instant;
+- (NSInteger)leapAmount:(int64_t)instant;
 
 /**
  * If this field were to leap, then it would be in units described by the
@@ -524,7 +545,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to query
  * @return the minimum value for this field, in the units of the field
  */
-- (NSInteger)minimumValue:(NSInteger)instant;
+- (NSInteger)minimumValue:(int64_t)instant;
 
 /**
  * Get the minimum value for this field evaluated at the specified time.
@@ -559,7 +580,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to query
  * @return the maximum value for this field, in the units of the field
  */
-- (NSInteger)maximumValue:(NSInteger)instant;
+- (NSInteger)maximumValue:(int64_t)instant;
 
 /**
  * Get the maximum value for this field evaluated at the specified time.
@@ -610,7 +631,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to round
  * @return rounded milliseconds
  */
-- (NSInteger)roundFloor:(NSInteger)instant;
+- (int64_t)roundFloor:(int64_t)instant;
 
 /**
  * Round to the highest whole unit of this field. The value of this field
@@ -624,7 +645,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to round
  * @return rounded milliseconds
  */
-- (NSInteger)roundCeiling:(NSInteger)instant;
+- (int64_t)roundCeiling:(int64_t)instant;
 
 /**
  * Round to the nearest whole unit of this field. If the given millisecond
@@ -635,7 +656,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to round
  * @return rounded milliseconds
  */
-- (NSInteger)roundHalfFloor:(NSInteger)instant;
+- (int64_t)roundHalfFloor:(int64_t)instant;
 
 /**
  * Round to the nearest whole unit of this field. If the given millisecond
@@ -646,7 +667,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to round
  * @return rounded milliseconds
  */
-- (NSInteger)roundHalfCeiling:(NSInteger)instant;
+- (int64_t)roundHalfCeiling:(int64_t)instant;
 
 /**
  * Round to the nearest whole unit of this field. If the given millisecond
@@ -661,7 +682,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z to round
  * @return rounded milliseconds
  */
-- (NSInteger)roundHalfEven:(NSInteger)instant;
+- (int64_t)roundHalfEven:(int64_t)instant;
 
 /**
  * Returns the fractional duration milliseconds of this field. In other
@@ -675,6 +696,18 @@
  * remainder
  * @return remainder duration, in milliseconds
  */
-- (NSInteger)remainder:(NSInteger)instant;
+- (int64_t)remainder:(int64_t)instant;
+
+// Kernel API
+//------------------------------------------------------------------------
+/**
+ * Describes this field as a kernel of C functions. The default fills in
+ * the implementations of this field's own methods; decorators that only
+ * adjust values may instead resolve their wrapped field and record the
+ * adjustment. Use HLFieldKernelResolve rather than calling this directly.
+ *
+ * @param kernel  the zeroed kernel to fill in, not NULL
+ */
+- (void)resolveKernel:(HLFieldKernel*)kernel;
 
 @end
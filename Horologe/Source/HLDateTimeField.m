@@ -21,9 +21,45 @@
 
 #import "HLDateTimeField.h"
 
+#import "HLFieldUtils.h"
+
 
 @implementation HLDateTimeField
 
+//-----------------------------------------------------------------------
+- (BOOL)trySet:(int64_t)instant 
+         value:(NSInteger)value
+        result:(int64_t*)result
+         error:(NSError**)error {
+    if (![self isLenient] &&
+        ![HLFieldUtils tryVerifyValueBoundsOfField:self
+                                             value:value
+                                        lowerBound:[self minimumValue:instant]
+                                        upperBound:[self maximumValue:instant]
+                                             error:error]) {
+        return NO;
+    }
+    *result = [self set:instant value:value];
+    return YES;
+}
+
+// Kernel API
+//------------------------------------------------------------------------
+- (void)resolveKernel:(HLFieldKernel*)kernel {
+    kernel->field = self;
+    kernel->target = self;
+    kernel->get = (HLFieldGetFunction) [self methodForSelector:@selector(valueWithMillis:)];
+    kernel->set = (HLFieldSetFunction) [self methodForSelector:@selector(set:value:)];
+    kernel->add = (HLFieldAddFunction) [self methodForSelector:@selector(addValue:toInstantValue:)];
+    kernel->roundFloor = (HLFieldRoundFunction) [self methodForSelector:@selector(roundFloor:)];
+    kernel->offset = 0;
+}
+
+@end
+
+
+@implementation DateTimeField
+
     /**
      * Get the type of the field.
      * 
@@ -323,6 +323,13 @@ typedef enum _HLStandardFieldType {
           unitType:(HLDurationFieldType*)unitType
          rangeType:(HLDurationFieldType*)rangeType;
 
+/**
+ * Get the ordinal of this standard field type.
+ * 
+ * @return the HLStandardFieldType value of this type
+ */
+- (NSInteger)ordinal;
+
 /** @inheritdoc */
 - (HLDurationFieldType*)durationType;
 
@@ -29,8 +29,132 @@
 #import "HLDateTimeUtils.h"
 
 
+static HLStandardDateTimeFieldType* MILLIS_OF_SECOND_TYPE = nil;
+static HLStandardDateTimeFieldType* MILLIS_OF_DAY_TYPE = nil;
+static HLStandardDateTimeFieldType* SECOND_OF_MINUTE_TYPE = nil;
+static HLStandardDateTimeFieldType* SECOND_OF_DAY_TYPE = nil;
+static HLStandardDateTimeFieldType* MINUTE_OF_HOUR_TYPE = nil;
+static HLStandardDateTimeFieldType* MINUTE_OF_DAY_TYPE = nil;
+static HLStandardDateTimeFieldType* HOUR_OF_DAY_TYPE = nil;
+static HLStandardDateTimeFieldType* CLOCKHOUR_OF_DAY_TYPE = nil;
+static HLStandardDateTimeFieldType* HOUR_OF_HALFDAY_TYPE = nil;
+static HLStandardDateTimeFieldType* CLOCKHOUR_OF_HALFDAY_TYPE = nil;
+static HLStandardDateTimeFieldType* HALFDAY_OF_DAY_TYPE = nil;
+static HLStandardDateTimeFieldType* DAY_OF_WEEK_TYPE = nil;
+static HLStandardDateTimeFieldType* DAY_OF_MONTH_TYPE = nil;
+static HLStandardDateTimeFieldType* DAY_OF_YEAR_TYPE = nil;
+static HLStandardDateTimeFieldType* WEEK_OF_WEEKYEAR_TYPE = nil;
+static HLStandardDateTimeFieldType* WEEKYEAR_TYPE = nil;
+static HLStandardDateTimeFieldType* WEEKYEAR_OF_CENTURY_TYPE = nil;
+static HLStandardDateTimeFieldType* MONTH_OF_YEAR_TYPE = nil;
+static HLStandardDateTimeFieldType* YEAR_TYPE = nil;
+static HLStandardDateTimeFieldType* YEAR_OF_ERA_TYPE = nil;
+static HLStandardDateTimeFieldType* YEAR_OF_CENTURY_TYPE = nil;
+static HLStandardDateTimeFieldType* CENTURY_OF_ERA_TYPE = nil;
+static HLStandardDateTimeFieldType* ERA_TYPE = nil;
+
 @implementation HLDateTimeFieldType
 
+//-----------------------------------------------------------------------
++ (void)initialize {
+    // the types are compared by identity, so each is created once here
+    // rather than on first use by whichever thread gets there first
+    if (self == [HLDateTimeFieldType class]) {
+        MILLIS_OF_SECOND_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"millisOfSecond" 
+                                                                          ordinal:MILLIS_OF_SECOND
+                                                                         unitType:[HLDurationFieldType millis]
+                                                                        rangeType:[HLDurationFieldType seconds]];
+        MILLIS_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"millisOfDay" 
+                                                                       ordinal:MILLIS_OF_DAY
+                                                                      unitType:[HLDurationFieldType millis]
+                                                                     rangeType:[HLDurationFieldType days]];
+        SECOND_OF_MINUTE_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"secondOfMinute" 
+                                                                          ordinal:SECOND_OF_MINUTE
+                                                                         unitType:[HLDurationFieldType seconds]
+                                                                        rangeType:[HLDurationFieldType minutes]];
+        SECOND_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"secondOfDay" 
+                                                                       ordinal:SECOND_OF_DAY
+                                                                      unitType:[HLDurationFieldType seconds]
+                                                                     rangeType:[HLDurationFieldType days]];
+        MINUTE_OF_HOUR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"minuteOfHour" 
+                                                                        ordinal:MINUTE_OF_HOUR
+                                                                       unitType:[HLDurationFieldType minutes]
+                                                                      rangeType:[HLDurationFieldType hours]];
+        MINUTE_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"minuteOfDay" 
+                                                                       ordinal:MINUTE_OF_DAY 
+                                                                      unitType:[HLDurationFieldType minutes]
+                                                                     rangeType:[HLDurationFieldType days]];
+        HOUR_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"hourOfDay" 
+                                                                     ordinal:HOUR_OF_DAY 
+                                                                    unitType:[HLDurationFieldType hours]
+                                                                   rangeType:[HLDurationFieldType days]];
+        CLOCKHOUR_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"clockhourOfDay" 
+                                                                          ordinal:CLOCKHOUR_OF_DAY 
+                                                                         unitType:[HLDurationFieldType hours]
+                                                                        rangeType:[HLDurationFieldType days]];
+        HOUR_OF_HALFDAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"hourOfHalfday" 
+                                                                         ordinal:HOUR_OF_HALFDAY 
+                                                                        unitType:[HLDurationFieldType hours]
+                                                                       rangeType:[HLDurationFieldType halfdays]];
+        CLOCKHOUR_OF_HALFDAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"clockhourOfHalfday" 
+                                                                              ordinal:CLOCKHOUR_OF_HALFDAY 
+                                                                             unitType:[HLDurationFieldType hours]
+                                                                            rangeType:[HLDurationFieldType halfdays]];
+        HALFDAY_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"halfdayOfDay" 
+                                                                        ordinal:HALFDAY_OF_DAY 
+                                                                       unitType:[HLDurationFieldType halfdays]
+                                                                      rangeType:[HLDurationFieldType days]];
+        DAY_OF_WEEK_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"dayOfWeek" 
+                                                                     ordinal:DAY_OF_WEEK 
+                                                                    unitType:[HLDurationFieldType days]
+                                                                   rangeType:[HLDurationFieldType weeks]];
+        DAY_OF_MONTH_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"dayOfMonth" 
+                                                                      ordinal:DAY_OF_MONTH 
+                                                                     unitType:[HLDurationFieldType days]
+                                                                    rangeType:[HLDurationFieldType months]];
+        DAY_OF_YEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"dayOfYear" 
+                                                                     ordinal:DAY_OF_YEAR 
+                                                                    unitType:[HLDurationFieldType days]
+                                                                   rangeType:[HLDurationFieldType years]];
+        WEEK_OF_WEEKYEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"weekOfWeekyear" 
+                                                                          ordinal:WEEK_OF_WEEKYEAR
+                                                                         unitType:[HLDurationFieldType weeks]
+                                                                        rangeType:[HLDurationFieldType weekyears]];
+        WEEKYEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"weekyear" 
+                                                                  ordinal:WEEKYEAR 
+                                                                 unitType:[HLDurationFieldType weekyears]
+                                                                rangeType:nil];
+        WEEKYEAR_OF_CENTURY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"weekyearOfCentury" 
+                                                                             ordinal:WEEKYEAR_OF_CENTURY 
+                                                                            unitType:[HLDurationFieldType weekyears]
+                                                                           rangeType:[HLDurationFieldType centuries]];
+        MONTH_OF_YEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"monthOfYear" 
+                                                                       ordinal:MONTH_OF_YEAR 
+                                                                      unitType:[HLDurationFieldType months]
+                                                                     rangeType:[HLDurationFieldType years]];
+        YEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"year" 
+                                                              ordinal:YEAR
+                                                             unitType:[HLDurationFieldType years]
+                                                            rangeType:nil];
+        YEAR_OF_ERA_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"yearOfEra" 
+                                                                     ordinal:YEAR_OF_ERA
+                                                                    unitType:[HLDurationFieldType years]
+                                                                   rangeType:[HLDurationFieldType eras]];
+        YEAR_OF_CENTURY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"centuryOfEra" 
+                                                                         ordinal:CENTURY_OF_ERA
+                                                                        unitType:[HLDurationFieldType years]
+                                                                       rangeType:[HLDurationFieldType centuries]];
+        CENTURY_OF_ERA_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"centuryOfEra" 
+                                                                        ordinal:CENTURY_OF_ERA
+                                                                       unitType:[HLDurationFieldType centuries]
+                                                                      rangeType:[HLDurationFieldType eras]];
+        ERA_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"era" 
+                                                             ordinal:ERA
+                                                            unitType:[HLDurationFieldType eras]
+                                                           rangeType:nil];
+    }
+}
+
 //-----------------------------------------------------------------------
 - (id)initWithName:(NSString*)name {
     self = [super init];
@@ -48,15 +172,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)millisOfSecond {
-    static HLStandardDateTimeFieldType* MILLIS_OF_SECOND_TYPE = nil;
-    
-    if(MILLIS_OF_SECOND_TYPE == nil) {
-        MILLIS_OF_SECOND_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"millisOfSecond" 
-                                                                          ordinal:MILLIS_OF_SECOND
-                                                                         unitType:[HLDurationFieldType millis]
-                                                                        rangeType:[HLDurationFieldType seconds]];
-    }
-    
     return MILLIS_OF_SECOND_TYPE;
 }
 
@@ -66,15 +181,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)millisOfDay {
-    static HLStandardDateTimeFieldType* MILLIS_OF_DAY_TYPE = nil;
-    
-    if(MILLIS_OF_DAY_TYPE == nil) {
-        MILLIS_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"millisOfDay" 
-                                                                       ordinal:MILLIS_OF_DAY
-                                                                      unitType:[HLDurationFieldType millis]
-                                                                     rangeType:[HLDurationFieldType days]];
-    }
-    
     return MILLIS_OF_DAY_TYPE;
 }
 
@@ -84,15 +190,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)secondOfMinute {
-    static HLStandardDateTimeFieldType* SECOND_OF_MINUTE_TYPE = nil;
-    
-    if(SECOND_OF_MINUTE_TYPE == nil) {
-        SECOND_OF_MINUTE_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"secondOfMinute" 
-                                                                          ordinal:SECOND_OF_MINUTE
-                                                                         unitType:[HLDurationFieldType seconds]
-                                                                        rangeType:[HLDurationFieldType minutes]];
-    }
-    
     return SECOND_OF_MINUTE_TYPE;
 }
 
@@ -102,15 +199,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)secondOfDay {
-    static HLStandardDateTimeFieldType* SECOND_OF_DAY_TYPE = nil;
-    
-    if(SECOND_OF_DAY_TYPE == nil) {
-        SECOND_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"secondOfDay" 
-                                                                       ordinal:SECOND_OF_DAY
-                                                                      unitType:[HLDurationFieldType seconds]
-                                                                     rangeType:[HLDurationFieldType days]];
-    }
-    
     return SECOND_OF_DAY_TYPE;
 }
 
@@ -120,15 +208,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)minuteOfHour {
-    static HLStandardDateTimeFieldType* MINUTE_OF_HOUR_TYPE = nil;
-    
-    if(MINUTE_OF_HOUR_TYPE == nil) {
-        MINUTE_OF_HOUR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"minuteOfHour" 
-                                                                        ordinal:MINUTE_OF_HOUR
-                                                                       unitType:[HLDurationFieldType minutes]
-                                                                      rangeType:[HLDurationFieldType hours]];
-    }
-    
     return MINUTE_OF_HOUR_TYPE;
 }
 
@@ -138,15 +217,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)minuteOfDay {
-    static HLStandardDateTimeFieldType* MINUTE_OF_DAY_TYPE = nil;
-    
-    if(MINUTE_OF_DAY_TYPE == nil) {
-        MINUTE_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"minuteOfDay" 
-                                                                       ordinal:MINUTE_OF_DAY 
-                                                                      unitType:[HLDurationFieldType minutes]
-                                                                     rangeType:[HLDurationFieldType days]];
-    }
-    
     return MINUTE_OF_DAY_TYPE;
 }
 
@@ -156,15 +226,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)hourOfDay {
-    static HLStandardDateTimeFieldType* HOUR_OF_DAY_TYPE = nil;
-    
-    if(HOUR_OF_DAY_TYPE == nil) {
-        HOUR_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"hourOfDay" 
-                                                                     ordinal:HOUR_OF_DAY 
-                                                                    unitType:[HLDurationFieldType hours]
-                                                                   rangeType:[HLDurationFieldType days]];
-    }
-    
     return HOUR_OF_DAY_TYPE;
 }
 
@@ -174,15 +235,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)clockhourOfDay {
-    static HLStandardDateTimeFieldType* CLOCKHOUR_OF_DAY_TYPE = nil;
-    
-    if(CLOCKHOUR_OF_DAY_TYPE == nil) {
-        CLOCKHOUR_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"clockhourOfDay" 
-                                                                          ordinal:CLOCKHOUR_OF_DAY 
-                                                                         unitType:[HLDurationFieldType hours]
-                                                                        rangeType:[HLDurationFieldType days]];
-    }
-    
     return CLOCKHOUR_OF_DAY_TYPE;
 }
 
@@ -192,15 +244,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)hourOfHalfday {
-    static HLStandardDateTimeFieldType* HOUR_OF_HALFDAY_TYPE = nil;
-    
-    if(HOUR_OF_HALFDAY_TYPE == nil) {
-        HOUR_OF_HALFDAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"hourOfHalfday" 
-                                                                         ordinal:HOUR_OF_HALFDAY 
-                                                                        unitType:[HLDurationFieldType hours]
-                                                                       rangeType:[HLDurationFieldType halfdays]];
-    }
-    
     return HOUR_OF_HALFDAY_TYPE;
 }
 
@@ -210,15 +253,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)clockhourOfHalfday {
-    static HLStandardDateTimeFieldType* CLOCKHOUR_OF_HALFDAY_TYPE = nil;
-    
-    if(CLOCKHOUR_OF_HALFDAY_TYPE == nil) {
-        CLOCKHOUR_OF_HALFDAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"clockhourOfHalfday" 
-                                                                              ordinal:CLOCKHOUR_OF_HALFDAY 
-                                                                             unitType:[HLDurationFieldType hours]
-                                                                            rangeType:[HLDurationFieldType halfdays]];
-    }
-    
     return CLOCKHOUR_OF_HALFDAY_TYPE;
 }
 
@@ -228,15 +262,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)halfdayOfDay {
-    static HLStandardDateTimeFieldType* HALFDAY_OF_DAY_TYPE = nil;
-    
-    if(HALFDAY_OF_DAY_TYPE == nil) {
-        HALFDAY_OF_DAY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"halfdayOfDay" 
-                                                                        ordinal:HALFDAY_OF_DAY 
-                                                                       unitType:[HLDurationFieldType halfdays]
-                                                                      rangeType:[HLDurationFieldType days]];
-    }
-    
     return HALFDAY_OF_DAY_TYPE;
 }
 
@@ -247,15 +272,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)dayOfWeek {
-    static HLStandardDateTimeFieldType* DAY_OF_WEEK_TYPE = nil;
-    
-    if(DAY_OF_WEEK_TYPE == nil) {
-        DAY_OF_WEEK_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"dayOfWeek" 
-                                                                     ordinal:DAY_OF_WEEK 
-                                                                    unitType:[HLDurationFieldType days]
-                                                                   rangeType:[HLDurationFieldType weeks]];
-    }
-    
     return DAY_OF_WEEK_TYPE;
 }
 
@@ -265,15 +281,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)dayOfMonth {
-    static HLStandardDateTimeFieldType* DAY_OF_MONTH_TYPE = nil;
-    
-    if(DAY_OF_MONTH_TYPE == nil) {
-        DAY_OF_MONTH_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"dayOfMonth" 
-                                                                      ordinal:DAY_OF_MONTH 
-                                                                     unitType:[HLDurationFieldType days]
-                                                                    rangeType:[HLDurationFieldType months]];
-    }
-    
     return DAY_OF_MONTH_TYPE;
 }
 
@@ -283,15 +290,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)dayOfYear {
-    static HLStandardDateTimeFieldType* DAY_OF_YEAR_TYPE = nil;
-    
-    if(DAY_OF_YEAR_TYPE == nil) {
-        DAY_OF_YEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"dayOfYear" 
-                                                                     ordinal:DAY_OF_YEAR 
-                                                                    unitType:[HLDurationFieldType days]
-                                                                   rangeType:[HLDurationFieldType years]];
-    }
-    
     return DAY_OF_YEAR_TYPE;
 }
 
@@ -301,15 +299,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)weekOfWeekyear {
-    static HLStandardDateTimeFieldType* WEEK_OF_WEEKYEAR_TYPE = nil;
-    
-    if(WEEK_OF_WEEKYEAR_TYPE == nil) {
-        WEEK_OF_WEEKYEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"weekOfWeekyear" 
-                                                                          ordinal:WEEK_OF_WEEKYEAR
-                                                                         unitType:[HLDurationFieldType weeks]
-                                                                        rangeType:[HLDurationFieldType weekyears]];
-    }
-    
     return WEEK_OF_WEEKYEAR_TYPE;
 }
 
@@ -319,15 +308,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)weekyear {
-    static HLStandardDateTimeFieldType* WEEKYEAR_TYPE = nil;
-    
-    if(WEEKYEAR_TYPE == nil) {
-        WEEKYEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"weekyear" 
-                                                                  ordinal:WEEKYEAR 
-                                                                 unitType:[HLDurationFieldType weekyears]
-                                                                rangeType:nil];
-    }
-    
     return WEEKYEAR_TYPE;
 }
 
@@ -337,15 +317,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)weekyearOfCentury {
-    static HLStandardDateTimeFieldType* WEEKYEAR_OF_CENTURY_TYPE = nil;
-    
-    if(WEEKYEAR_OF_CENTURY_TYPE == nil) {
-        WEEKYEAR_OF_CENTURY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"weekyearOfCentury" 
-                                                                             ordinal:WEEKYEAR_OF_CENTURY 
-                                                                            unitType:[HLDurationFieldType weekyears]
-                                                                           rangeType:[HLDurationFieldType centuries]];
-    }
-    
     return WEEKYEAR_OF_CENTURY_TYPE;
 }
 
@@ -355,15 +326,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)monthOfYear {
-    static HLStandardDateTimeFieldType* MONTH_OF_YEAR_TYPE = nil;
-    
-    if(MONTH_OF_YEAR_TYPE == nil) {
-        MONTH_OF_YEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"monthOfYear" 
-                                                                       ordinal:MONTH_OF_YEAR 
-                                                                      unitType:[HLDurationFieldType months]
-                                                                     rangeType:[HLDurationFieldType years]];
-    }
-    
     return MONTH_OF_YEAR_TYPE;
 }
 
@@ -373,15 +335,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)year {
-    static HLStandardDateTimeFieldType* YEAR_TYPE = nil;
-    
-    if(YEAR_TYPE == nil) {
-        YEAR_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"year" 
-                                                              ordinal:YEAR
-                                                             unitType:[HLDurationFieldType years]
-                                                            rangeType:nil];
-    }
-    
     return YEAR_TYPE;
 }
 
@@ -391,15 +344,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)yearOfEra {
-    static HLStandardDateTimeFieldType* YEAR_OF_ERA_TYPE = nil;
-    
-    if(YEAR_OF_ERA_TYPE == nil) {
-        YEAR_OF_ERA_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"yearOfEra" 
-                                                                     ordinal:YEAR_OF_ERA
-                                                                    unitType:[HLDurationFieldType years]
-                                                                   rangeType:[HLDurationFieldType eras]];
-    }
-    
     return YEAR_OF_ERA_TYPE;
 }
 
@@ -409,15 +353,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)yearOfCentury {
-    static HLStandardDateTimeFieldType* YEAR_OF_CENTURY_TYPE = nil;
-    
-    if(YEAR_OF_CENTURY_TYPE == nil) {
-        YEAR_OF_CENTURY_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"centuryOfEra" 
-                                                                         ordinal:CENTURY_OF_ERA
-                                                                        unitType:[HLDurationFieldType years]
-                                                                       rangeType:[HLDurationFieldType centuries]];
-    }
-    
     return YEAR_OF_CENTURY_TYPE;
 }
 
@@ -427,15 +362,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)centuryOfEra {
-    static HLStandardDateTimeFieldType* CENTURY_OF_ERA_TYPE = nil;
-    
-    if(CENTURY_OF_ERA_TYPE == nil) {
-        CENTURY_OF_ERA_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"centuryOfEra" 
-                                                                        ordinal:CENTURY_OF_ERA
-                                                                       unitType:[HLDurationFieldType centuries]
-                                                                      rangeType:[HLDurationFieldType eras]];
-    }
-    
     return CENTURY_OF_ERA_TYPE;
 }
 
@@ -445,16 +371,6 @@
  * @return the DateTimeFieldType constant
  */
 + (HLDateTimeFieldType*)era {
-    // internal constants
-    static HLStandardDateTimeFieldType* ERA_TYPE = nil;
-    
-    if(ERA_TYPE == nil) {
-        ERA_TYPE = [[HLStandardDateTimeFieldType alloc] initWithName:@"era" 
-                                                             ordinal:ERA
-                                                            unitType:[HLDurationFieldType eras]
-                                                           rangeType:nil];
-    }
-    
     return ERA_TYPE;
 }
 
@@ -550,6 +466,10 @@
     return self;
 }
 
+- (NSInteger)ordinal {
+    return _iOrdinal;
+}
+
 /** @inheritdoc */
 - (HLDurationFieldType*)durationType {
     return _iUnitType;
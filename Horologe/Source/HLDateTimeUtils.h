@@ -30,6 +30,14 @@
 @protocol HLReadableDuration;
 @protocol HLReadablePartial;
 
+/**
+ * Gets the current time in milliseconds, as HLDateTimeUtils currentTimeMillis
+ * does, without a message send. In the cached mode this is a single load.
+ * 
+ * @return the current time in milliseconds from 1970-01-01T00:00:00Z
+ */
+extern int64_t HLCurrentTimeMillis(void);
+
 /**
  * DateTimeUtils provide public utility methods for the date-time library.
  * <p>
@@ -48,12 +56,12 @@
 /**
  * Gets the current time in milliseconds.
  * <p>
- * By default this returns <code>System.currentTimeMillis()</code>.
+ * By default this returns the system wall clock, read with HLClockWallMillis.
  * This may be changed using other methods in this class.
  * 
  * @return the current time in milliseconds from 1970-01-01T00:00:00Z
  */
-+ (NSInteger)currentTimeMillis;
++ (int64_t)currentTimeMillis;
 
 /**
  * Resets the current time to return the system time.
@@ -65,6 +73,34 @@
  */
 + (void)setCurrentMillisSystem;
 
+/**
+ * Sets the current time to return the coarse system time.
+ * <p>
+ * This method changes the behaviour of {@link #currentTimeMillis()}.
+ * Whenever the current time is queried, HLClockCoarseMillis is used, which
+ * is cheaper than the system time but only advances once per scheduler
+ * tick. Use this where many timestamps are taken and a few milliseconds
+ * of granularity are acceptable.
+ * 
+ * @throws SecurityException if the application does not have sufficient security rights
+ */
++ (void)setCurrentMillisCoarse;
+
+/**
+ * Sets the current time to return a cached system time, refreshed by a
+ * ticker on a background thread.
+ * <p>
+ * This method changes the behaviour of {@link #currentTimeMillis()}.
+ * Whenever the current time is queried, the last time stored by the ticker
+ * is returned, which costs a single load. The result lags the system time
+ * by up to the tick interval. The ticker is stopped when another mode is set.
+ * 
+ * @param tickMillis  the refresh interval in milliseconds, at least 1
+ * @throws IllegalArgumentException if the interval is less than 1
+ * @throws SecurityException if the application does not have sufficient security rights
+ */
++ (void)setCurrentMillisCached:(int64_t)tickMillis;
+
 /**
  * Sets the current time to return a fixed millisecond time.
  * <p>
@@ -74,7 +110,7 @@
  * @param fixedMillis  the fixed millisecond time to use
  * @throws SecurityException if the application does not have sufficient security rights
  */
-+ (void)setCurrentMillisFixed:(NSInteger)fixedMillis;
++ (void)setCurrentMillisFixed:(int64_t)fixedMillis;
 
 /**
  * Sets the current time to return the system time plus an offset.
@@ -86,7 +122,7 @@
  * @param offsetMillis  the fixed millisecond time to use
  * @throws SecurityException if the application does not have sufficient security rights
  */
-+ (void)setCurrentMillisOffset:(NSInteger)offsetMillis;
++ (void)setCurrentMillisOffset:(int64_t)offsetMillis;
 
 /**
  * Checks whether the provider may be changed using permission 'CurrentTime.setProvider'.
@@ -105,7 +141,7 @@
  * @param instant  the instant to examine, nil means now
  * @return the time in milliseconds from 1970-01-01T00:00:00Z
  */
-+ (NSInteger)instantMillis:(id<HLReadableInstant>)instant;
++ (int64_t)instantMillis:(id<HLReadableInstant>)instant;
 
 //-----------------------------------------------------------------------
 /**
@@ -208,7 +244,7 @@
  * @param duration  the duration to examine, nil means zero
  * @return the duration in milliseconds
  */
-+ (NSInteger)durationMillis:(id<HLReadableDuration>)duration;
++ (int64_t)durationMillis:(id<HLReadableDuration>)duration;
 
 //-----------------------------------------------------------------------
 /**
@@ -245,7 +281,7 @@
  * Gets the current time.
  * @return the current time in millis
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 @end
 
@@ -259,7 +295,7 @@
  * Gets the current time.
  * @return the current time in millis
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 @end
 
@@ -271,7 +307,7 @@
     
 @private
     /** The fixed millis value. */
-    NSInteger _iMillis;
+    int64_t _iMillis;
     
 }
 
@@ -279,13 +315,13 @@
  * Constructor.
  * @param offsetMillis  the millis offset
  */
-- (id)initWithMillis:(NSInteger)fixedMillis;
+- (id)initWithMillis:(int64_t)fixedMillis;
 
 /**
  * Gets the current time.
  * @return the current time in millis
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 @end
 
@@ -296,19 +332,19 @@
 @interface HLOffsetMillisProvider : HLMillisProvider {
     
 @private
-    NSInteger _iMillis;
+    int64_t _iMillis;
 }
 
 /**
  * Constructor.
  * @param offsetMillis  the millis offset
  */
-- (id)initWithMillis:(NSInteger)offsetMillis;
+- (id)initWithMillis:(int64_t)offsetMillis;
 
 /**
  * Gets the current time.
  * @return the current time in millis
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 @end
@@ -21,16 +21,78 @@
 
 #import "HLDateTimeUtils.h"
 
+#import <libkern/OSAtomic.h>
+#import <pthread.h>
+
+#import "HLClock.h"
+
 #import "HLISOChronology.h"
 #import "HLReadableInstant.h"
 #import "HLInterval.h"
 #import "HLDateTimeField.h"
 
 
-/** The singleton instance of the system millisecond provider. */
-static const HLSystemMillisProvider* SYSTEM_MILLIS_PROVIDER = [[HLSystemMillisProvider alloc] init];
-/** The millisecond provider currently in use. */
-static volatile HLMillisProvider* cMillisProvider = SYSTEM_MILLIS_PROVIDER;
+/** The ways the current time may be read. */
+typedef enum _HLCurrentMillisMode {
+    HLCurrentMillisSystem = 0,
+    HLCurrentMillisCoarse,
+    HLCurrentMillisCached,
+    HLCurrentMillisProvider,
+} HLCurrentMillisMode;
+
+/** How the current time is read. */
+static volatile HLCurrentMillisMode cMillisMode = HLCurrentMillisSystem;
+/** The millisecond provider in use when the mode is HLCurrentMillisProvider. */
+static HLMillisProvider* volatile cMillisProvider = nil;
+/** The provider replaced by the last switch, released by the next one. */
+static HLMillisProvider* cRetiredProvider = nil;
+/** Serializes switches of the mode, the provider and the clock ticker. */
+static pthread_mutex_t cMillisLock = PTHREAD_MUTEX_INITIALIZER;
+
+int64_t HLCurrentTimeMillis(void) {
+    switch (cMillisMode) {
+        case HLCurrentMillisCoarse:
+            return HLClockCoarseMillis();
+        case HLCurrentMillisCached:
+            return HLClockCachedMillis();
+        case HLCurrentMillisProvider:
+            return [cMillisProvider millis];
+        default:
+            return HLClockWallMillis();
+    }
+}
+
+/*
+ * Switches how the current time is read, starting the ticker if the mode
+ * is cached and stopping it otherwise.
+ * <p>
+ * Readers do not lock, so one may still be calling the provider being
+ * replaced. It is therefore kept until the following switch, and only the
+ * provider retired by the switch before this one is released.
+ */
+static void HLSetCurrentMillisMode(HLCurrentMillisMode mode, 
+                                   HLMillisProvider* provider,
+                                   int64_t tickMillis) {
+    pthread_mutex_lock(&cMillisLock);
+    @try {
+        if (mode == HLCurrentMillisCached) {
+            HLClockStartTicker(tickMillis);
+        }
+        HLMillisProvider* replaced = cMillisProvider;
+        cMillisProvider = [provider retain];
+        // publish the provider before the mode that uses it
+        OSMemoryBarrier();
+        cMillisMode = mode;
+        if (mode != HLCurrentMillisCached) {
+            HLClockStopTicker();
+        }
+        [cRetiredProvider release];
+        cRetiredProvider = replaced;
+    }
+    @finally {
+        pthread_mutex_unlock(&cMillisLock);
+    }
+}
 
 /**
  * DateTimeUtils provide public utility methods for the date-time library.
@@ -43,27 +105,39 @@ static volatile HLMillisProvider* cMillisProvider = SYSTEM_MILLIS_PROVIDER;
 @implementation HLDateTimeUtils
 
 //-----------------------------------------------------------------------
-+ (NSInteger)currentTimeMillis {
-    return [cMillisProvider millis];
++ (int64_t)currentTimeMillis {
+    return HLCurrentTimeMillis();
 }
 
 + (void)setCurrentMillisSystem {
     [self checkPermission];
-    cMillisProvider = SYSTEM_MILLIS_PROVIDER;
+    HLSetCurrentMillisMode(HLCurrentMillisSystem, nil, 0);
 }
 
-+ (void)setCurrentMillisFixed:(NSInteger)fixedMillis {
-    [self _checkPermission];
-    cMillisProvider = [[HLFixedMillisProvider alloc] initWithMillis:fixedMillis];
++ (void)setCurrentMillisCoarse {
+    [self checkPermission];
+    HLSetCurrentMillisMode(HLCurrentMillisCoarse, nil, 0);
+}
+
++ (void)setCurrentMillisCached:(int64_t)tickMillis {
+    [self checkPermission];
+    HLSetCurrentMillisMode(HLCurrentMillisCached, nil, tickMillis);
+}
+
++ (void)setCurrentMillisFixed:(int64_t)fixedMillis {
+    [self checkPermission];
+    HLMillisProvider* provider = [[[HLFixedMillisProvider alloc] initWithMillis:fixedMillis] autorelease];
+    HLSetCurrentMillisMode(HLCurrentMillisProvider, provider, 0);
 }
 
-+ (void)setCurrentMillisOffset:(NSInteger)offsetMillis {
++ (void)setCurrentMillisOffset:(int64_t)offsetMillis {
     [self checkPermission];
     if (offsetMillis == 0) {
-        cMillisProvider = SYSTEM_MILLIS_PROVIDER;
+        HLSetCurrentMillisMode(HLCurrentMillisSystem, nil, 0);
     } 
     else {
-        cMillisProvider = [[HLOffsetMillisProvider alloc] initWithMillis:offsetMillis];
+        HLMillisProvider* provider = [[[HLOffsetMillisProvider alloc] initWithMillis:offsetMillis] autorelease];
+        HLSetCurrentMillisMode(HLCurrentMillisProvider, provider, 0);
     }
 }
 
@@ -72,9 +146,9 @@ static volatile HLMillisProvider* cMillisProvider = SYSTEM_MILLIS_PROVIDER;
 }
 
 //-----------------------------------------------------------------------
-+ (NSInteger)instantMillis:(id<HLReadableInstant>)instant {
++ (int64_t)instantMillis:(id<HLReadableInstant>)instant {
     if (instant == nil) {
-        return [HLDateTimeUtils currentTimeMillis];
+        return HLCurrentTimeMillis();
     }
     
     return [instant millis];
@@ -132,7 +206,7 @@ static volatile HLMillisProvider* cMillisProvider = SYSTEM_MILLIS_PROVIDER;
 + (id<HLReadableInterval>)readableInterval:(id<HLReadableInterval>)interval {
     
     if (interval == nil) {
-        NSInteger now = [HLDateTimeUtils currentTimeMillis];
+        int64_t now = HLCurrentTimeMillis();
         interval = [[[HLInterval alloc] initWithStart:now
                                                   end:now] autorelease];
     }
@@ -170,7 +244,7 @@ static volatile HLMillisProvider* cMillisProvider = SYSTEM_MILLIS_PROVIDER;
 }
 
 //-----------------------------------------------------------------------
-+ (NSInteger)durationMillis:(id<HLReadableDuration>)duration {
++ (int64_t)durationMillis:(id<HLReadableDuration>)duration {
     
     if (duration == nil) {
         return 0L;
@@ -220,13 +294,8 @@ static volatile HLMillisProvider* cMillisProvider = SYSTEM_MILLIS_PROVIDER;
  */
 @implementation HLSystemMillisProvider
 
-- (NSInteger)millis {
-    struct timeval tv;
-    NSInteger milliseconds = 0;
-    if(gettimeofday(&tv, NULL) == 0)
-        milliseconds = tv.tv_usec / 1000;
-    
-    return milliseconds;
+- (int64_t)millis {
+    return HLClockWallMillis();
 }
 
 @end
@@ -238,11 +307,16 @@ static volatile HLMillisProvider* cMillisProvider = SYSTEM_MILLIS_PROVIDER;
  */
 @implementation HLFixedMillisProvider
 
-- (id)initWithMillis:(NSInteger)fixedMillis  {
-    _iMillis = fixedMillis;
+- (id)initWithMillis:(int64_t)fixedMillis  {
+    self = [super init];
+    if(self) {
+        _iMillis = fixedMillis;
+    }
+    
+    return self;
 }
 
-- (NSInteger)millis {
+- (int64_t)millis {
     return _iMillis;
 }
 
@@ -255,17 +329,17 @@ static volatile HLMillisProvider* cMillisProvider = SYSTEM_MILLIS_PROVIDER;
  */
 @implementation HLOffsetMillisProvider
 
-- (id)initWithMillis:(NSInteger)offsetMillis {
-    _iMillis = offsetMillis;
+- (id)initWithMillis:(int64_t)offsetMillis {
+    self = [super init];
+    if(self) {
+        _iMillis = offsetMillis;
+    }
+    
+    return self;
 }
 
-- (NSInteger)millis {
-    struct timeval tv;
-    NSInteger milliseconds = 0;
-    if(gettimeofday(&tv, NULL) == 0)
-        milliseconds = tv.tv_usec / 1000;
-    
-    return milliseconds + _iMillis;
+- (int64_t)millis {
+    return HLClockWallMillis() + _iMillis;
 }
 
 @end
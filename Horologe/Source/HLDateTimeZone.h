@@ -244,7 +244,7 @@
  * @param instant  milliseconds from 1970-01-01T00:00:00Z to get the name for
  * @return name key or nil if id should be used for names
  */
-- (NSString*)nameKey:(NSInteger)instant;
+- (NSString*)nameKey:(int64_t)instant;
 
 /**
  * Gets the short name of this datetime zone suitable for display using
@@ -256,7 +256,7 @@
  * @param instant  milliseconds from 1970-01-01T00:00:00Z to get the name for
  * @return the human-readable short name in the default locale
  */
-- (NSString*)shortName:(NSInteger)instant;
+- (NSString*)shortName:(int64_t)instant;
 
 /**
  * Gets the short name of this datetime zone suitable for display using
@@ -269,7 +269,7 @@
  * @param locale  the locale to get the name for
  * @return the human-readable short name in the specified locale
  */
-- (NSString*)shortName:(NSInteger)instant 
+- (NSString*)shortName:(int64_t)instant 
                 locale:(NSLocale*)locale;
 
 /**
@@ -282,7 +282,7 @@
  * @param instant  milliseconds from 1970-01-01T00:00:00Z to get the name for
  * @return the human-readable long name in the default locale
  */
-- (NSString*)name:(NSInteger)instant;
+- (NSString*)name:(int64_t)instant;
 
 /**
  * Gets the long name of this datetime zone suitable for display using
@@ -295,7 +295,7 @@
  * @param locale  the locale to get the name for
  * @return the human-readable long name in the specified locale
  */
-- (NSString*)nameWithInstant:(NSInteger)instant 
+- (NSString*)nameWithInstant:(int64_t)instant 
                       locale:(NSLocale*)locale;
 
 /**
@@ -304,7 +304,7 @@
  * @param instant  milliseconds from 1970-01-01T00:00:00Z to get the offset for
  * @return the millisecond offset to add to UTC to get local time
  */
-- (NSInteger)offsetWithInstantValue:(NSInteger)instant;
+- (NSInteger)offsetWithInstantValue:(int64_t)instant;
 
 /**
  * Gets the millisecond offset to add to UTC to get local time.
@@ -321,7 +321,7 @@
  * @param instant  milliseconds from 1970-01-01T00:00:00Z to get the offset for
  * @return the millisecond offset to add to UTC to get local time
  */
-- (NSInteger)standardOffsetWithInstantValue:(NSInteger)instant;
+- (NSInteger)standardOffsetWithInstantValue:(int64_t)instant;
 
 /**
  * Checks whether, at a particular instant, the offset is standard or not.
@@ -338,7 +338,7 @@
  * @return true if the offset at the given instant is the standard offset
  * @since 1.5
  */
-- (BOOL)isStandardOffset:(NSInteger)instant;
+- (BOOL)isStandardOffset:(int64_t)instant;
 
 /**
  * Gets the millisecond offset to subtract from local time to get UTC time.
@@ -370,7 +370,7 @@
  * get the offset for
  * @return the millisecond offset to subtract from local time to get UTC time
  */
-- (NSInteger)offsetFromLocal:(NSInteger)instantLocal;
+- (NSInteger)offsetFromLocal:(int64_t)instantLocal;
 
 /**
  * Converts a standard UTC instant to a local instant with the same
@@ -382,7 +382,7 @@
  * @throws ArithmeticException if the result overflows a long
  * @since 1.5
  */
-- (NSInteger)convertUTCToLocal:(NSInteger)instantUTC;
+- (int64_t)convertUTCToLocal:(int64_t)instantUTC;
 
 /**
  * Converts a local instant to a standard UTC instant with the same
@@ -396,8 +396,8 @@
  * @throws IllegalArgumentException if the zone has no eqivalent local time
  * @since 1.5
  */
-- (NSInteger)convertLocalToUTC:(NSInteger)instantLocal
-                        strict:(BOOL)strict;
+- (int64_t)convertLocalToUTC:(int64_t)instantLocal
+                      strict:(BOOL)strict;
 
 /**
  * Gets the millisecond instant in another zone keeping the same local time.
@@ -409,8 +409,8 @@
  * @param oldInstant  the UTC millisecond instant to convert
  * @return the UTC millisecond instant with the same local time in the new zone
  */
-- (NSInteger)millisKeepLocal:(HLDateTimeZone*)newZone 
-                  oldInstant:(NSInteger)oldInstant;
+- (int64_t)millisKeepLocal:(HLDateTimeZone*)newZone 
+                oldInstant:(int64_t)oldInstant;
 
 /**
  * Checks if the given {@link LocalDateTime} is within a gap.
@@ -441,7 +441,7 @@
  * @param instant  milliseconds from 1970-01-01T00:00:00Z
  * @return milliseconds from 1970-01-01T00:00:00Z
  */
-- (NSInteger)nextTransition:(NSInteger)instant;
+- (int64_t)nextTransition:(int64_t)instant;
 
 /**
  * Retreats the given instant to where the time zone offset or name changes.
@@ -451,7 +451,7 @@
  * @param instant  milliseconds from 1970-01-01T00:00:00Z
  * @return milliseconds from 1970-01-01T00:00:00Z
  */
-- (NSInteger)previousTransition:(NSInteger)instant;
+- (int64_t)previousTransition:(int64_t)instant;
 
 // Basic methods
 //--------------------------------------------------------------------
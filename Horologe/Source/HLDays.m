@@ -21,9 +21,128 @@
 
 #import "HLDays.h"
 
+#import "HLConstants.h"
+#import "HLFieldUtils.h"
+
+
+/** Constant representing zero days. */
+const HLDays* HL_DAYS_ZERO;
+/** Constant representing one day. */
+const HLDays* HL_DAYS_ONE;
+/** Constant representing two days. */
+const HLDays* HL_DAYS_TWO;
+/** Constant representing three days. */
+const HLDays* HL_DAYS_THREE;
+/** Constant representing four days. */
+const HLDays* HL_DAYS_FOUR;
+/** Constant representing five days. */
+const HLDays* HL_DAYS_FIVE;
+/** Constant representing six days. */
+const HLDays* HL_DAYS_SIX;
+/** Constant representing seven days. */
+const HLDays* HL_DAYS_SEVEN;
+/** Constant representing the maximum number of days that can be stored in this object. */
+const HLDays* HL_DAYS_MAX_VALUE;
+/** Constant representing the minimum number of days that can be stored in this object. */
+const HLDays* HL_DAYS_MIN_VALUE;
+
+/** The shared instances for small numbers of days. */
+static HLPeriodPool sDaysPool;
 
 @implementation HLDays
 
++ (void)initialize {
+    if (self == [HLDays class]) {
+        HLPeriodPoolFill(&sDaysPool, [HLDays class]);
+        HL_DAYS_ZERO = [HLDays days:0];
+        HL_DAYS_ONE = [HLDays days:1];
+        HL_DAYS_TWO = [HLDays days:2];
+        HL_DAYS_THREE = [HLDays days:3];
+        HL_DAYS_FOUR = [HLDays days:4];
+        HL_DAYS_FIVE = [HLDays days:5];
+        HL_DAYS_SIX = [HLDays days:6];
+        HL_DAYS_SEVEN = [HLDays days:7];
+        HL_DAYS_MAX_VALUE = [[HLDays alloc] initWithPeriod:NSIntegerMax];
+        HL_DAYS_MIN_VALUE = [[HLDays alloc] initWithPeriod:NSIntegerMin];
+    }
+}
+
+//-----------------------------------------------------------------------
++ (HLDays*)days:(NSInteger)days {
+    HLDays* pooled = HLPeriodPoolValue(&sDaysPool, days);
+    if (pooled != nil) {
+        return pooled;
+    }
+    switch (days) {
+        case NSIntegerMax:
+            return (HLDays*) HL_DAYS_MAX_VALUE;
+        case NSIntegerMin:
+            return (HLDays*) HL_DAYS_MIN_VALUE;
+        default:
+            return [[[HLDays alloc] initWithPeriod:days] autorelease];
+    }
+}
+
+//-----------------------------------------------------------------------
+- (HLDays*)plusDaysValue:(NSInteger)days {
+    if (days == 0) {
+        return self;
+    }
+    
+    return [HLDays days:HLSafeToInteger(HLSafeAdd([self value], days))];
+}
+
+- (HLDays*)plusDays:(HLDays*)days {
+    if (days == nil) {
+        return self;
+    }
+    
+    return [self plusDaysValue:[days value]];
+}
+
+//-----------------------------------------------------------------------
+- (HLDays*)minusDaysValue:(NSInteger)days {
+    return [self plusDaysValue:HLSafeToInteger(HLSafeNegate(days))];
+}
+
+- (HLDays*)minusDays:(HLDays*)days {
+    if (days == nil) {
+        return self;
+    }
+    
+    return [self minusDaysValue:[days value]];
+}
+
+//-----------------------------------------------------------------------
+- (HLDays*)multipliedBy:(NSInteger)scalar {
+    return [HLDays days:HLSafeToInteger(HLSafeMultiply([self value], scalar))];
+}
+
+- (HLDays*)dividedBy:(NSInteger)divisor {
+    if (divisor == 1) {
+        return self;
+    }
+    if (divisor == -1) {
+        // NSIntegerMin / -1 traps rather than wrapping, so check it as a negation
+        return [self negated];
+    }
+    if (divisor == 0) {
+        [NSException raise:HL_ARITHMETIC_EXCEPTION format:@"Division by zero"];
+    }
+    
+    return [HLDays days:([self value] / divisor)];
+}
+
+//-----------------------------------------------------------------------
+- (HLDays*)negated {
+    return [HLDays days:HLSafeToInteger(HLSafeNegate([self value]))];
+}
+
+@end
+
+
+@implementation Days
+
 /*
  *  Copyright 2001-2006 Stephen Colebourne
  *
@@ -65,68 +184,11 @@ import org.joda.time.format.PeriodFormatter;
  */
 public final class Days extends BaseSingleFieldPeriod {
 
-    /** Constant representing zero days. */
-    public static final Days ZERO = new Days(0);
-    /** Constant representing one day. */
-    public static final Days ONE = new Days(1);
-    /** Constant representing two days. */
-    public static final Days TWO = new Days(2);
-    /** Constant representing three days. */
-    public static final Days THREE = new Days(3);
-    /** Constant representing four days. */
-    public static final Days FOUR = new Days(4);
-    /** Constant representing five days. */
-    public static final Days FIVE = new Days(5);
-    /** Constant representing six days. */
-    public static final Days SIX = new Days(6);
-    /** Constant representing seven days. */
-    public static final Days SEVEN = new Days(7);
-    /** Constant representing the maximum number of days that can be stored in this object. */
-    public static final Days MAX_VALUE = new Days(Integer.MAX_VALUE);
-    /** Constant representing the minimum number of days that can be stored in this object. */
-    public static final Days MIN_VALUE = new Days(Integer.MIN_VALUE);
-
     /** The paser to use for this class. */
     private static final PeriodFormatter PARSER = ISOPeriodFormat.standard().withParseType(PeriodType.days());
     /** Serialization version. */
     private static final long serialVersionUID = 87525275727380865L;
 
-    //-----------------------------------------------------------------------
-    /**
-     * Obtains an instance of <code>Days</code> that may be cached.
-     * <code>Days</code> is immutable, so instances can be cached and shared.
-     * This factory method provides access to shared instances.
-     *
-     * @param days  the number of days to obtain an instance for
-     * @return the instance of Days
-     */
-    public static Days days:(NSInteger) days) {
-        switch (days) {
-            case 0:
-                return ZERO;
-            case 1:
-                return ONE;
-            case 2:
-                return TWO;
-            case 3:
-                return THREE;
-            case 4:
-                return FOUR;
-            case 5:
-                return FIVE;
-            case 6:
-                return SIX;
-            case 7:
-                return SEVEN;
-            case Integer.MAX_VALUE:
-                return MAX_VALUE;
-            case Integer.MIN_VALUE:
-                return MIN_VALUE;
-            default:
-                return new Days(days);
-        }
-    }
-
     //-----------------------------------------------------------------------
     /**
      * Creates a <code>Days</code> representing the number of whole days
@@ -366,111 +428,6 @@ public final class Days extends BaseSingleFieldPeriod {
         return getValue();
     }
 
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the specified number of days added.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param days  the amount of days to add, may be negative
-     * @return the new period plus the specified number of days
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Days plus:(NSInteger) days) {
-        if (days == 0) {
-            return this;
-        }
-        return Days.days(FieldUtils.safeAdd(getValue(), days));
-    }
-
-    /**
-     * Returns a new instance with the specified number of days added.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param days  the amount of days to add, may be negative, nil means zero
-     * @return the new period plus the specified number of days
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Days plus(Days days) {
-        if (days == nil) {
-            return this;
-        }
-        return plus(days.getValue());
-    }
-
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the specified number of days taken away.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param days  the amount of days to take away, may be negative
-     * @return the new period minus the specified number of days
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Days minus:(NSInteger) days) {
-        return plus(FieldUtils.safeNegate(days));
-    }
-
-    /**
-     * Returns a new instance with the specified number of days taken away.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param days  the amount of days to take away, may be negative, nil means zero
-     * @return the new period minus the specified number of days
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Days minus(Days days) {
-        if (days == nil) {
-            return this;
-        }
-        return minus(days.getValue());
-    }
-
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the days multiplied by the specified scalar.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param scalar  the amount to multiply by, may be negative
-     * @return the new period multiplied by the specified scalar
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Days multipliedBy:(NSInteger) scalar) {
-        return Days.days(FieldUtils.safeMultiply(getValue(), scalar));
-    }
-
-    /**
-     * Returns a new instance with the days divided by the specified divisor.
-     * The calculation uses integer division, thus 3 divided by 2 is 1.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param divisor  the amount to divide by, may be negative
-     * @return the new period divided by the specified divisor
-     * @throws ArithmeticException if the divisor is zero
-     */
-    public Days dividedBy:(NSInteger) divisor) {
-        if (divisor == 1) {
-            return this;
-        }
-        return Days.days(getValue() / divisor);
-    }
-
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the days value negated.
-     *
-     * @return the new period with a negated value
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Days negated {
-        return Days.days(FieldUtils.safeNegate(getValue()));
-    }
-
     //-----------------------------------------------------------------------
     /**
      * Is this days instance greater than the specified number of days.
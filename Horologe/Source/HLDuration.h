@@ -22,6 +22,7 @@
 #import <Foundation/Foundation.h>
 
 #import "HLBaseDuration.h"
+#import "HLInstantValue.h"
 #import "HLReadableDuration.h"
 
 
@@ -120,13 +121,22 @@
  */
 + (HLDuration*)standardSeconds:(NSInteger)seconds;
 
+/**
+ * Create a duration from a number of nanoseconds, rounded towards negative
+ * infinity to whole milliseconds.
+ *
+ * @param nanos  the number of nanoseconds
+ * @return the duration
+ */
++ (HLDuration*)durationWithNanos:(int64_t)nanos;
+
 //-----------------------------------------------------------------------
 /**
  * Creates a duration from the given millisecond duration.
  *
  * @param duration  the duration, in milliseconds
  */
-- (id)initWithDurationValue:(NSInteger)duration;
+- (id)initWithDurationValue:(int64_t)duration;
 
 /**
  * Creates a duration from the given interval endpoints.
@@ -135,8 +145,8 @@
  * @param endInstant  interval end, in milliseconds
  * @throws ArithmeticException if the duration exceeds a 64 bit long
  */
-- (id)initWithStartInstantValue:(NSInteger)startInstant 
-                endInstantValue:(NSInteger)endInstant;
+- (id)initWithStartInstantValue:(int64_t)startInstant 
+                endInstantValue:(int64_t)endInstant;
 
 /**
  * Creates a duration from the given interval endpoints.
@@ -148,6 +158,18 @@
 - (id)initWithStartInstant:(id<HLReadableInstant>)start 
                 endInstant:(id<HLReadableInstant>)end;
 
+/**
+ * Creates a duration from the given nano instant endpoints. The duration
+ * is the whole milliseconds between them, rounded towards negative
+ * infinity; use HLNanoInstantNanosBetween for the exact nanoseconds.
+ *
+ * @param start  interval start
+ * @param end  interval end
+ * @throws ArithmeticException if the duration exceeds a 64 bit long
+ */
+- (id)initWithStartNanoInstant:(HLNanoInstant)start 
+                endNanoInstant:(HLNanoInstant)end;
+
 /**
  * Creates a duration from the specified object using the
  * {@link org.joda.time.convert.ConverterManager ConverterManager}.
@@ -170,6 +192,14 @@
  */
 - (NSInteger)standardSeconds;
 
+/**
+ * Gets the length of this duration in nanoseconds.
+ *
+ * @return the length of the duration in nanoseconds
+ * @throws ArithmeticException if the length exceeds 292 years
+ */
+- (int64_t)standardNanos;
+
 //-----------------------------------------------------------------------
 /**
  * Get this duration as an immutable <code>Duration</code> object
@@ -198,7 +228,7 @@
  * @param duration  the new length of the duration
  * @return the new duration instance
  */
-- (HLDuration*)withMillis:(NSInteger)duration;
+- (HLDuration*)withMillis:(int64_t)duration;
 
 /**
  * Returns a new duration with this length plus that specified multiplied by the scalar.
@@ -210,7 +240,7 @@
  * @param scalar  the amount of times to add, such as -1 to subtract once
  * @return the new duration instance
  */
-- (HLDuration*)withDurationValueAdded:(NSInteger)durationToAdd 
+- (HLDuration*)withDurationValueAdded:(int64_t)durationToAdd 
                           usingScalar:(NSInteger)scalar;
 
 /**
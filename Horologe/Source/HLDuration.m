@@ -21,9 +21,35 @@
 
 #import "HLDuration.h"
 
+#import "HLFieldUtils.h"
+
 
 @implementation HLDuration
 
+//-----------------------------------------------------------------------
++ (HLDuration*)durationWithNanos:(int64_t)nanos {
+    return [[[HLDuration alloc] initWithDurationValue:HLFloorDivide(nanos, HL_NANOS_PER_MILLI)] autorelease];
+}
+
+- (id)initWithStartNanoInstant:(HLNanoInstant)start 
+                endNanoInstant:(HLNanoInstant)end {
+    int64_t millis = HLSafeSubtract(end.millis, start.millis);
+    if (end.nanoOfMilli < start.nanoOfMilli) {
+        millis = HLSafeSubtract(millis, 1);
+    }
+    return [self initWithDurationValue:millis];
+}
+
+//-----------------------------------------------------------------------
+- (int64_t)standardNanos {
+    return HLSafeMultiply([self millis], HL_NANOS_PER_MILLI);
+}
+
+@end
+
+
+@implementation Duration
+
 /*
  *  Copyright 2001-2005,2008 Stephen Colebourne
  *
@@ -86,7 +86,7 @@
  * @return the unit size of this field, in milliseconds
  * @see #isPrecise()
  */
-- (NSInteger)unitMillis;
+- (int64_t)unitMillis;
 
 //------------------------------------------------------------------------
 /**
@@ -98,7 +98,7 @@
  * negative
  * @throws ArithmeticException if the value is too large for an int
  */
-- (NSInteger)valueWithDuration:(NSInteger)duration;
+- (NSInteger)valueWithDuration:(int64_t)duration;
 
 /**
  * Get the value of this field from the milliseconds relative to an
@@ -114,8 +114,8 @@
  * negative
  * @throws ArithmeticException if the value is too large for an int
  */
-- (NSInteger)valueWithDuration:(NSInteger)duration 
-                       instant:(NSInteger)instant;
+- (NSInteger)valueWithDuration:(int64_t)duration 
+                       instant:(int64_t)instant;
 
 //------------------------------------------------------------------------
 /**
@@ -126,7 +126,7 @@
  * @return the milliseconds that the field represents, which may be
  * negative
  */
-- (NSInteger)millisWithValue:(NSInteger)value;
+- (int64_t)millisWithValue:(NSInteger)value;
 
 /**
  * Get the millisecond duration of this field from its value relative to an
@@ -141,8 +141,8 @@
  * @return the millisecond duration that the field represents, which may be
  * negative
  */
-- (NSInteger)millisWithValue:(NSInteger)value 
-                     instant:(NSInteger)instant;
+- (int64_t)millisWithValue:(NSInteger)value 
+                   instant:(int64_t)instant;
 
 /**
  * Get the millisecond duration of this field from its value relative to an
@@ -157,8 +157,8 @@
  * @return the millisecond duration that the field represents, which may be
  * negative
  */
-- (NSInteger)millisWithValue:(NSInteger)value 
-                     instant:(NSInteger)instant;
+- (int64_t)millisWithValue:(NSInteger)value 
+                   instant:(int64_t)instant;
 
 /**
  * Adds a duration value (which may be negative) to the instant.
@@ -167,8 +167,8 @@
  * @param value  the value to add, in the units of the field
  * @return the updated milliseconds
  */
-- (NSInteger)addInstant:(NSInteger)instant 
-                  value:(NSInteger)value;
+- (int64_t)addInstant:(int64_t)instant 
+                value:(NSInteger)value;
 
 /**
  * Subtracts a duration value (which may be negative) from the instant.
@@ -178,8 +178,8 @@
  * @return the updated milliseconds
  * @since 1.1
  */
-- (NSInteger)subtractValue:(NSInteger)value
-               fromInstant:(NSInteger)instant;
+- (int64_t)subtractValue:(NSInteger)value
+             fromInstant:(int64_t)instant;
 
 /**
  * Computes the difference between two instants, as measured in the units
@@ -200,8 +200,8 @@
  * subtract off the minuend
  * @return the difference in the units of this field
  */
-- (NSInteger)differenceBetweenMinuend:(NSInteger)minuendInstant 
-                           subtrahend:(NSInteger)subtrahendInstant;
+- (NSInteger)differenceBetweenMinuend:(int64_t)minuendInstant 
+                           subtrahend:(int64_t)subtrahendInstant;
 
 /**
  * Compares this duration field with another duration field for ascending
@@ -56,31 +56,34 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
 @implementation HLDurationFieldType
 
 + (void)initialize {
-    
-     HL_DURATION_FIELD_ERAS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"eras"
+    // runs again for each subclass, and the types must stay unique as
+    // they are compared by identity
+    if (self == [HLDurationFieldType class]) {
+        HL_DURATION_FIELD_ERAS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"eras"
                                                                                                               ordinal:HL_DURATION_FIELD_TYPE_ERAS];
-     HL_DURATION_FIELD_CENTURIES_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"centuries"
+        HL_DURATION_FIELD_CENTURIES_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"centuries"
                                                                                                              ordinal:HL_DURATION_FIELD_TYPE_CENTURIES];
-     HL_DURATION_FIELD_WEEKYEARS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"weekyears"
+        HL_DURATION_FIELD_WEEKYEARS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"weekyears"
                                                                                                              ordinal:HL_DURATION_FIELD_TYPE_WEEKYEARS];
-     HL_DURATION_FIELD_YEARS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"years"
+        HL_DURATION_FIELD_YEARS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"years"
                                                                                                          ordinal:HL_DURATION_FIELD_TYPE_YEARS];
-     HL_DURATION_FIELD_MONTHS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"months"
+        HL_DURATION_FIELD_MONTHS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"months"
                                                                                                           ordinal:HL_DURATION_FIELD_TYPE_MONTHS];
-    HL_DURATION_FIELD_WEEKS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"weeks"
+        HL_DURATION_FIELD_WEEKS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"weeks"
                                                                                                          ordinal:HL_DURATION_FIELD_TYPE_WEEKS];
-     HL_DURATION_FIELD_DAYS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"days"
+        HL_DURATION_FIELD_DAYS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"days"
                                                                                                         ordinal:HL_DURATION_FIELD_TYPE_DAYS];
-    HL_DURATION_FIELD_HALFDAYS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"halfdays"
+        HL_DURATION_FIELD_HALFDAYS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"halfdays"
                                                                                                             ordinal:HL_DURATION_FIELD_TYPE_HALFDAYS];
-    HL_DURATION_FIELD_HOURS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"hours"
+        HL_DURATION_FIELD_HOURS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"hours"
                                                                                                          ordinal:HL_DURATION_FIELD_TYPE_HOURS];
-    HL_DURATION_FIELD_MINUTES_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"minutes"
+        HL_DURATION_FIELD_MINUTES_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"minutes"
                                                                                                            ordinal:HL_DURATION_FIELD_TYPE_MINUTES];
-    HL_DURATION_FIELD_SECONDS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"seconds"
+        HL_DURATION_FIELD_SECONDS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"seconds"
                                                                                                            ordinal:HL_DURATION_FIELD_TYPE_SECONDS];
-    HL_DURATION_FIELD_MILLIS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"millis"
+        HL_DURATION_FIELD_MILLIS_TYPE = [[HLStandardDurationFieldType alloc] initWithName:@"millis"
                                                                                                           ordinal:HL_DURATION_FIELD_TYPE_MILLIS];
+    }
 }
 
 //-----------------------------------------------------------------------
@@ -103,7 +106,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)seconds {
++ (const HLDurationFieldType*)seconds {
     return HL_DURATION_FIELD_SECONDS_TYPE;
 }
 
@@ -112,7 +115,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)minutes {
++ (const HLDurationFieldType*)minutes {
     return HL_DURATION_FIELD_MINUTES_TYPE;
 }
 
@@ -121,7 +124,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)hours {
++ (const HLDurationFieldType*)hours {
     return HL_DURATION_FIELD_HOURS_TYPE;
 }
 
@@ -130,7 +133,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)halfdays {
++ (const HLDurationFieldType*)halfdays {
     return HL_DURATION_FIELD_HALFDAYS_TYPE;
 }
 
@@ -140,7 +143,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)days {
++ (const HLDurationFieldType*)days {
     return HL_DURATION_FIELD_DAYS_TYPE;
 }
 
@@ -149,7 +152,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)weeks {
++ (const HLDurationFieldType*)weeks {
     return HL_DURATION_FIELD_WEEKS_TYPE;
 }
 
@@ -158,7 +161,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)weekyears {
++ (const HLDurationFieldType*)weekyears {
     return HL_DURATION_FIELD_WEEKYEARS_TYPE;
 }
 
@@ -167,7 +170,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)months {
++ (const HLDurationFieldType*)months {
     return HL_DURATION_FIELD_MONTHS_TYPE;
 }
 
@@ -176,7 +179,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)years {
++ (const HLDurationFieldType*)years {
     return HL_DURATION_FIELD_YEARS_TYPE;
 }
 
@@ -185,7 +188,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)centuries {
++ (const HLDurationFieldType*)centuries {
     return HL_DURATION_FIELD_CENTURIES_TYPE;
 }
 
@@ -194,7 +197,7 @@ const HLDurationFieldType* HL_DURATION_FIELD_MILLIS_TYPE;
  * 
  * @return the DateTimeFieldType constant
  */
-- (const HLDurationFieldType*)eras {
++ (const HLDurationFieldType*)eras {
     return HL_DURATION_FIELD_ERAS_TYPE;
 }
 
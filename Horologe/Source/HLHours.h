@@ -62,7 +62,9 @@
 /**
  * Obtains an instance of <code>Hours</code> that may be cached.
  * <code>Hours</code> is immutable, so instances can be cached and shared.
- * This factory method provides access to shared instances.
+ * This factory method provides access to shared instances, which are
+ * preallocated for values from HL_PERIOD_POOL_MIN to HL_PERIOD_POOL_MAX,
+ * so arithmetic on small periods does not allocate.
  *
  * @param hours  the number of hours to obtain an instance for
  * @return the instance of Hours
@@ -306,7 +308,8 @@
  *
  * @param divisor  the amount to divide by, may be negative
  * @return the new period divided by the specified divisor
- * @throws ArithmeticException if the divisor is zero
+ * @throws ArithmeticException if the divisor is zero, or is -1 and the
+ *  result overflows an int
  */
 - (HLHours*)dividedBy:(NSInteger)divisor;
 
@@ -21,87 +21,133 @@
 
 #import "HLHours.h"
 
-
- HLHours* HL_HOURS_ZERO;
- HLHours* HL_HOURS_ONE;
- HLHours* HL_HOURS_TWO;
- HLHours* HL_HOURS_THREE;
- HLHours* HL_HOURS_FOUR;
- HLHours* HL_HOURS_FIVE;
- HLHours* HL_HOURS_SIX;
- HLHours* HL_HOURS_SEVEN;
- HLHours* HL_HOURS_EIGHT;
- HLHours* HL_HOURS_MAX_VALUE;
- HLHours* HL_HOURS_MIN_VALUE;
+#import "HLConstants.h"
+#import "HLFieldUtils.h"
+
+
+/** Constant representing zero hours. */
+const HLHours* HL_HOURS_ZERO;
+/** Constant representing one hour. */
+const HLHours* HL_HOURS_ONE;
+/** Constant representing two hours. */
+const HLHours* HL_HOURS_TWO;
+/** Constant representing three hours. */
+const HLHours* HL_HOURS_THREE;
+/** Constant representing four hours. */
+const HLHours* HL_HOURS_FOUR;
+/** Constant representing five hours. */
+const HLHours* HL_HOURS_FIVE;
+/** Constant representing six hours. */
+const HLHours* HL_HOURS_SIX;
+/** Constant representing seven hours. */
+const HLHours* HL_HOURS_SEVEN;
+/** Constant representing eight hours. */
+const HLHours* HL_HOURS_EIGHT;
+/** Constant representing the maximum number of hours that can be stored in this object. */
+const HLHours* HL_HOURS_MAX_VALUE;
+/** Constant representing the minimum number of hours that can be stored in this object. */
+const HLHours* HL_HOURS_MIN_VALUE;
+
+/** The shared instances for small numbers of hours. */
+static HLPeriodPool sHoursPool;
 
 @implementation HLHours
 
 + (void)initialize {
+    if (self == [HLHours class]) {
+        HLPeriodPoolFill(&sHoursPool, [HLHours class]);
+        HL_HOURS_ZERO = [HLHours hours:0];
+        HL_HOURS_ONE = [HLHours hours:1];
+        HL_HOURS_TWO = [HLHours hours:2];
+        HL_HOURS_THREE = [HLHours hours:3];
+        HL_HOURS_FOUR = [HLHours hours:4];
+        HL_HOURS_FIVE = [HLHours hours:5];
+        HL_HOURS_SIX = [HLHours hours:6];
+        HL_HOURS_SEVEN = [HLHours hours:7];
+        HL_HOURS_EIGHT = [HLHours hours:8];
+        HL_HOURS_MAX_VALUE = [[HLHours alloc] initWithPeriod:NSIntegerMax];
+        HL_HOURS_MIN_VALUE = [[HLHours alloc] initWithPeriod:NSIntegerMin];
+    }
+}
+
+//-----------------------------------------------------------------------
++ (HLHours*)hours:(NSInteger)hours {
+    HLHours* pooled = HLPeriodPoolValue(&sHoursPool, hours);
+    if (pooled != nil) {
+        return pooled;
+    }
+    switch (hours) {
+        case NSIntegerMax:
+            return (HLHours*) HL_HOURS_MAX_VALUE;
+        case NSIntegerMin:
+            return (HLHours*) HL_HOURS_MIN_VALUE;
+        default:
+            return [[[HLHours alloc] initWithPeriod:hours] autorelease];
+    }
+}
+
+//-----------------------------------------------------------------------
+- (HLHours*)plusHoursValue:(NSInteger)hours {
+    if (hours == 0) {
+        return self;
+    }
     
-    /** Constant representing zero hours. */    
-     HL_HOURS_ZERO = [[HLHours alloc] initWithPeriod:0];
-    /** Constant representing one hour. */
- HL_HOURS_ONE = [[HLHours alloc] initWithPeriod:1];
-    /** Constant representing two hours. */
- HL_HOURS_TWO = [[HLHours alloc] initWithPeriod:2];
-    /** Constant representing three hours. */
-HL_HOURS_THREE = [[HLHours alloc] initWithPeriod:3];
-    /** Constant representing four hours. */
-HL_HOURS_FOUR = [[HLHours alloc] initWithPeriod:4];
-    /** Constant representing five hours. */
-HL_HOURS_FIVE = [[HLHours alloc] initWithPeriod:5];
-    /** Constant representing six hours. */
-HL_HOURS_SIX = [[HLHours alloc] initWithPeriod:6];
-    /** Constant representing seven hours. */
- HL_HOURS_SEVEN = [[HLHours alloc] initWithPeriod:7];
-    /** Constant representing eight hours. */
-HL_HOURS_EIGHT = [[HLHours alloc] initWithPeriod:8];
-    /** Constant representing the maximum number of hours that can be stored in this object. */
- HL_HOURS_MAX_VALUE = [[HLHours alloc] initWithHours:NSIntegerMax];
-    /** Constant representing the minimum number of hours that can be stored in this object. */
-HL_HOURS_MIN_VALUE = [[HLHours alloc] initWithHours:NSIntegerMin];    
+    return [HLHours hours:HLSafeToInteger(HLSafeAdd([self value], hours))];
 }
 
-    /** The paser to use for this class. */
-    private static final PeriodFormatter PARSER = ISOPeriodFormat.standard().withParseType(PeriodType.hours());
+- (HLHours*)plusHours:(HLHours*)hours {
+    if (hours == nil) {
+        return self;
+    }
+    
+    return [self plusHoursValue:[hours value]];
+}
 
-    //-----------------------------------------------------------------------
-    /**
-     * Obtains an instance of <code>Hours</code> that may be cached.
-     * <code>Hours</code> is immutable, so instances can be cached and shared.
-     * This factory method provides access to shared instances.
-     *
-     * @param hours  the number of hours to obtain an instance for
-     * @return the instance of Hours
-     */
-    public static Hours hours:(NSInteger) hours) {
-        switch (hours) {
-            case 0:
-                return ZERO;
-            case 1:
-                return ONE;
-            case 2:
-                return TWO;
-            case 3:
-                return THREE;
-            case 4:
-                return FOUR;
-            case 5:
-                return FIVE;
-            case 6:
-                return SIX;
-            case 7:
-                return SEVEN;
-            case 8:
-                return EIGHT;
-            case Integer.MAX_VALUE:
-                return MAX_VALUE;
-            case Integer.MIN_VALUE:
-                return MIN_VALUE;
-            default:
-                return new Hours(hours);
-        }
+//-----------------------------------------------------------------------
+- (HLHours*)minusHoursValue:(NSInteger)hours {
+    return [self plusHoursValue:HLSafeToInteger(HLSafeNegate(hours))];
+}
+
+- (HLHours*)minusHours:(HLHours*)hours {
+    if (hours == nil) {
+        return self;
     }
+    
+    return [self minusHoursValue:[hours value]];
+}
+
+//-----------------------------------------------------------------------
+- (HLHours*)multipliedBy:(NSInteger)scalar {
+    return [HLHours hours:HLSafeToInteger(HLSafeMultiply([self value], scalar))];
+}
+
+- (HLHours*)dividedBy:(NSInteger)divisor {
+    if (divisor == 1) {
+        return self;
+    }
+    if (divisor == -1) {
+        // NSIntegerMin / -1 traps rather than wrapping, so check it as a negation
+        return [self negated];
+    }
+    if (divisor == 0) {
+        [NSException raise:HL_ARITHMETIC_EXCEPTION format:@"Division by zero"];
+    }
+    
+    return [HLHours hours:([self value] / divisor)];
+}
+
+//-----------------------------------------------------------------------
+- (HLHours*)negated {
+    return [HLHours hours:HLSafeToInteger(HLSafeNegate([self value]))];
+}
+
+@end
+
+
+@implementation Hours
+
+    /** The paser to use for this class. */
+    private static final PeriodFormatter PARSER = ISOPeriodFormat.standard().withParseType(PeriodType.hours());
 
     //-----------------------------------------------------------------------
     /**
@@ -337,111 +383,6 @@ HL_HOURS_MIN_VALUE = [[HLHours alloc] initWithHours:NSIntegerMin];
         return getValue();
     }
 
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the specified number of hours added.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param hours  the amount of hours to add, may be negative
-     * @return the new period plus the specified number of hours
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Hours plus:(NSInteger) hours) {
-        if (hours == 0) {
-            return this;
-        }
-        return Hours.hours(FieldUtils.safeAdd(getValue(), hours));
-    }
-
-    /**
-     * Returns a new instance with the specified number of hours added.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param hours  the amount of hours to add, may be negative, nil means zero
-     * @return the new period plus the specified number of hours
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Hours plus(Hours hours) {
-        if (hours == nil) {
-            return this;
-        }
-        return plus(hours.getValue());
-    }
-
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the specified number of hours taken away.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param hours  the amount of hours to take away, may be negative
-     * @return the new period minus the specified number of hours
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Hours minus:(NSInteger) hours) {
-        return plus(FieldUtils.safeNegate(hours));
-    }
-
-    /**
-     * Returns a new instance with the specified number of hours taken away.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param hours  the amount of hours to take away, may be negative, nil means zero
-     * @return the new period minus the specified number of hours
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Hours minus(Hours hours) {
-        if (hours == nil) {
-            return this;
-        }
-        return minus(hours.getValue());
-    }
-
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the hours multiplied by the specified scalar.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param scalar  the amount to multiply by, may be negative
-     * @return the new period multiplied by the specified scalar
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Hours multipliedBy:(NSInteger) scalar) {
-        return Hours.hours(FieldUtils.safeMultiply(getValue(), scalar));
-    }
-
-    /**
-     * Returns a new instance with the hours divided by the specified divisor.
-     * The calculation uses integer division, thus 3 divided by 2 is 1.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param divisor  the amount to divide by, may be negative
-     * @return the new period divided by the specified divisor
-     * @throws ArithmeticException if the divisor is zero
-     */
-    public Hours dividedBy:(NSInteger) divisor) {
-        if (divisor == 1) {
-            return this;
-        }
-        return Hours.hours(getValue() / divisor);
-    }
-
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the hours value negated.
-     *
-     * @return the new period with a negated value
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Hours negated {
-        return Hours.hours(FieldUtils.safeNegate(getValue()));
-    }
-
     //-----------------------------------------------------------------------
     /**
      * Is this hours instance greater than the specified number of hours.
@@ -61,7 +61,7 @@
     
 @private
     /** The millis from 1970-01-01T00:00:00Z */
-    NSInteger _iMillis;
+    int64_t _iMillis;
     
 }
 
@@ -71,7 +71,7 @@
  * 
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  */
-- (id)initWithInstantValue:(NSInteger)instant;
+- (id)initWithInstantValue:(int64_t)instant;
 
 /**
  * Constructs an instance from an Object that represents a datetime.
@@ -101,7 +101,7 @@
  * @param newMillis  the new millis, from 1970-01-01T00:00:00Z
  * @return a copy of this instant with different millis
  */
-- (HLInstant*)withMillis:(NSInteger)newMillis;
+- (HLInstant*)withMillis:(int64_t)newMillis;
 
 /**
  * Gets a copy of this instant with the specified duration added.
@@ -113,7 +113,7 @@
  * @return a copy of this instant with the duration added
  * @throws ArithmeticException if the new instant exceeds the capacity of a long
  */
-- (HLInstant*)withDurationValueAdded:(NSInteger)durationToAdd 
+- (HLInstant*)withDurationValueAdded:(int64_t)durationToAdd 
                     usingScalar:(NSInteger)scalar;
 
 /**
@@ -139,7 +139,7 @@
  * @return a copy of this instant with the duration added
  * @throws ArithmeticException if the new instant exceeds the capacity of a long
  */
-- (HLInstant*)plusDurationValue:(NSInteger)duration;
+- (HLInstant*)plusDurationValue:(int64_t)duration;
 
 /**
  * Gets a copy of this instant with the specified duration added.
@@ -162,7 +162,7 @@
  * @return a copy of this instant with the duration taken away
  * @throws ArithmeticException if the new instant exceeds the capacity of a long
  */
-- (HLInstant*)minusDurationValue:(NSInteger)duration;
+- (HLInstant*)minusDurationValue:(int64_t)duration;
 
 /**
  * Gets a copy of this instant with the specified duration taken away.
@@ -181,7 +181,7 @@
  * 
  * @return the number of milliseconds since 1970-01-01T00:00:00Z
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 /**
  * Gets the chronology of the instant, which is ISO in the UTC zone.
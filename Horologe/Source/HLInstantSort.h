@@ -0,0 +1,142 @@
+/*
+ * InstantSort.h
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#import <Foundation/Foundation.h>
+
+
+/*
+ * Instant sorting and searching
+ *
+ * These functions sort, search and merge instants as raw millis in
+ * contiguous arrays, so the work is integer operations on memory rather
+ * than a message send per comparison. The object variants extract the
+ * millis of each ReadableInstant once and then use the raw functions.
+ *
+ * - Sorting is a least significant digit radix sort, one pass per byte
+ *   of the millis. Passes over bytes that every value shares, such as the
+ *   high bytes of instants in the same decade, are skipped, so sorting
+ *   timestamps usually takes three to five passes. The sort is stable.
+ * - Searching is a binary search without branches on the comparison,
+ *   which the compiler turns into conditional moves, finished by a
+ *   counting scan over the last few values that vectorizes.
+ * - Merging combines sorted runs through a heap of the run heads. It is
+ *   stable: equal millis are taken from the earlier run first.
+ */
+
+/**
+ * Sorts millis in place into ascending order.
+ *
+ * @param millis  the millis to sort, not NULL unless count is zero
+ * @param count  the number of millis
+ */
+extern void HLInstantSortMillis(int64_t* millis, NSUInteger count);
+
+/**
+ * Computes the stable sorting permutation of millis, leaving them as they
+ * are. Entry i of the permutation is the index of the i-th smallest.
+ *
+ * @param millis  the millis to order, not NULL unless count is zero
+ * @param count  the number of millis
+ * @param permutation  receives count indexes, not NULL unless count is zero
+ */
+extern void HLInstantSortPermutation(const int64_t* millis, NSUInteger count, NSUInteger* permutation);
+
+/**
+ * Finds the first index of sorted millis with a value no less than millis.
+ *
+ * @param sorted  the ascending millis to search
+ * @param count  the number of millis
+ * @param millis  the millis to search for
+ * @return the index, count if every value is less
+ */
+extern NSUInteger HLInstantLowerBound(const int64_t* sorted, NSUInteger count, int64_t millis);
+
+/**
+ * Finds the first index of sorted millis with a value greater than millis.
+ *
+ * @param sorted  the ascending millis to search
+ * @param count  the number of millis
+ * @param millis  the millis to search for
+ * @return the index, count if no value is greater
+ */
+extern NSUInteger HLInstantUpperBound(const int64_t* sorted, NSUInteger count, int64_t millis);
+
+/**
+ * Merges sorted runs of millis into one sorted array.
+ *
+ * @param runs  the ascending runs, not NULL unless runCount is zero
+ * @param counts  the length of each run
+ * @param runCount  the number of runs
+ * @param merged  receives the millis of every run, sized for their total
+ * @param origins  receives the run each merged value came from, NULL if not wanted
+ * @return the number of millis merged
+ */
+extern NSUInteger HLInstantMergeRuns(const int64_t* const* runs,
+                                     const NSUInteger* counts,
+                                     NSUInteger runCount,
+                                     int64_t* merged,
+                                     NSUInteger* origins);
+
+//-----------------------------------------------------------------------
+/**
+ * Extracts the millis of instants into a buffer.
+ *
+ * @param instants  the instants, each a ReadableInstant, not nil
+ * @param millis  receives the millis of each instant, not NULL
+ */
+extern void HLInstantArrayGetMillis(NSArray* instants, int64_t* millis);
+
+/**
+ * Sorts instants by their millis. The sort is stable, so instants at the
+ * same millis in different chronologies keep their order.
+ *
+ * @param instants  the instants to sort, each a ReadableInstant, not nil
+ * @return a new sorted array
+ */
+extern NSArray* HLInstantArraySort(NSArray* instants);
+
+/**
+ * Finds the first index of sorted instants at or after millis.
+ *
+ * @param sorted  the instants in ascending order, each a ReadableInstant
+ * @param millis  the millis to search for
+ * @return the index, the count if every instant is before
+ */
+extern NSUInteger HLInstantArrayLowerBound(NSArray* sorted, int64_t millis);
+
+/**
+ * Finds the first index of sorted instants after millis.
+ *
+ * @param sorted  the instants in ascending order, each a ReadableInstant
+ * @param millis  the millis to search for
+ * @return the index, the count if no instant is after
+ */
+extern NSUInteger HLInstantArrayUpperBound(NSArray* sorted, int64_t millis);
+
+/**
+ * Merges sorted arrays of instants into one sorted array.
+ *
+ * @param sortedArrays  an array of ascending arrays of ReadableInstant, not nil
+ * @return a new sorted array of every instant
+ */
+extern NSArray* HLInstantArrayMerge(NSArray* sortedArrays);
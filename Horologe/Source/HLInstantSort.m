@@ -0,0 +1,394 @@
+/*
+ * InstantSort.m
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#import "HLInstantSort.h"
+
+#import "HLReadableInstant.h"
+
+
+/** Below this many values insertion sort beats the radix passes */
+#define HL_INSTANT_SORT_SMALL (48)
+/** The binary search hands over to a counting scan at this many values */
+#define HL_INSTANT_SEARCH_SCAN (16)
+
+/*
+ * Maps millis to unsigned keys with the same order.
+ */
+static inline uint64_t HLInstantSortKey(int64_t millis) {
+    return (uint64_t) millis ^ 0x8000000000000000ULL;
+}
+
+/*
+ * Counts every byte of the keys in one pass, returning a bit per byte
+ * position whose pass is needed, that is where the keys differ.
+ */
+static uint32_t HLInstantSortHistogram(const int64_t* millis,
+                                       NSUInteger count,
+                                       NSUInteger histogram[8][256]) {
+    memset(histogram, 0, 8 * 256 * sizeof(NSUInteger));
+    for(NSUInteger i = 0; i < count; i++) {
+        uint64_t key = HLInstantSortKey(millis[i]);
+        for(NSUInteger b = 0; b < 8; b++) {
+            histogram[b][(key >> (b * 8)) & 0xff]++;
+        }
+    }
+    uint64_t first = HLInstantSortKey(millis[0]);
+    uint32_t passes = 0;
+    for(NSUInteger b = 0; b < 8; b++) {
+        if (histogram[b][(first >> (b * 8)) & 0xff] != count) {
+            passes |= (1u << b);
+        }
+        // turn the counts into starting offsets
+        NSUInteger offset = 0;
+        for(NSUInteger v = 0; v < 256; v++) {
+            NSUInteger n = histogram[b][v];
+            histogram[b][v] = offset;
+            offset += n;
+        }
+    }
+    return passes;
+}
+
+void HLInstantSortMillis(int64_t* millis, NSUInteger count) {
+    if (count < HL_INSTANT_SORT_SMALL) {
+        for(NSUInteger i = 1; i < count; i++) {
+            int64_t value = millis[i];
+            NSUInteger j = i;
+            while (j > 0 && millis[j - 1] > value) {
+                millis[j] = millis[j - 1];
+                j--;
+            }
+            millis[j] = value;
+        }
+        return;
+    }
+    
+    NSUInteger (*histogram)[256] = malloc(8 * sizeof(*histogram));
+    uint32_t passes = HLInstantSortHistogram(millis, count, histogram);
+    int64_t* buffer = malloc(count * sizeof(int64_t));
+    int64_t* source = millis;
+    int64_t* target = buffer;
+    for(NSUInteger b = 0; b < 8; b++) {
+        if ((passes & (1u << b)) == 0) {
+            continue;
+        }
+        NSUInteger* offsets = histogram[b];
+        NSUInteger shift = b * 8;
+        for(NSUInteger i = 0; i < count; i++) {
+            int64_t value = source[i];
+            target[offsets[(HLInstantSortKey(value) >> shift) & 0xff]++] = value;
+        }
+        int64_t* swap = source;
+        source = target;
+        target = swap;
+    }
+    if (source != millis) {
+        memcpy(millis, source, count * sizeof(int64_t));
+    }
+    free(buffer);
+    free(histogram);
+}
+
+void HLInstantSortPermutation(const int64_t* millis, NSUInteger count, NSUInteger* permutation) {
+    if (count < HL_INSTANT_SORT_SMALL) {
+        for(NSUInteger i = 0; i < count; i++) {
+            NSUInteger j = i;
+            while (j > 0 && millis[permutation[j - 1]] > millis[i]) {
+                permutation[j] = permutation[j - 1];
+                j--;
+            }
+            permutation[j] = i;
+        }
+        return;
+    }
+    
+    NSUInteger (*histogram)[256] = malloc(8 * sizeof(*histogram));
+    uint32_t passes = HLInstantSortHistogram(millis, count, histogram);
+    // the keys travel with their indexes, so each pass reads them in order
+    int64_t* keys = malloc(2 * count * sizeof(int64_t));
+    NSUInteger* indexes = malloc(count * sizeof(NSUInteger));
+    int64_t* sourceKeys = keys;
+    int64_t* targetKeys = keys + count;
+    NSUInteger* sourceIndexes = permutation;
+    NSUInteger* targetIndexes = indexes;
+    memcpy(sourceKeys, millis, count * sizeof(int64_t));
+    for(NSUInteger i = 0; i < count; i++) {
+        sourceIndexes[i] = i;
+    }
+    for(NSUInteger b = 0; b < 8; b++) {
+        if ((passes & (1u << b)) == 0) {
+            continue;
+        }
+        NSUInteger* offsets = histogram[b];
+        NSUInteger shift = b * 8;
+        for(NSUInteger i = 0; i < count; i++) {
+            NSUInteger slot = offsets[(HLInstantSortKey(sourceKeys[i]) >> shift) & 0xff]++;
+            targetKeys[slot] = sourceKeys[i];
+            targetIndexes[slot] = sourceIndexes[i];
+        }
+        int64_t* swapKeys = sourceKeys;
+        sourceKeys = targetKeys;
+        targetKeys = swapKeys;
+        NSUInteger* swapIndexes = sourceIndexes;
+        sourceIndexes = targetIndexes;
+        targetIndexes = swapIndexes;
+    }
+    if (sourceIndexes != permutation) {
+        memcpy(permutation, sourceIndexes, count * sizeof(NSUInteger));
+    }
+    free(indexes);
+    free(keys);
+    free(histogram);
+}
+
+//-----------------------------------------------------------------------
+NSUInteger HLInstantLowerBound(const int64_t* sorted, NSUInteger count, int64_t millis) {
+    const int64_t* base = sorted;
+    NSUInteger n = count;
+    // the answer stays within base[0] to base[n], inclusive
+    while (n > HL_INSTANT_SEARCH_SCAN) {
+        NSUInteger half = n / 2;
+        base = (base[half] < millis ? base + half : base);
+        n -= half;
+    }
+    NSUInteger below = 0;
+    for(NSUInteger i = 0; i < n; i++) {
+        below += (base[i] < millis);
+    }
+    return (NSUInteger) (base - sorted) + below;
+}
+
+NSUInteger HLInstantUpperBound(const int64_t* sorted, NSUInteger count, int64_t millis) {
+    const int64_t* base = sorted;
+    NSUInteger n = count;
+    while (n > HL_INSTANT_SEARCH_SCAN) {
+        NSUInteger half = n / 2;
+        base = (base[half] <= millis ? base + half : base);
+        n -= half;
+    }
+    NSUInteger below = 0;
+    for(NSUInteger i = 0; i < n; i++) {
+        below += (base[i] <= millis);
+    }
+    return (NSUInteger) (base - sorted) + below;
+}
+
+//-----------------------------------------------------------------------
+/*
+ * Checks whether the head of run a sorts before that of run b, taking
+ * the earlier run first on equal millis.
+ */
+static inline BOOL HLInstantMergeBefore(const int64_t* const* runs,
+                                        const NSUInteger* positions,
+                                        NSUInteger a,
+                                        NSUInteger b) {
+    int64_t x = runs[a][positions[a]];
+    int64_t y = runs[b][positions[b]];
+    return x < y || (x == y && a < b);
+}
+
+static void HLInstantMergeSiftDown(NSUInteger* heap,
+                                   NSUInteger size,
+                                   NSUInteger i,
+                                   const int64_t* const* runs,
+                                   const NSUInteger* positions) {
+    while (YES) {
+        NSUInteger least = i;
+        NSUInteger left = 2 * i + 1;
+        NSUInteger right = left + 1;
+        if (left < size && HLInstantMergeBefore(runs, positions, heap[left], heap[least])) {
+            least = left;
+        }
+        if (right < size && HLInstantMergeBefore(runs, positions, heap[right], heap[least])) {
+            least = right;
+        }
+        if (least == i) {
+            return;
+        }
+        NSUInteger swap = heap[i];
+        heap[i] = heap[least];
+        heap[least] = swap;
+        i = least;
+    }
+}
+
+NSUInteger HLInstantMergeRuns(const int64_t* const* runs,
+                              const NSUInteger* counts,
+                              NSUInteger runCount,
+                              int64_t* merged,
+                              NSUInteger* origins) {
+    NSUInteger* positions = calloc(runCount > 0 ? runCount : 1, sizeof(NSUInteger));
+    NSUInteger* heap = malloc((runCount > 0 ? runCount : 1) * sizeof(NSUInteger));
+    NSUInteger size = 0;
+    for(NSUInteger r = 0; r < runCount; r++) {
+        if (counts[r] > 0) {
+            heap[size++] = r;
+        }
+    }
+    // heapify, sifting down each parent from the last
+    for(NSUInteger i = size / 2; i-- > 0; ) {
+        HLInstantMergeSiftDown(heap, size, i, runs, positions);
+    }
+    
+    NSUInteger written = 0;
+    while (size > 0) {
+        NSUInteger r = heap[0];
+        merged[written] = runs[r][positions[r]];
+        if (origins != NULL) {
+            origins[written] = r;
+        }
+        written++;
+        if (++positions[r] == counts[r]) {
+            heap[0] = heap[--size];
+        }
+        HLInstantMergeSiftDown(heap, size, 0, runs, positions);
+    }
+    free(heap);
+    free(positions);
+    return written;
+}
+
+//-----------------------------------------------------------------------
+void HLInstantArrayGetMillis(NSArray* instants, int64_t* millis) {
+    // look the getter up once per class rather than dispatching per object
+    SEL selector = @selector(millis);
+    Class lastClass = Nil;
+    int64_t (*getter)(id, SEL) = NULL;
+    NSUInteger i = 0;
+    for (id<HLReadableInstant> instant in instants) {
+        Class instantClass = [instant class];
+        if (instantClass != lastClass) {
+            getter = (int64_t (*)(id, SEL)) [(id) instant methodForSelector:selector];
+            lastClass = instantClass;
+        }
+        millis[i++] = getter(instant, selector);
+    }
+}
+
+NSArray* HLInstantArraySort(NSArray* instants) {
+    NSUInteger count = [instants count];
+    if (count < 2) {
+        return [NSArray arrayWithArray:instants];
+    }
+    int64_t* millis = malloc(count * sizeof(int64_t));
+    NSUInteger* permutation = malloc(count * sizeof(NSUInteger));
+    id* sorted = malloc(count * sizeof(id));
+    id* ordered = malloc(count * sizeof(id));
+    NSArray* result = nil;
+    @try {
+        // raises for an element that is not an instant
+        HLInstantArrayGetMillis(instants, millis);
+        HLInstantSortPermutation(millis, count, permutation);
+        
+        [instants getObjects:sorted range:NSMakeRange(0, count)];
+        for(NSUInteger i = 0; i < count; i++) {
+            ordered[i] = sorted[permutation[i]];
+        }
+        result = [NSArray arrayWithObjects:ordered count:count];
+    }
+    @finally {
+        free(ordered);
+        free(sorted);
+        free(permutation);
+        free(millis);
+    }
+    return result;
+}
+
+NSUInteger HLInstantArrayLowerBound(NSArray* sorted, int64_t millis) {
+    NSUInteger low = 0;
+    NSUInteger high = [sorted count];
+    while (low < high) {
+        NSUInteger mid = low + (high - low) / 2;
+        if ([[sorted objectAtIndex:mid] millis] < millis) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+NSUInteger HLInstantArrayUpperBound(NSArray* sorted, int64_t millis) {
+    NSUInteger low = 0;
+    NSUInteger high = [sorted count];
+    while (low < high) {
+        NSUInteger mid = low + (high - low) / 2;
+        if ([[sorted objectAtIndex:mid] millis] <= millis) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+NSArray* HLInstantArrayMerge(NSArray* sortedArrays) {
+    NSUInteger runCount = [sortedArrays count];
+    if (runCount == 0) {
+        return [NSArray array];
+    }
+    // zeroed so a raise part way through frees only the runs filled so far
+    int64_t** runs = calloc(runCount, sizeof(int64_t*));
+    NSUInteger* counts = calloc(runCount, sizeof(NSUInteger));
+    NSUInteger* cursors = calloc(runCount, sizeof(NSUInteger));
+    int64_t* merged = NULL;
+    NSUInteger* origins = NULL;
+    id* ordered = NULL;
+    NSArray* result = nil;
+    @try {
+        NSUInteger total = 0;
+        for(NSUInteger r = 0; r < runCount; r++) {
+            NSArray* run = [sortedArrays objectAtIndex:r];
+            counts[r] = [run count];
+            runs[r] = malloc((counts[r] > 0 ? counts[r] : 1) * sizeof(int64_t));
+            // raises for an element that is not an instant
+            HLInstantArrayGetMillis(run, runs[r]);
+            total += counts[r];
+        }
+        
+        merged = malloc((total > 0 ? total : 1) * sizeof(int64_t));
+        origins = malloc((total > 0 ? total : 1) * sizeof(NSUInteger));
+        HLInstantMergeRuns((const int64_t* const*) runs, counts, runCount, merged, origins);
+        
+        // each run is consumed in order, so a cursor per run finds the objects
+        ordered = malloc((total > 0 ? total : 1) * sizeof(id));
+        for(NSUInteger i = 0; i < total; i++) {
+            NSUInteger r = origins[i];
+            ordered[i] = [[sortedArrays objectAtIndex:r] objectAtIndex:cursors[r]++];
+        }
+        result = [NSArray arrayWithObjects:ordered count:total];
+    }
+    @finally {
+        free(ordered);
+        free(origins);
+        free(merged);
+        for(NSUInteger r = 0; r < runCount; r++) {
+            free(runs[r]);
+        }
+        free(cursors);
+        free(counts);
+        free(runs);
+    }
+    return result;
+}
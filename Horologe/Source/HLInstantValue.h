@@ -0,0 +1,474 @@
+/*
+ * InstantValue.h
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+#import <libkern/OSByteOrder.h>
+
+#import "HLFieldUtils.h"
+
+
+@class HLChronology;
+@class HLDateTime;
+@class HLDateTimeField;
+@class HLInstant;
+@protocol HLReadableInstant;
+
+/*
+ * Value types
+ *
+ * HLInstantValue and HLLocalDateValue are plain C structs holding the same
+ * information as HLInstant/HLDateTime and an ISO HLLocalDate without an
+ * object header or a retained chronology. They are intended for dense
+ * arrays, such as in-memory caches of timestamps. Instant values convert
+ * to and from the object API when a full object is needed; date values
+ * will once LocalDate is ported.
+ *
+ * The inline functions only need the instant itself and so work in UTC
+ * using the ISO calendar. Anything chronology or zone specific should go
+ * through the object API.
+ */
+
+/** The chronology identifier reserved for ISOChronology in UTC. */
+#define HL_CHRONOLOGY_ID_ISO_UTC (0)
+
+/** The largest number of distinct chronologies that can be identified. */
+#define HL_CHRONOLOGY_ID_CAPACITY (4096)
+
+/** The number of milliseconds in a standard day. */
+static const int64_t HLInstantValueMillisPerDay = 86400000LL;
+
+/**
+ * An instant in time together with the chronology it is viewed in.
+ */
+typedef struct {
+    /** The millis from 1970-01-01T00:00:00Z */
+    int64_t millis;
+    /** The chronology, as returned by HLChronologyIdentifier */
+    uint16_t chronoId;
+} HLInstantValue;
+
+/**
+ * A date without time or zone in the ISO calendar.
+ */
+typedef struct {
+    /** The number of days since 1970-01-01 */
+    int32_t epochDay;
+} HLLocalDateValue;
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the small integer identifying a chronology, registering it on first
+ * use. Equal chronologies share an identifier. This method is thread-safe,
+ * and takes a lock only the first time it sees a chronology object.
+ *
+ * @param chronology  the chronology, nil means ISOChronology in UTC
+ * @return the identifier of the chronology
+ * @throws IllegalArgumentException if too many chronologies are registered
+ */
+extern uint16_t HLChronologyIdentifier(HLChronology* chronology);
+
+/**
+ * Gets the chronology for an identifier returned by HLChronologyIdentifier.
+ *
+ * @param chronoId  the chronology identifier
+ * @return the chronology, nil if the identifier was never issued
+ */
+extern HLChronology* HLChronologyForIdentifier(uint16_t chronoId);
+
+//-----------------------------------------------------------------------
+static inline int64_t HLFloorDivide(int64_t value, int64_t divisor) {
+    int64_t quotient = value / divisor;
+    if ((value % divisor != 0) && ((value < 0) != (divisor < 0))) {
+        quotient--;
+    }
+    return quotient;
+}
+
+static inline HLInstantValue HLInstantValueMake(int64_t millis, uint16_t chronoId) {
+    HLInstantValue value;
+    value.millis = millis;
+    value.chronoId = chronoId;
+    return value;
+}
+
+/**
+ * Compares two instants on the timeline, ignoring chronology as
+ * HLAbstractInstant does.
+ */
+static inline NSComparisonResult HLInstantValueCompare(HLInstantValue value1, HLInstantValue value2) {
+    if (value1.millis < value2.millis) {
+        return NSOrderedAscending;
+    }
+    return value1.millis == value2.millis ? NSOrderedSame : NSOrderedDescending;
+}
+
+/**
+ * Checks whether two instants have both the same millis and chronology.
+ */
+static inline BOOL HLInstantValueEqual(HLInstantValue value1, HLInstantValue value2) {
+    return value1.millis == value2.millis && value1.chronoId == value2.chronoId;
+}
+
+static inline HLInstantValue HLInstantValuePlusMillis(HLInstantValue value, int64_t duration) {
+    return HLInstantValueMake(HLSafeAdd(value.millis, duration), value.chronoId);
+}
+
+static inline int64_t HLInstantValueMillisBetween(HLInstantValue start, HLInstantValue end) {
+    return HLSafeSubtract(end.millis, start.millis);
+}
+
+/**
+ * Gets the millisecond of the day in UTC, from 0 to 86399999.
+ */
+static inline int32_t HLInstantValueMillisOfDayUTC(HLInstantValue value) {
+    return (int32_t) (value.millis - HLFloorDivide(value.millis, HLInstantValueMillisPerDay) * HLInstantValueMillisPerDay);
+}
+
+/**
+ * Gets the ISO date of the instant in UTC.
+ *
+ * @throws ArithmeticException if the day is outside the int32 range of
+ *  HLLocalDateValue, beyond about 1.85e17 millis either side of 1970
+ */
+static inline HLLocalDateValue HLInstantValueDateUTC(HLInstantValue value) {
+    int64_t epochDay = HLFloorDivide(value.millis, HLInstantValueMillisPerDay);
+    if (__builtin_expect(epochDay < INT32_MIN || epochDay > INT32_MAX, 0)) {
+        HLRaiseArithmeticOverflow("(int32_t)", epochDay, 0);
+    }
+    HLLocalDateValue date;
+    date.epochDay = (int32_t) epochDay;
+    return date;
+}
+
+//-----------------------------------------------------------------------
+static inline HLLocalDateValue HLLocalDateValueMakeWithEpochDay(int32_t epochDay) {
+    HLLocalDateValue date;
+    date.epochDay = epochDay;
+    return date;
+}
+
+/**
+ * Creates a date from ISO year, month and day. The values are not
+ * validated, so they must not come from outside the program.
+ */
+static inline HLLocalDateValue HLLocalDateValueMake(int32_t year, int32_t monthOfYear, int32_t dayOfMonth) {
+    // days from civil, counting years from March so the leap day is last
+    int64_t y = (int64_t) year - (monthOfYear <= 2);
+    int64_t era = HLFloorDivide(y, 400);
+    int64_t yearOfEra = y - era * 400;
+    int64_t dayOfYear = (153 * (monthOfYear + (monthOfYear > 2 ? -3 : 9)) + 2) / 5 + dayOfMonth - 1;
+    int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return HLLocalDateValueMakeWithEpochDay((int32_t) (era * 146097 + dayOfEra - 719468));
+}
+
+/**
+ * Gets the ISO year, month and day of a date in one pass.
+ * Any of the out parameters may be NULL.
+ */
+static inline void HLLocalDateValueGetFields(HLLocalDateValue date, int32_t* year, int32_t* monthOfYear, int32_t* dayOfMonth) {
+    int64_t z = (int64_t) date.epochDay + 719468;
+    int64_t era = HLFloorDivide(z, 146097);
+    int64_t dayOfEra = z - era * 146097;
+    int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int64_t mp = (5 * dayOfYear + 2) / 153;
+    int32_t month = (int32_t) (mp < 10 ? mp + 3 : mp - 9);
+    if (year != NULL) {
+        *year = (int32_t) (yearOfEra + era * 400 + (month <= 2));
+    }
+    if (monthOfYear != NULL) {
+        *monthOfYear = month;
+    }
+    if (dayOfMonth != NULL) {
+        *dayOfMonth = (int32_t) (dayOfYear - (153 * mp + 2) / 5 + 1);
+    }
+}
+
+static inline int32_t HLLocalDateValueYear(HLLocalDateValue date) {
+    int32_t year;
+    HLLocalDateValueGetFields(date, &year, NULL, NULL);
+    return year;
+}
+
+static inline int32_t HLLocalDateValueMonthOfYear(HLLocalDateValue date) {
+    int32_t month;
+    HLLocalDateValueGetFields(date, NULL, &month, NULL);
+    return month;
+}
+
+static inline int32_t HLLocalDateValueDayOfMonth(HLLocalDateValue date) {
+    int32_t day;
+    HLLocalDateValueGetFields(date, NULL, NULL, &day);
+    return day;
+}
+
+/**
+ * Gets the ISO day of week, HL_DATETIME_MONDAY (1) to HL_DATETIME_SUNDAY (7).
+ */
+static inline int32_t HLLocalDateValueDayOfWeek(HLLocalDateValue date) {
+    // 1970-01-01 was a Thursday
+    int64_t shifted = (int64_t) date.epochDay + 3;
+    return (int32_t) (shifted - HLFloorDivide(shifted, 7) * 7) + 1;
+}
+
+static inline HLLocalDateValue HLLocalDateValuePlusDays(HLLocalDateValue date, int32_t days) {
+    // the sum of two int32 values cannot overflow in 64 bits
+    int64_t epochDay = (int64_t) date.epochDay + days;
+    if (__builtin_expect(epochDay < INT32_MIN || epochDay > INT32_MAX, 0)) {
+        HLRaiseArithmeticOverflow("+", date.epochDay, days);
+    }
+    return HLLocalDateValueMakeWithEpochDay((int32_t) epochDay);
+}
+
+static inline int32_t HLLocalDateValueDaysBetween(HLLocalDateValue start, HLLocalDateValue end) {
+    int64_t days = (int64_t) end.epochDay - start.epochDay;
+    if (__builtin_expect(days < INT32_MIN || days > INT32_MAX, 0)) {
+        HLRaiseArithmeticOverflow("-", end.epochDay, start.epochDay);
+    }
+    return (int32_t) days;
+}
+
+/**
+ * Gets the instant at the start of the date in UTC.
+ */
+static inline HLInstantValue HLLocalDateValueStartOfDayUTC(HLLocalDateValue date) {
+    return HLInstantValueMake((int64_t) date.epochDay * HLInstantValueMillisPerDay, HL_CHRONOLOGY_ID_ISO_UTC);
+}
+
+//-----------------------------------------------------------------------
+/*
+ * Extended instants
+ *
+ * HLNanoInstant extends an instant value with the nanosecond within its
+ * millisecond, for sources such as HLClockWallNanos that are more precise
+ * than the millisecond API. The millis are exactly those of the
+ * millisecond API, so a nano instant is viewed in a chronology or
+ * formatted by its millis, with the nanos carried alongside. The
+ * millisecond API itself is unchanged.
+ */
+
+/** The number of nanoseconds in a millisecond. */
+#define HL_NANOS_PER_MILLI (1000000)
+
+/**
+ * An instant in time with nanosecond precision, together with the
+ * chronology it is viewed in.
+ */
+typedef struct {
+    /** The millis from 1970-01-01T00:00:00Z */
+    int64_t millis;
+    /** The nanosecond of the millisecond, from 0 to 999999 */
+    int32_t nanoOfMilli;
+    /** The chronology, as returned by HLChronologyIdentifier */
+    uint16_t chronoId;
+} HLNanoInstant;
+
+/**
+ * Creates a nano instant. A nanosecond of millisecond outside 0 to 999999
+ * is carried into the millis.
+ */
+static inline HLNanoInstant HLNanoInstantMake(int64_t millis, int64_t nanoOfMilli, uint16_t chronoId) {
+    HLNanoInstant value;
+    value.millis = HLSafeAdd(millis, HLFloorDivide(nanoOfMilli, HL_NANOS_PER_MILLI));
+    value.nanoOfMilli = (int32_t) (nanoOfMilli - HLFloorDivide(nanoOfMilli, HL_NANOS_PER_MILLI) * HL_NANOS_PER_MILLI);
+    value.chronoId = chronoId;
+    return value;
+}
+
+/**
+ * Creates a nano instant in ISO UTC from a count of nanoseconds since
+ * 1970-01-01T00:00:00Z, which covers the years 1677 to 2262.
+ */
+static inline HLNanoInstant HLNanoInstantFromEpochNanos(int64_t nanos) {
+    return HLNanoInstantMake(0, nanos, HL_CHRONOLOGY_ID_ISO_UTC);
+}
+
+/**
+ * Gets the nanoseconds since 1970-01-01T00:00:00Z, raising
+ * HL_ARITHMETIC_EXCEPTION outside the years 1677 to 2262.
+ */
+static inline int64_t HLNanoInstantToEpochNanos(HLNanoInstant value) {
+    return HLSafeAdd(HLSafeMultiply(value.millis, HL_NANOS_PER_MILLI), value.nanoOfMilli);
+}
+
+/**
+ * Gets the millisecond part of a nano instant as an instant value.
+ */
+static inline HLInstantValue HLNanoInstantToInstantValue(HLNanoInstant value) {
+    return HLInstantValueMake(value.millis, value.chronoId);
+}
+
+/**
+ * Compares two nano instants on the timeline, ignoring chronology.
+ */
+static inline NSComparisonResult HLNanoInstantCompare(HLNanoInstant value1, HLNanoInstant value2) {
+    if (value1.millis != value2.millis) {
+        return value1.millis < value2.millis ? NSOrderedAscending : NSOrderedDescending;
+    }
+    if (value1.nanoOfMilli != value2.nanoOfMilli) {
+        return value1.nanoOfMilli < value2.nanoOfMilli ? NSOrderedAscending : NSOrderedDescending;
+    }
+    return NSOrderedSame;
+}
+
+/**
+ * Checks whether two nano instants have the same millis, nanos and chronology.
+ */
+static inline BOOL HLNanoInstantEqual(HLNanoInstant value1, HLNanoInstant value2) {
+    return value1.millis == value2.millis 
+        && value1.nanoOfMilli == value2.nanoOfMilli 
+        && value1.chronoId == value2.chronoId;
+}
+
+static inline HLNanoInstant HLNanoInstantPlusNanos(HLNanoInstant value, int64_t nanos) {
+    int64_t millis = HLSafeAdd(value.millis, HLFloorDivide(nanos, HL_NANOS_PER_MILLI));
+    return HLNanoInstantMake(millis, 
+                             value.nanoOfMilli + (nanos - HLFloorDivide(nanos, HL_NANOS_PER_MILLI) * HL_NANOS_PER_MILLI), 
+                             value.chronoId);
+}
+
+static inline HLNanoInstant HLNanoInstantPlusMillis(HLNanoInstant value, int64_t duration) {
+    value.millis = HLSafeAdd(value.millis, duration);
+    return value;
+}
+
+/**
+ * Gets the nanoseconds from start to end, raising HL_ARITHMETIC_EXCEPTION
+ * if they are more than 292 years apart.
+ */
+static inline int64_t HLNanoInstantNanosBetween(HLNanoInstant start, HLNanoInstant end) {
+    int64_t millis = HLSafeSubtract(end.millis, start.millis);
+    return HLSafeAdd(HLSafeMultiply(millis, HL_NANOS_PER_MILLI), end.nanoOfMilli - start.nanoOfMilli);
+}
+
+//-----------------------------------------------------------------------
+/*
+ * Serialization
+ *
+ * Instants are exchanged as 8 byte big-endian two's complement counts of
+ * milliseconds from 1970-01-01T00:00:00Z. The format does not depend on
+ * the width of NSInteger or the byte order of either side, so buffers
+ * written by a 32-bit device build are read unchanged by a 64-bit server.
+ * Chronology identifiers are local to a process and are never written.
+ */
+
+/** The number of bytes in a serialized instant. */
+#define HL_INSTANT_SERIALIZED_SIZE (8)
+
+static inline void HLInstantMillisEncode(int64_t millis, uint8_t* bytes) {
+    uint64_t bits = OSSwapHostToBigInt64((uint64_t) millis);
+    memcpy(bytes, &bits, sizeof(bits));
+}
+
+static inline int64_t HLInstantMillisDecode(const uint8_t* bytes) {
+    uint64_t bits;
+    memcpy(&bits, bytes, sizeof(bits));
+    return (int64_t) OSSwapBigToHostInt64(bits);
+}
+
+/**
+ * Serializes an array of instants.
+ *
+ * @param millis  the instants, in milliseconds from 1970-01-01T00:00:00Z
+ * @param count  the number of instants
+ * @return autoreleased data of count * HL_INSTANT_SERIALIZED_SIZE bytes
+ */
+extern NSData* HLInstantMillisArrayToData(const int64_t* millis, NSUInteger count);
+
+/**
+ * Deserializes an array of instants written by HLInstantMillisArrayToData.
+ *
+ * @param data  the serialized instants, not nil
+ * @param millis  the buffer to fill
+ * @param capacity  the number of instants the buffer can hold
+ * @return the number of instants read
+ * @throws IllegalArgumentException if the data is not a whole number of instants
+ */
+extern NSUInteger HLInstantMillisArrayFromData(NSData* data, int64_t* millis, NSUInteger capacity);
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the value of any readable instant.
+ *
+ * @param instant  the instant, nil means now
+ * @return the instant as a value
+ */
+extern HLInstantValue HLInstantValueFromInstant(id<HLReadableInstant> instant);
+
+/**
+ * Creates an HLInstant for the value, dropping the chronology.
+ *
+ * @param value  the instant value
+ * @return the autoreleased instant
+ */
+extern HLInstant* HLInstantValueToInstant(HLInstantValue value);
+
+/**
+ * Creates an HLDateTime for the value in its chronology.
+ *
+ * @param value  the instant value
+ * @return the autoreleased datetime
+ */
+extern HLDateTime* HLInstantValueToDateTime(HLInstantValue value);
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the current time as a nano instant in ISO UTC, read with
+ * HLClockWallNanos. It is not affected by the HLDateTimeUtils modes.
+ *
+ * @return the current nano instant
+ */
+extern HLNanoInstant HLNanoInstantNow(void);
+
+/**
+ * Adds a value to a field of a nano instant in its chronology, as
+ * HLDateTimeField addValue:toInstantValue: does. The nanosecond of
+ * millisecond is kept.
+ *
+ * @param value  the nano instant
+ * @param field  the field of the instant's chronology, not nil
+ * @param amount  the amount to add, in the units of the field
+ * @return the updated nano instant
+ */
+extern HLNanoInstant HLNanoInstantAddField(HLNanoInstant value, HLDateTimeField* field, NSInteger amount);
+
+/**
+ * Sets a field of a nano instant in its chronology, as HLDateTimeField
+ * set:value: does. The nanosecond of millisecond is kept.
+ *
+ * @param value  the nano instant
+ * @param field  the field of the instant's chronology, not nil
+ * @param fieldValue  the value to set, in the units of the field
+ * @return the updated nano instant
+ * @throws IllegalFieldValueException if the value is invalid
+ */
+extern HLNanoInstant HLNanoInstantSetField(HLNanoInstant value, HLDateTimeField* field, NSInteger fieldValue);
+
+/**
+ * Rounds a nano instant down to a field, as HLDateTimeField roundFloor:
+ * does. All fields are at least a millisecond long, so the nanosecond of
+ * millisecond is cleared.
+ *
+ * @param value  the nano instant
+ * @param field  the field of the instant's chronology, not nil
+ * @return the rounded nano instant
+ */
+extern HLNanoInstant HLNanoInstantRoundFloor(HLNanoInstant value, HLDateTimeField* field);
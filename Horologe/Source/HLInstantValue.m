@@ -0,0 +1,219 @@
+/*
+ * InstantValue.m
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "HLInstantValue.h"
+
+#import <libkern/OSAtomic.h>
+#import <pthread.h>
+
+#import "HLConstants.h"
+#import "HLClock.h"
+#import "HLChronology.h"
+#import "HLDateTime.h"
+#import "HLDateTimeField.h"
+#import "HLDateTimeUtils.h"
+#import "HLInstant.h"
+#import "HLReadableInstant.h"
+#import "HLISOChronology.h"
+
+
+/** The number of slots in the identity cache, a power of two */
+#define HL_CHRONOLOGY_CACHE_SIZE (1024)
+/** The number of slots a lookup probes before giving up on the cache */
+#define HL_CHRONOLOGY_CACHE_PROBES (8)
+
+/** The registered chronologies, indexed by identifier */
+static HLChronology* sChronologies[HL_CHRONOLOGY_ID_CAPACITY];
+/** The number of identifiers issued */
+static volatile uint32_t sChronologyCount = 0;
+/** Maps chronology to identifier by equality, guarded by sChronologyLock */
+static CFMutableDictionaryRef sChronologyIds = NULL;
+/** Serializes registration and writes to the identity cache */
+static pthread_mutex_t sChronologyLock = PTHREAD_MUTEX_INITIALIZER;
+/** Chronologies already identified, by pointer, read without the lock */
+static HLChronology* volatile sCachedChronologies[HL_CHRONOLOGY_CACHE_SIZE];
+/** The identifier of each cached chronology, written before its pointer */
+static uint16_t sCachedIds[HL_CHRONOLOGY_CACHE_SIZE];
+
+static inline NSUInteger HLChronologyCacheSlot(HLChronology* chronology, NSUInteger probe) {
+    // the low bits of an object pointer are always zero
+    return (((uintptr_t) chronology >> 4) + probe) & (HL_CHRONOLOGY_CACHE_SIZE - 1);
+}
+
+/*
+ * Remembers the identifier of a chronology pointer for the lock-free path.
+ * The cache retains the chronology, so its address is never reused by
+ * another object. Called with sChronologyLock held.
+ */
+static void HLChronologyCacheIdentifier(HLChronology* chronology, uint16_t chronoId) {
+    for(NSUInteger probe = 0; probe < HL_CHRONOLOGY_CACHE_PROBES; probe++) {
+        NSUInteger slot = HLChronologyCacheSlot(chronology, probe);
+        if (sCachedChronologies[slot] == chronology) {
+            return;
+        }
+        if (sCachedChronologies[slot] == nil) {
+            sCachedIds[slot] = chronoId;
+            // publish the identifier before the pointer that leads to it
+            OSMemoryBarrier();
+            sCachedChronologies[slot] = [chronology retain];
+            return;
+        }
+    }
+    // the neighbourhood is full, so this pointer always takes the lock
+}
+
+/*
+ * Looks a chronology up by equality, registering it if it is new.
+ * Called with sChronologyLock held.
+ */
+static uint16_t HLChronologyRegister(HLChronology* chronology) {
+    if (sChronologyIds == NULL) {
+        sChronologyIds = CFDictionaryCreateMutable(NULL, 0,
+                                                   &kCFTypeDictionaryKeyCallBacks,
+                                                   NULL);
+        HLChronology* isoUTC = [HLISOChronology instanceUTC];
+        sChronologies[HL_CHRONOLOGY_ID_ISO_UTC] = [isoUTC retain];
+        CFDictionarySetValue(sChronologyIds, isoUTC, (const void*) (uintptr_t) HL_CHRONOLOGY_ID_ISO_UTC);
+        HLChronologyCacheIdentifier(isoUTC, HL_CHRONOLOGY_ID_ISO_UTC);
+        OSMemoryBarrier();
+        sChronologyCount = 1;
+    }
+    
+    const void* found = NULL;
+    if (CFDictionaryGetValueIfPresent(sChronologyIds, chronology, &found)) {
+        return (uint16_t) (uintptr_t) found;
+    }
+    if (sChronologyCount >= HL_CHRONOLOGY_ID_CAPACITY) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"Too many chronologies to identify: %@", chronology];
+    }
+    uint16_t chronoId = (uint16_t) sChronologyCount;
+    sChronologies[chronoId] = [chronology retain];
+    CFDictionarySetValue(sChronologyIds, chronology, (const void*) (uintptr_t) chronoId);
+    // publish the slot before the count so readers never see an empty one
+    OSMemoryBarrier();
+    sChronologyCount = chronoId + 1;
+    return chronoId;
+}
+
+uint16_t HLChronologyIdentifier(HLChronology* chronology) {
+    if (chronology == nil) {
+        return HL_CHRONOLOGY_ID_ISO_UTC;
+    }
+    
+    // chronologies seen before, ISO UTC among them, are found by pointer
+    for(NSUInteger probe = 0; probe < HL_CHRONOLOGY_CACHE_PROBES; probe++) {
+        NSUInteger slot = HLChronologyCacheSlot(chronology, probe);
+        HLChronology* cached = sCachedChronologies[slot];
+        if (cached == chronology) {
+            // pairs with the barrier in HLChronologyCacheIdentifier
+            OSMemoryBarrier();
+            return sCachedIds[slot];
+        }
+        if (cached == nil) {
+            break;
+        }
+    }
+    
+    uint16_t chronoId;
+    pthread_mutex_lock(&sChronologyLock);
+    @try {
+        chronoId = HLChronologyRegister(chronology);
+        HLChronologyCacheIdentifier(chronology, chronoId);
+    }
+    @finally {
+        pthread_mutex_unlock(&sChronologyLock);
+    }
+    return chronoId;
+}
+
+HLChronology* HLChronologyForIdentifier(uint16_t chronoId) {
+    if (chronoId == HL_CHRONOLOGY_ID_ISO_UTC) {
+        return [HLISOChronology instanceUTC];
+    }
+    if (chronoId >= sChronologyCount) {
+        return nil;
+    }
+    // pairs with the barrier before the count is raised
+    OSMemoryBarrier();
+    return sChronologies[chronoId];
+}
+
+//-----------------------------------------------------------------------
+HLInstantValue HLInstantValueFromInstant(id<HLReadableInstant> instant) {
+    return HLInstantValueMake([HLDateTimeUtils instantMillis:instant],
+                              HLChronologyIdentifier([HLDateTimeUtils instantChronology:instant]));
+}
+
+HLInstant* HLInstantValueToInstant(HLInstantValue value) {
+    return [[[HLInstant alloc] initWithInstantValue:value.millis] autorelease];
+}
+
+HLDateTime* HLInstantValueToDateTime(HLInstantValue value) {
+    return [[[HLDateTime alloc] initWithInstantValue:value.millis
+                                          chronology:HLChronologyForIdentifier(value.chronoId)] autorelease];
+}
+
+//-----------------------------------------------------------------------
+NSData* HLInstantMillisArrayToData(const int64_t* millis, NSUInteger count) {
+    NSMutableData* data = [NSMutableData dataWithLength:count * HL_INSTANT_SERIALIZED_SIZE];
+    uint8_t* bytes = [data mutableBytes];
+    for(NSUInteger i = 0; i < count; i++) {
+        HLInstantMillisEncode(millis[i], bytes + i * HL_INSTANT_SERIALIZED_SIZE);
+    }
+    return data;
+}
+
+NSUInteger HLInstantMillisArrayFromData(NSData* data, int64_t* millis, NSUInteger capacity) {
+    NSUInteger length = [data length];
+    if (length % HL_INSTANT_SERIALIZED_SIZE != 0) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"Serialized instants must be a multiple of %d bytes: %lu",
+         HL_INSTANT_SERIALIZED_SIZE, (unsigned long) length];
+    }
+    NSUInteger count = MIN(length / HL_INSTANT_SERIALIZED_SIZE, capacity);
+    const uint8_t* bytes = [data bytes];
+    for(NSUInteger i = 0; i < count; i++) {
+        millis[i] = HLInstantMillisDecode(bytes + i * HL_INSTANT_SERIALIZED_SIZE);
+    }
+    return count;
+}
+
+//-----------------------------------------------------------------------
+HLNanoInstant HLNanoInstantNow(void) {
+    return HLNanoInstantFromEpochNanos(HLClockWallNanos());
+}
+
+HLNanoInstant HLNanoInstantAddField(HLNanoInstant value, HLDateTimeField* field, NSInteger amount) {
+    value.millis = [field addValue:amount toInstantValue:value.millis];
+    return value;
+}
+
+HLNanoInstant HLNanoInstantSetField(HLNanoInstant value, HLDateTimeField* field, NSInteger fieldValue) {
+    value.millis = [field set:value.millis value:fieldValue];
+    return value;
+}
+
+HLNanoInstant HLNanoInstantRoundFloor(HLNanoInstant value, HLDateTimeField* field) {
+    value.millis = [field roundFloor:value.millis];
+    value.nanoOfMilli = 0;
+    return value;
+}
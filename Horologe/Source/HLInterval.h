@@ -69,8 +69,8 @@
  * @param endInstant  end of this interval, as milliseconds from 1970-01-01T00:00:00Z.
  * @throws IllegalArgumentException if the end is before the start
  */
-- (id)initWithStart:(NSInteger)startInstant 
-                end:(NSInteger)endInstant;
+- (id)initWithStart:(int64_t)startInstant 
+                end:(int64_t)endInstant;
 
 /**
  * Constructs an interval from a start and end instant with the ISO
@@ -82,8 +82,8 @@
  * @throws IllegalArgumentException if the end is before the start
  * @since 1.5
  */
-- (id)initWithStart:(NSInteger)startInstant 
-                end:(NSInteger)endInstant
+- (id)initWithStart:(int64_t)startInstant 
+                end:(int64_t)endInstant
                zone:(HLDateTimeZone*)zone;
 
 /**
@@ -95,8 +95,8 @@
  * @param endInstant  end of this interval, as milliseconds from 1970-01-01T00:00:00Z.
  * @throws IllegalArgumentException if the end is before the start
  */
-- (id)initWithStart:(NSInteger)startInstant 
-                end:(NSInteger)endInstant
+- (id)initWithStart:(int64_t)startInstant 
+                end:(int64_t)endInstant
          chronology:(HLChronology*)chronology;
 
 /**
@@ -311,7 +311,7 @@
  * @return an interval with the end from this interval and the specified start
  * @throws IllegalArgumentException if the resulting interval has end before start
  */
-- (HLInterval*)withStartMillis:(NSInteger)startInstant;
+- (HLInterval*)withStartMillis:(int64_t)startInstant;
 
 /**
  * Creates a new interval with the specified start instant.
@@ -329,7 +329,7 @@
  * @return an interval with the start from this interval and the specified end
  * @throws IllegalArgumentException if the resulting interval has end before start
  */
-- (HLInterval*)withEndMillis:(NSInteger)endInstant;
+- (HLInterval*)withEndMillis:(int64_t)endInstant;
 
 /**
  * Creates a new interval with the specified end instant.
@@ -0,0 +1,205 @@
+/*
+ * IntervalIndex.h
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#import <Foundation/Foundation.h>
+
+
+@protocol HLReadableInterval;
+struct HLIntervalRun;
+
+/** The most sorted runs an index holds, enough for any count of intervals */
+#define HL_INTERVAL_INDEX_MAX_RUNS (64)
+
+/**
+ * IntervalIndex answers overlap, stabbing and containment queries over a
+ * large set of intervals in O(log n + k) rather than by comparing each one.
+ * <p>
+ * The intervals are held as start and end millis, with an identifier that
+ * is returned by the queries, typically the position of the interval in
+ * the caller's own storage. As for Interval, each is inclusive of its start
+ * and exclusive of its end, and the queries match as the pairwise methods
+ * of ReadableInterval would.
+ * <p>
+ * The index is an interval tree laid out implicitly in an array sorted by
+ * start, where each entry also records the greatest end below it, so a
+ * query is a binary descent over contiguous memory with no node pointers.
+ * Building from arrays sorts once and is O(n log n). Adding keeps a stack
+ * of such sorted runs whose sizes halve towards the top, merging runs of
+ * equal size as a binary counter does, so adding is O(log n) amortized and
+ * queries visit at most one run per bit of the count.
+ * <p>
+ * IntervalIndex is thread-safe for queries, but not while intervals are
+ * being added.
+ */
+@interface HLIntervalIndex : NSObject {
+    
+@private
+    struct HLIntervalRun* _iRuns;
+    NSUInteger _iRunCount;
+    NSUInteger _iCount;
+    
+}
+
+//-----------------------------------------------------------------------
+/**
+ * Creates an empty index, for intervals to be added to.
+ */
+- (id)init;
+
+/**
+ * Creates an index of intervals given as parallel arrays of millis.
+ *
+ * @param starts  the start millis of each interval, not NULL unless count is zero
+ * @param ends  the end millis of each interval, not NULL unless count is zero
+ * @param identifiers  the identifier of each interval, NULL means the array positions
+ * @param count  the number of intervals
+ * @throws IllegalArgumentException if an end is before its start
+ */
+- (id)initWithStartMillis:(const int64_t*)starts
+                endMillis:(const int64_t*)ends
+              identifiers:(const NSUInteger*)identifiers
+                    count:(NSUInteger)count;
+
+/**
+ * Creates an index of intervals, each identified by its array position.
+ *
+ * @param intervals  the intervals, each a ReadableInterval, not nil
+ */
+- (id)initWithIntervals:(NSArray*)intervals;
+
+//-----------------------------------------------------------------------
+/**
+ * Adds an interval to the index.
+ *
+ * @param start  the start millis, inclusive
+ * @param end  the end millis, exclusive
+ * @param identifier  the identifier the queries will return for it
+ * @throws IllegalArgumentException if the end is before the start
+ */
+- (void)addStartMillis:(int64_t)start
+             endMillis:(int64_t)end
+            identifier:(NSUInteger)identifier;
+
+/**
+ * Adds an interval to the index.
+ *
+ * @param interval  the interval to add, not nil
+ * @param identifier  the identifier the queries will return for it
+ */
+- (void)addInterval:(id<HLReadableInterval>)interval
+         identifier:(NSUInteger)identifier;
+
+/**
+ * Gets the number of intervals in the index.
+ *
+ * @return the count of intervals
+ */
+- (NSUInteger)count;
+
+//-----------------------------------------------------------------------
+/*
+ * The queries below write the identifiers of the matching intervals to a
+ * buffer in no particular order. They return the total number of matches,
+ * which may be more than the capacity, in which case only the first
+ * capacity identifiers are written and the query can be repeated with a
+ * larger buffer.
+ */
+
+/**
+ * Finds the intervals that contain an instant, as containsInstant: would.
+ *
+ * @param instant  the instant millis
+ * @param buffer  receives the identifiers, may be NULL if capacity is zero
+ * @param capacity  the number of identifiers the buffer can hold
+ * @return the number of matching intervals
+ */
+- (NSUInteger)identifiersContainingInstant:(int64_t)instant
+                                intoBuffer:(NSUInteger*)buffer
+                                  capacity:(NSUInteger)capacity;
+
+/**
+ * Finds the intervals that overlap an interval, as overlapsInterval:
+ * would. Intervals that only abut it, and zero duration intervals at its
+ * start, do not overlap.
+ *
+ * @param start  the start millis of the query interval, inclusive
+ * @param end  the end millis of the query interval, exclusive
+ * @param buffer  receives the identifiers, may be NULL if capacity is zero
+ * @param capacity  the number of identifiers the buffer can hold
+ * @return the number of matching intervals
+ */
+- (NSUInteger)identifiersOverlappingStartMillis:(int64_t)start
+                                      endMillis:(int64_t)end
+                                     intoBuffer:(NSUInteger*)buffer
+                                       capacity:(NSUInteger)capacity;
+
+/**
+ * Finds the intervals that contain the whole of an interval, as
+ * containsInterval: called on each of them would.
+ *
+ * @param start  the start millis of the query interval, inclusive
+ * @param end  the end millis of the query interval, exclusive
+ * @param buffer  receives the identifiers, may be NULL if capacity is zero
+ * @param capacity  the number of identifiers the buffer can hold
+ * @return the number of matching intervals
+ */
+- (NSUInteger)identifiersContainingStartMillis:(int64_t)start
+                                     endMillis:(int64_t)end
+                                    intoBuffer:(NSUInteger*)buffer
+                                      capacity:(NSUInteger)capacity;
+
+/**
+ * Finds the intervals that lie wholly within an interval, as
+ * containsInterval: called on the query interval would. This visits every
+ * interval that starts within the query interval, so it is O(log n + k)
+ * only in the number of those.
+ *
+ * @param start  the start millis of the query interval, inclusive
+ * @param end  the end millis of the query interval, exclusive
+ * @param buffer  receives the identifiers, may be NULL if capacity is zero
+ * @param capacity  the number of identifiers the buffer can hold
+ * @return the number of matching intervals
+ */
+- (NSUInteger)identifiersContainedInStartMillis:(int64_t)start
+                                      endMillis:(int64_t)end
+                                     intoBuffer:(NSUInteger*)buffer
+                                       capacity:(NSUInteger)capacity;
+
+/**
+ * Checks whether any interval overlaps an interval, stopping at the first.
+ *
+ * @param start  the start millis of the query interval, inclusive
+ * @param end  the end millis of the query interval, exclusive
+ * @return true if an interval in the index overlaps the query interval
+ */
+- (BOOL)overlapsStartMillis:(int64_t)start
+                  endMillis:(int64_t)end;
+
+/**
+ * Finds the intervals that overlap an interval.
+ *
+ * @param interval  the query interval, nil means a zero duration interval now
+ * @return the identifiers of the overlapping intervals
+ */
+- (NSIndexSet*)identifiersOverlappingInterval:(id<HLReadableInterval>)interval;
+
+@end
@@ -0,0 +1,474 @@
+/*
+ * IntervalIndex.m
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#import "HLIntervalIndex.h"
+
+#import "HLConstants.h"
+#import "HLDateTimeUtils.h"
+#import "HLReadableInterval.h"
+
+
+/*
+ * An interval in a run. The runs are sorted by start, and form an implicit
+ * tree in which the entry at index i is a node of level L, where L is the
+ * number of trailing one bits of i. Leaves are the even indexes, and the
+ * children of a node i of level L > 0 are i - 2^(L-1) and i + 2^(L-1).
+ * maxEnd is the greatest end in the subtree of the entry.
+ */
+typedef struct {
+    int64_t start;
+    int64_t end;
+    int64_t maxEnd;
+    NSUInteger identifier;
+} HLIntervalEntry;
+
+struct HLIntervalRun {
+    HLIntervalEntry* entries;
+    NSUInteger count;
+    /** The level of the root, or -1 if the run is empty */
+    NSInteger maxLevel;
+};
+typedef struct HLIntervalRun HLIntervalRun;
+
+/** Subtrees of this level or below are scanned rather than descended */
+#define HL_INTERVAL_SCAN_LEVEL (3)
+
+/*
+ * Collects the identifiers found by a query.
+ */
+typedef struct {
+    NSUInteger* buffer;
+    NSUInteger capacity;
+    NSUInteger found;
+    BOOL stopAtFirst;
+} HLIntervalMatches;
+
+/*
+ * Records a match, returning whether the query should go on.
+ */
+static inline BOOL HLIntervalMatchesAdd(HLIntervalMatches* matches, NSUInteger identifier) {
+    if (matches->found < matches->capacity) {
+        matches->buffer[matches->found] = identifier;
+    }
+    matches->found++;
+    return !matches->stopAtFirst;
+}
+
+static int HLIntervalEntryCompare(const void* lhs, const void* rhs) {
+    const HLIntervalEntry* a = lhs;
+    const HLIntervalEntry* b = rhs;
+    if (a->start != b->start) {
+        return a->start < b->start ? -1 : 1;
+    }
+    if (a->end != b->end) {
+        return a->end < b->end ? -1 : 1;
+    }
+    return 0;
+}
+
+/*
+ * Sets maxEnd throughout a run sorted by start, returning the root level.
+ * The tree is complete only when the count is one less than a power of
+ * two; beyond the count, the rightmost existing node stands in for the
+ * missing right children.
+ */
+static NSInteger HLIntervalRunIndex(HLIntervalEntry* entries, NSUInteger count) {
+    if (count == 0) {
+        return -1;
+    }
+    NSUInteger lastIndex = 0;
+    int64_t last = 0;
+    for(NSUInteger i = 0; i < count; i += 2) {
+        lastIndex = i;
+        last = entries[i].maxEnd = entries[i].end;
+    }
+    NSInteger level;
+    for(level = 1; ((NSUInteger) 1 << level) <= count; level++) {
+        NSUInteger half = (NSUInteger) 1 << (level - 1);
+        NSUInteger first = (half << 1) - 1;
+        NSUInteger step = half << 2;
+        for(NSUInteger i = first; i < count; i += step) {
+            int64_t leftEnd = entries[i - half].maxEnd;
+            int64_t rightEnd = (i + half < count ? entries[i + half].maxEnd : last);
+            int64_t maxEnd = entries[i].end;
+            if (leftEnd > maxEnd) {
+                maxEnd = leftEnd;
+            }
+            if (rightEnd > maxEnd) {
+                maxEnd = rightEnd;
+            }
+            entries[i].maxEnd = maxEnd;
+        }
+        // move to the parent of the rightmost node
+        lastIndex = ((lastIndex >> level) & 1) ? lastIndex - half : lastIndex + half;
+        if (lastIndex < count && entries[lastIndex].maxEnd > last) {
+            last = entries[lastIndex].maxEnd;
+        }
+    }
+    return level - 1;
+}
+
+/*
+ * Finds the entries of a run with start < end, start < entry end, and
+ * entry end >= minEnd, returning NO if the query was stopped.
+ */
+static BOOL HLIntervalRunOverlaps(const HLIntervalRun* run,
+                                  int64_t start,
+                                  int64_t end,
+                                  int64_t minEnd,
+                                  HLIntervalMatches* matches) {
+    if (run->count == 0) {
+        return YES;
+    }
+    const HLIntervalEntry* entries = run->entries;
+    NSUInteger count = run->count;
+    struct {
+        NSInteger level;
+        NSUInteger index;
+        BOOL leftDone;
+    } stack[HL_INTERVAL_INDEX_MAX_RUNS + 2];
+    NSInteger depth = 0;
+    stack[depth].level = run->maxLevel;
+    stack[depth].index = ((NSUInteger) 1 << run->maxLevel) - 1;
+    stack[depth++].leftDone = NO;
+    
+    while (depth > 0) {
+        NSInteger level = stack[--depth].level;
+        NSUInteger index = stack[depth].index;
+        BOOL leftDone = stack[depth].leftDone;
+        
+        if (level <= HL_INTERVAL_SCAN_LEVEL) {
+            NSUInteger first = index >> level << level;
+            NSUInteger limit = first + ((NSUInteger) 1 << (level + 1)) - 1;
+            if (limit > count) {
+                limit = count;
+            }
+            for(NSUInteger i = first; i < limit && entries[i].start < end; i++) {
+                if (start < entries[i].end && entries[i].end >= minEnd) {
+                    if (!HLIntervalMatchesAdd(matches, entries[i].identifier)) {
+                        return NO;
+                    }
+                }
+            }
+        } else if (!leftDone) {
+            NSUInteger left = index - ((NSUInteger) 1 << (level - 1));
+            stack[depth].level = level;
+            stack[depth].index = index;
+            stack[depth++].leftDone = YES;
+            // the left child may be beyond the count, standing for a subtree
+            // that ends there
+            if (left >= count || entries[left].maxEnd > start) {
+                stack[depth].level = level - 1;
+                stack[depth].index = left;
+                stack[depth++].leftDone = NO;
+            }
+        } else if (index < count && entries[index].start < end) {
+            if (start < entries[index].end && entries[index].end >= minEnd) {
+                if (!HLIntervalMatchesAdd(matches, entries[index].identifier)) {
+                    return NO;
+                }
+            }
+            stack[depth].level = level - 1;
+            stack[depth].index = index + ((NSUInteger) 1 << (level - 1));
+            stack[depth++].leftDone = NO;
+        }
+    }
+    return YES;
+}
+
+/*
+ * Finds the entries of a run with start <= entry start < end and
+ * entry end <= end.
+ */
+static void HLIntervalRunContainedIn(const HLIntervalRun* run,
+                                     int64_t start,
+                                     int64_t end,
+                                     HLIntervalMatches* matches) {
+    const HLIntervalEntry* entries = run->entries;
+    NSUInteger low = 0;
+    NSUInteger high = run->count;
+    while (low < high) {
+        NSUInteger mid = low + (high - low) / 2;
+        if (entries[mid].start < start) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    for(NSUInteger i = low; i < run->count && entries[i].start < end; i++) {
+        if (entries[i].end <= end) {
+            HLIntervalMatchesAdd(matches, entries[i].identifier);
+        }
+    }
+}
+
+static void HLIntervalCheckEntry(int64_t start, int64_t end) {
+    if (end < start) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"The end instant must be greater or equal to the start"];
+    }
+}
+
+@implementation HLIntervalIndex
+
+//-----------------------------------------------------------------------
+- (id)init {
+    self = [super init];
+    if(self) {
+        _iRuns = calloc(HL_INTERVAL_INDEX_MAX_RUNS, sizeof(HLIntervalRun));
+        _iRunCount = 0;
+        _iCount = 0;
+    }
+    
+    return self;
+}
+
+- (id)initWithStartMillis:(const int64_t*)starts
+                endMillis:(const int64_t*)ends
+              identifiers:(const NSUInteger*)identifiers
+                    count:(NSUInteger)count {
+    self = [self init];
+    if(self) {
+        if (count == 0) {
+            return self;
+        }
+        for(NSUInteger i = 0; i < count; i++) {
+            HLIntervalCheckEntry(starts[i], ends[i]);
+        }
+        HLIntervalEntry* entries = malloc(count * sizeof(HLIntervalEntry));
+        for(NSUInteger i = 0; i < count; i++) {
+            entries[i].start = starts[i];
+            entries[i].end = ends[i];
+            entries[i].identifier = (identifiers != NULL ? identifiers[i] : i);
+        }
+        qsort(entries, count, sizeof(HLIntervalEntry), HLIntervalEntryCompare);
+        _iRuns[0].entries = entries;
+        _iRuns[0].count = count;
+        _iRuns[0].maxLevel = HLIntervalRunIndex(entries, count);
+        _iRunCount = 1;
+        _iCount = count;
+    }
+    
+    return self;
+}
+
+- (id)initWithIntervals:(NSArray*)intervals {
+    NSUInteger count = [intervals count];
+    int64_t* starts = malloc((count > 0 ? count : 1) * sizeof(int64_t));
+    int64_t* ends = malloc((count > 0 ? count : 1) * sizeof(int64_t));
+    NSUInteger i = 0;
+    for (id<HLReadableInterval> interval in intervals) {
+        starts[i] = [interval startMillis];
+        ends[i] = [interval endMillis];
+        i++;
+    }
+    self = [self initWithStartMillis:starts
+                           endMillis:ends
+                         identifiers:NULL
+                               count:count];
+    free(starts);
+    free(ends);
+    return self;
+}
+
+- (void)dealloc {
+    for(NSUInteger i = 0; i < _iRunCount; i++) {
+        free(_iRuns[i].entries);
+    }
+    free(_iRuns);
+    [super dealloc];
+}
+
+//-----------------------------------------------------------------------
+- (void)addStartMillis:(int64_t)start
+             endMillis:(int64_t)end
+            identifier:(NSUInteger)identifier {
+    HLIntervalCheckEntry(start, end);
+    
+    HLIntervalEntry* entries = malloc(sizeof(HLIntervalEntry));
+    entries[0].start = start;
+    entries[0].end = end;
+    entries[0].maxEnd = end;
+    entries[0].identifier = identifier;
+    HLIntervalRun* top = &_iRuns[_iRunCount++];
+    top->entries = entries;
+    top->count = 1;
+    top->maxLevel = 0;
+    _iCount++;
+    
+    // merge runs of equal or greater size, so the sizes strictly decrease
+    // towards the top and there are at most log2(count) + 1 of them
+    while (_iRunCount > 1 && _iRuns[_iRunCount - 1].count >= _iRuns[_iRunCount - 2].count) {
+        HLIntervalRun* upper = &_iRuns[_iRunCount - 1];
+        HLIntervalRun* lower = &_iRuns[_iRunCount - 2];
+        NSUInteger count = lower->count + upper->count;
+        HLIntervalEntry* merged = malloc(count * sizeof(HLIntervalEntry));
+        NSUInteger i = 0, j = 0, k = 0;
+        while (i < lower->count && j < upper->count) {
+            if (HLIntervalEntryCompare(&upper->entries[j], &lower->entries[i]) < 0) {
+                merged[k++] = upper->entries[j++];
+            } else {
+                merged[k++] = lower->entries[i++];
+            }
+        }
+        while (i < lower->count) {
+            merged[k++] = lower->entries[i++];
+        }
+        while (j < upper->count) {
+            merged[k++] = upper->entries[j++];
+        }
+        free(lower->entries);
+        free(upper->entries);
+        upper->entries = NULL;
+        upper->count = 0;
+        lower->entries = merged;
+        lower->count = count;
+        lower->maxLevel = HLIntervalRunIndex(merged, count);
+        _iRunCount--;
+    }
+}
+
+- (void)addInterval:(id<HLReadableInterval>)interval
+         identifier:(NSUInteger)identifier {
+    [self addStartMillis:[interval startMillis]
+               endMillis:[interval endMillis]
+              identifier:identifier];
+}
+
+- (NSUInteger)count {
+    return _iCount;
+}
+
+//-----------------------------------------------------------------------
+/*
+ * Runs an overlap query over every run.
+ */
+- (NSUInteger)matchStart:(int64_t)start
+                     end:(int64_t)end
+                  minEnd:(int64_t)minEnd
+              intoBuffer:(NSUInteger*)buffer
+                capacity:(NSUInteger)capacity
+             stopAtFirst:(BOOL)stopAtFirst {
+    HLIntervalMatches matches = {buffer, capacity, 0, stopAtFirst};
+    for(NSUInteger i = 0; i < _iRunCount; i++) {
+        if (!HLIntervalRunOverlaps(&_iRuns[i], start, end, minEnd, &matches)) {
+            break;
+        }
+    }
+    return matches.found;
+}
+
+- (NSUInteger)identifiersContainingInstant:(int64_t)instant
+                                intoBuffer:(NSUInteger*)buffer
+                                  capacity:(NSUInteger)capacity {
+    if (instant == INT64_MAX) {
+        // nothing can end after it
+        return 0;
+    }
+    return [self matchStart:instant
+                        end:instant + 1
+                     minEnd:INT64_MIN
+                 intoBuffer:buffer
+                   capacity:capacity
+                stopAtFirst:NO];
+}
+
+- (NSUInteger)identifiersOverlappingStartMillis:(int64_t)start
+                                      endMillis:(int64_t)end
+                                     intoBuffer:(NSUInteger*)buffer
+                                       capacity:(NSUInteger)capacity {
+    return [self matchStart:start
+                        end:end
+                     minEnd:INT64_MIN
+                 intoBuffer:buffer
+                   capacity:capacity
+                stopAtFirst:NO];
+}
+
+- (NSUInteger)identifiersContainingStartMillis:(int64_t)start
+                                     endMillis:(int64_t)end
+                                    intoBuffer:(NSUInteger*)buffer
+                                      capacity:(NSUInteger)capacity {
+    if (start == INT64_MAX) {
+        return 0;
+    }
+    // a containing interval contains the start instant and ends no earlier
+    return [self matchStart:start
+                        end:start + 1
+                     minEnd:end
+                 intoBuffer:buffer
+                   capacity:capacity
+                stopAtFirst:NO];
+}
+
+- (NSUInteger)identifiersContainedInStartMillis:(int64_t)start
+                                      endMillis:(int64_t)end
+                                     intoBuffer:(NSUInteger*)buffer
+                                       capacity:(NSUInteger)capacity {
+    HLIntervalMatches matches = {buffer, capacity, 0, NO};
+    for(NSUInteger i = 0; i < _iRunCount; i++) {
+        HLIntervalRunContainedIn(&_iRuns[i], start, end, &matches);
+    }
+    return matches.found;
+}
+
+- (BOOL)overlapsStartMillis:(int64_t)start
+                  endMillis:(int64_t)end {
+    return [self matchStart:start
+                        end:end
+                     minEnd:INT64_MIN
+                 intoBuffer:NULL
+                   capacity:0
+                stopAtFirst:YES] > 0;
+}
+
+- (NSIndexSet*)identifiersOverlappingInterval:(id<HLReadableInterval>)interval {
+    int64_t start, end;
+    if (interval == nil) {
+        start = end = HLCurrentTimeMillis();
+    } else {
+        start = [interval startMillis];
+        end = [interval endMillis];
+    }
+    NSUInteger capacity = 16;
+    NSUInteger* buffer = malloc(capacity * sizeof(NSUInteger));
+    NSUInteger found = [self identifiersOverlappingStartMillis:start
+                                                     endMillis:end
+                                                    intoBuffer:buffer
+                                                      capacity:capacity];
+    if (found > capacity) {
+        capacity = found;
+        buffer = realloc(buffer, capacity * sizeof(NSUInteger));
+        found = [self identifiersOverlappingStartMillis:start
+                                              endMillis:end
+                                             intoBuffer:buffer
+                                               capacity:capacity];
+    }
+    NSMutableIndexSet* identifiers = [NSMutableIndexSet indexSet];
+    for(NSUInteger i = 0; i < found; i++) {
+        [identifiers addIndex:buffer[i]];
+    }
+    free(buffer);
+    return identifiers;
+}
+
+@end
@@ -0,0 +1,235 @@
+/*
+ * IntervalSet.h
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#import <Foundation/Foundation.h>
+
+
+@class HLChronology;
+@protocol HLReadableInterval;
+
+/**
+ * IntervalSet is an immutable set of instants, held as sorted runs of
+ * start and end millis in flat arrays.
+ * <p>
+ * As for Interval, each run is inclusive of its start and exclusive of its
+ * end. The runs are normalized: they are sorted, none is empty, and none
+ * overlaps or abuts another, since abutting runs are coalesced into one.
+ * Two sets holding the same instants therefore hold the same runs.
+ * <p>
+ * Union, intersection, difference and complement are computed by a single
+ * merge over the runs of both sets, in time linear in their sizes, with no
+ * Interval or chronology objects created on the way. Convert to Interval
+ * objects only at the edges, with initWithIntervals: and toIntervals.
+ * <p>
+ * IntervalSet is thread-safe and immutable.
+ */
+@interface HLIntervalSet : NSObject <NSCopying> {
+    
+@private
+    int64_t* _iStarts;
+    int64_t* _iEnds;
+    NSUInteger _iCount;
+    
+}
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the set holding no instants.
+ *
+ * @return the empty set
+ */
++ (HLIntervalSet*)emptySet;
+
+/**
+ * Gets the union of a number of sets, such as the busy times of many
+ * calendars. This sorts all their runs once rather than merging the sets
+ * pairwise.
+ *
+ * @param sets  the sets to combine, not nil
+ * @return the set of instants in any of the sets
+ */
++ (HLIntervalSet*)unionOfSets:(NSArray*)sets;
+
+//-----------------------------------------------------------------------
+/**
+ * Creates a set from runs in any order, which may overlap, abut or be
+ * empty. The arrays are copied.
+ *
+ * @param starts  the start millis of each run, not NULL unless count is zero
+ * @param ends  the end millis of each run, not NULL unless count is zero
+ * @param count  the number of runs
+ * @throws IllegalArgumentException if an end is before its start
+ */
+- (id)initWithStartMillis:(const int64_t*)starts
+                endMillis:(const int64_t*)ends
+                    count:(NSUInteger)count;
+
+/**
+ * Creates a set of the instants in any of a number of intervals.
+ *
+ * @param intervals  the intervals, each a ReadableInterval, not nil
+ */
+- (id)initWithIntervals:(NSArray*)intervals;
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the number of runs in the set.
+ *
+ * @return the count of runs
+ */
+- (NSUInteger)count;
+
+/**
+ * Checks whether the set holds no instants.
+ *
+ * @return true if there are no runs
+ */
+- (BOOL)isEmpty;
+
+/**
+ * Gets the sorted start millis of the runs, which are valid as long as
+ * the set is.
+ *
+ * @return the start millis, count long
+ */
+- (const int64_t*)startMillis;
+
+/**
+ * Gets the end millis of the runs, in the same order as the starts.
+ *
+ * @return the end millis, count long
+ */
+- (const int64_t*)endMillis;
+
+/**
+ * Gets the start millis of a run.
+ *
+ * @param index  the index of the run
+ * @return the start millis, inclusive
+ * @throws IndexOutOfBoundsException if the index is invalid
+ */
+- (int64_t)startMillisAtIndex:(NSUInteger)index;
+
+/**
+ * Gets the end millis of a run.
+ *
+ * @param index  the index of the run
+ * @return the end millis, exclusive
+ * @throws IndexOutOfBoundsException if the index is invalid
+ */
+- (int64_t)endMillisAtIndex:(NSUInteger)index;
+
+/**
+ * Gets the total length of the runs.
+ *
+ * @return the number of milliseconds in the set
+ * @throws ArithmeticException if the total overflows
+ */
+- (int64_t)durationMillis;
+
+/**
+ * Checks whether the set holds an instant.
+ *
+ * @param instant  the instant millis
+ * @return true if a run contains the instant
+ */
+- (BOOL)containsInstant:(int64_t)instant;
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the instants in either set.
+ *
+ * @param other  the other set, nil means empty
+ * @return the union
+ */
+- (HLIntervalSet*)unionWithSet:(HLIntervalSet*)other;
+
+/**
+ * Gets the instants in both sets.
+ *
+ * @param other  the other set, nil means empty
+ * @return the intersection
+ */
+- (HLIntervalSet*)intersectionWithSet:(HLIntervalSet*)other;
+
+/**
+ * Gets the instants in this set and not in the other.
+ *
+ * @param other  the other set, nil means empty
+ * @return the difference
+ */
+- (HLIntervalSet*)differenceWithSet:(HLIntervalSet*)other;
+
+/**
+ * Gets the instants between two bounds that are not in this set, such as
+ * the free time in a working day.
+ *
+ * @param start  the start millis of the bounds, inclusive
+ * @param end  the end millis of the bounds, exclusive
+ * @return the complement within the bounds
+ * @throws IllegalArgumentException if the end is before the start
+ */
+- (HLIntervalSet*)complementWithinStartMillis:(int64_t)start
+                                    endMillis:(int64_t)end;
+
+//-----------------------------------------------------------------------
+/**
+ * Converts the runs to Interval objects in the ISO chronology in the
+ * default time zone.
+ *
+ * @return an array of Interval, one per run
+ */
+- (NSArray*)toIntervals;
+
+/**
+ * Converts the runs to Interval objects in a chronology.
+ *
+ * @param chronology  the chronology to use, nil is ISO default
+ * @return an array of Interval, one per run
+ */
+- (NSArray*)toIntervalsWithChronology:(HLChronology*)chronology;
+
+//-----------------------------------------------------------------------
+/**
+ * Compares this set with another, which are equal when they hold the
+ * same instants.
+ *
+ * @param object  the object to compare to
+ * @return true if the object is an IntervalSet with the same runs
+ */
+- (BOOL)isEqual:(id)object;
+
+/**
+ * Gets a hash code consistent with isEqual:.
+ *
+ * @return a hash of the runs
+ */
+- (NSUInteger)hash;
+
+/**
+ * Outputs the runs as start/end millis pairs, such as [0/1000, 2000/3000].
+ *
+ * @return the runs as a string
+ */
+- (NSString*)description;
+
+@end
@@ -0,0 +1,435 @@
+/*
+ * IntervalSet.m
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#import "HLIntervalSet.h"
+
+#import "HLConstants.h"
+#import "HLFieldUtils.h"
+#import "HLInterval.h"
+#import "HLReadableInterval.h"
+
+
+/** The operations combining two sets */
+typedef enum {
+    HLIntervalSetUnion,
+    HLIntervalSetIntersection,
+    HLIntervalSetDifference
+} HLIntervalSetOperation;
+
+/*
+ * A run being normalized.
+ */
+typedef struct {
+    int64_t start;
+    int64_t end;
+} HLIntervalSetRun;
+
+static int HLIntervalSetRunCompare(const void* lhs, const void* rhs) {
+    const HLIntervalSetRun* a = lhs;
+    const HLIntervalSetRun* b = rhs;
+    if (a->start != b->start) {
+        return a->start < b->start ? -1 : 1;
+    }
+    return 0;
+}
+
+/*
+ * Sorts runs and coalesces those that overlap or abut, dropping empty
+ * ones, into the start and end arrays. Returns the number of runs written.
+ */
+static NSUInteger HLIntervalSetNormalize(HLIntervalSetRun* runs,
+                                         NSUInteger count,
+                                         int64_t* starts,
+                                         int64_t* ends) {
+    qsort(runs, count, sizeof(HLIntervalSetRun), HLIntervalSetRunCompare);
+    NSUInteger written = 0;
+    for(NSUInteger i = 0; i < count; i++) {
+        if (runs[i].start == runs[i].end) {
+            continue;
+        }
+        if (written > 0 && runs[i].start <= ends[written - 1]) {
+            if (runs[i].end > ends[written - 1]) {
+                ends[written - 1] = runs[i].end;
+            }
+        } else {
+            starts[written] = runs[i].start;
+            ends[written] = runs[i].end;
+            written++;
+        }
+    }
+    return written;
+}
+
+/*
+ * Merges the boundaries of two normalized sets, writing the runs of the
+ * result. The boundaries of a set alternate start and end, so walking both
+ * in order tells whether each set holds the instants up to the next
+ * boundary. A normalized set has at most one boundary at an instant, and
+ * those of both sets at the same instant are taken together, which
+ * coalesces runs that abut. Returns the number of runs written, at most
+ * the sum of the counts.
+ */
+static NSUInteger HLIntervalSetMerge(const int64_t* aStarts, const int64_t* aEnds, NSUInteger aCount,
+                                     const int64_t* bStarts, const int64_t* bEnds, NSUInteger bCount,
+                                     HLIntervalSetOperation operation,
+                                     int64_t* starts,
+                                     int64_t* ends) {
+    NSUInteger aLimit = aCount * 2;
+    NSUInteger bLimit = bCount * 2;
+    NSUInteger i = 0;
+    NSUInteger j = 0;
+    NSUInteger written = 0;
+    BOOL inResult = NO;
+    while (i < aLimit || j < bLimit) {
+        int64_t aNext = (i < aLimit ? ((i & 1) ? aEnds[i >> 1] : aStarts[i >> 1]) : INT64_MAX);
+        int64_t bNext = (j < bLimit ? ((j & 1) ? bEnds[j >> 1] : bStarts[j >> 1]) : INT64_MAX);
+        int64_t instant = (aNext < bNext ? aNext : bNext);
+        // an end at INT64_MAX is a real boundary, so compare by position
+        if (i < aLimit && aNext == instant) {
+            i++;
+        }
+        if (j < bLimit && bNext == instant) {
+            j++;
+        }
+        // odd positions are inside a run
+        BOOL inA = (i & 1);
+        BOOL inB = (j & 1);
+        BOOL in;
+        switch (operation) {
+            case HLIntervalSetUnion:
+                in = inA || inB;
+                break;
+            case HLIntervalSetIntersection:
+                in = inA && inB;
+                break;
+            default:
+                in = inA && !inB;
+                break;
+        }
+        if (in != inResult) {
+            if (in) {
+                starts[written] = instant;
+            } else {
+                ends[written++] = instant;
+            }
+            inResult = in;
+        }
+    }
+    return written;
+}
+
+@interface HLIntervalSet (Private)
+
+- (id)initWithOwnedStarts:(int64_t*)starts
+                     ends:(int64_t*)ends
+                    count:(NSUInteger)count;
+
+- (HLIntervalSet*)combineWithSet:(HLIntervalSet*)other
+                       operation:(HLIntervalSetOperation)operation;
+
+@end
+
+/** The shared set with no runs */
+static HLIntervalSet* sEmptySet = nil;
+
+@implementation HLIntervalSet
+
++ (void)initialize {
+    if (self == [HLIntervalSet class]) {
+        sEmptySet = [[HLIntervalSet alloc] initWithOwnedStarts:NULL
+                                                          ends:NULL
+                                                         count:0];
+    }
+}
+
+//-----------------------------------------------------------------------
++ (HLIntervalSet*)emptySet {
+    return sEmptySet;
+}
+
++ (HLIntervalSet*)unionOfSets:(NSArray*)sets {
+    NSUInteger total = 0;
+    for (HLIntervalSet* set in sets) {
+        total += set->_iCount;
+    }
+    if (total == 0) {
+        return [HLIntervalSet emptySet];
+    }
+    
+    HLIntervalSetRun* runs = malloc(total * sizeof(HLIntervalSetRun));
+    NSUInteger k = 0;
+    for (HLIntervalSet* set in sets) {
+        for(NSUInteger i = 0; i < set->_iCount; i++) {
+            runs[k].start = set->_iStarts[i];
+            runs[k].end = set->_iEnds[i];
+            k++;
+        }
+    }
+    int64_t* starts = malloc(total * sizeof(int64_t));
+    int64_t* ends = malloc(total * sizeof(int64_t));
+    NSUInteger count = HLIntervalSetNormalize(runs, total, starts, ends);
+    free(runs);
+    return [[[HLIntervalSet alloc] initWithOwnedStarts:starts
+                                                  ends:ends
+                                                 count:count] autorelease];
+}
+
+//-----------------------------------------------------------------------
+- (id)initWithOwnedStarts:(int64_t*)starts
+                     ends:(int64_t*)ends
+                    count:(NSUInteger)count {
+    self = [super init];
+    if(self) {
+        _iStarts = starts;
+        _iEnds = ends;
+        _iCount = count;
+    }
+    
+    return self;
+}
+
+- (id)initWithStartMillis:(const int64_t*)starts
+                endMillis:(const int64_t*)ends
+                    count:(NSUInteger)count {
+    for(NSUInteger i = 0; i < count; i++) {
+        if (ends[i] < starts[i]) {
+            [self release];
+            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                        format:@"The end instant must be greater or equal to the start"];
+        }
+    }
+    
+    HLIntervalSetRun* runs = malloc((count > 0 ? count : 1) * sizeof(HLIntervalSetRun));
+    for(NSUInteger i = 0; i < count; i++) {
+        runs[i].start = starts[i];
+        runs[i].end = ends[i];
+    }
+    int64_t* normalStarts = malloc((count > 0 ? count : 1) * sizeof(int64_t));
+    int64_t* normalEnds = malloc((count > 0 ? count : 1) * sizeof(int64_t));
+    NSUInteger normalCount = HLIntervalSetNormalize(runs, count, normalStarts, normalEnds);
+    free(runs);
+    return [self initWithOwnedStarts:normalStarts
+                                ends:normalEnds
+                               count:normalCount];
+}
+
+- (id)initWithIntervals:(NSArray*)intervals {
+    NSUInteger count = [intervals count];
+    int64_t* starts = malloc((count > 0 ? count : 1) * sizeof(int64_t));
+    int64_t* ends = malloc((count > 0 ? count : 1) * sizeof(int64_t));
+    NSUInteger i = 0;
+    for (id<HLReadableInterval> interval in intervals) {
+        starts[i] = [interval startMillis];
+        ends[i] = [interval endMillis];
+        i++;
+    }
+    self = [self initWithStartMillis:starts
+                           endMillis:ends
+                               count:count];
+    free(starts);
+    free(ends);
+    return self;
+}
+
+- (id)copyWithZone:(NSZone*)zone {
+    return [self retain];
+}
+
+- (void)dealloc {
+    free(_iStarts);
+    free(_iEnds);
+    [super dealloc];
+}
+
+//-----------------------------------------------------------------------
+- (NSUInteger)count {
+    return _iCount;
+}
+
+- (BOOL)isEmpty {
+    return _iCount == 0;
+}
+
+- (const int64_t*)startMillis {
+    return _iStarts;
+}
+
+- (const int64_t*)endMillis {
+    return _iEnds;
+}
+
+- (int64_t)startMillisAtIndex:(NSUInteger)index {
+    if (index >= _iCount) {
+        [NSException raise:HL_INDEX_OUT_OF_BOUNDS_EXCEPTION
+                    format:@"Invalid index: %lu", (unsigned long) index];
+    }
+    return _iStarts[index];
+}
+
+- (int64_t)endMillisAtIndex:(NSUInteger)index {
+    if (index >= _iCount) {
+        [NSException raise:HL_INDEX_OUT_OF_BOUNDS_EXCEPTION
+                    format:@"Invalid index: %lu", (unsigned long) index];
+    }
+    return _iEnds[index];
+}
+
+- (int64_t)durationMillis {
+    int64_t duration = 0;
+    for(NSUInteger i = 0; i < _iCount; i++) {
+        duration = HLSafeAdd(duration, HLSafeSubtract(_iEnds[i], _iStarts[i]));
+    }
+    return duration;
+}
+
+- (BOOL)containsInstant:(int64_t)instant {
+    // find the last run starting at or before the instant
+    NSUInteger low = 0;
+    NSUInteger high = _iCount;
+    while (low < high) {
+        NSUInteger mid = low + (high - low) / 2;
+        if (_iStarts[mid] <= instant) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low > 0 && instant < _iEnds[low - 1];
+}
+
+//-----------------------------------------------------------------------
+- (HLIntervalSet*)combineWithSet:(HLIntervalSet*)other
+                       operation:(HLIntervalSetOperation)operation {
+    if (other == nil) {
+        other = [HLIntervalSet emptySet];
+    }
+    NSUInteger capacity = _iCount + other->_iCount;
+    if (capacity == 0) {
+        return [HLIntervalSet emptySet];
+    }
+    int64_t* starts = malloc(capacity * sizeof(int64_t));
+    int64_t* ends = malloc(capacity * sizeof(int64_t));
+    NSUInteger count = HLIntervalSetMerge(_iStarts, _iEnds, _iCount,
+                                          other->_iStarts, other->_iEnds, other->_iCount,
+                                          operation, starts, ends);
+    return [[[HLIntervalSet alloc] initWithOwnedStarts:starts
+                                                  ends:ends
+                                                 count:count] autorelease];
+}
+
+- (HLIntervalSet*)unionWithSet:(HLIntervalSet*)other {
+    if (other == nil || other->_iCount == 0) {
+        return self;
+    }
+    if (_iCount == 0) {
+        return other;
+    }
+    return [self combineWithSet:other
+                      operation:HLIntervalSetUnion];
+}
+
+- (HLIntervalSet*)intersectionWithSet:(HLIntervalSet*)other {
+    if (other == nil || other->_iCount == 0 || _iCount == 0) {
+        return [HLIntervalSet emptySet];
+    }
+    return [self combineWithSet:other
+                      operation:HLIntervalSetIntersection];
+}
+
+- (HLIntervalSet*)differenceWithSet:(HLIntervalSet*)other {
+    if (other == nil || other->_iCount == 0 || _iCount == 0) {
+        return self;
+    }
+    return [self combineWithSet:other
+                      operation:HLIntervalSetDifference];
+}
+
+- (HLIntervalSet*)complementWithinStartMillis:(int64_t)start
+                                    endMillis:(int64_t)end {
+    if (end < start) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"The end instant must be greater or equal to the start"];
+    }
+    if (start == end) {
+        return [HLIntervalSet emptySet];
+    }
+    int64_t* starts = malloc((_iCount + 1) * sizeof(int64_t));
+    int64_t* ends = malloc((_iCount + 1) * sizeof(int64_t));
+    NSUInteger count = HLIntervalSetMerge(&start, &end, 1,
+                                          _iStarts, _iEnds, _iCount,
+                                          HLIntervalSetDifference, starts, ends);
+    return [[[HLIntervalSet alloc] initWithOwnedStarts:starts
+                                                  ends:ends
+                                                 count:count] autorelease];
+}
+
+//-----------------------------------------------------------------------
+- (NSArray*)toIntervals {
+    return [self toIntervalsWithChronology:nil];
+}
+
+- (NSArray*)toIntervalsWithChronology:(HLChronology*)chronology {
+    NSMutableArray* intervals = [NSMutableArray arrayWithCapacity:_iCount];
+    for(NSUInteger i = 0; i < _iCount; i++) {
+        HLInterval* interval = [[HLInterval alloc] initWithStart:_iStarts[i]
+                                                             end:_iEnds[i]
+                                                      chronology:chronology];
+        [intervals addObject:interval];
+        [interval release];
+    }
+    return intervals;
+}
+
+//-----------------------------------------------------------------------
+- (BOOL)isEqual:(id)object {
+    if (self == object) {
+        return YES;
+    }
+    if ([object isKindOfClass:[HLIntervalSet class]] == NO) {
+        return NO;
+    }
+    HLIntervalSet* other = object;
+    return _iCount == other->_iCount &&
+        memcmp(_iStarts, other->_iStarts, _iCount * sizeof(int64_t)) == 0 &&
+        memcmp(_iEnds, other->_iEnds, _iCount * sizeof(int64_t)) == 0;
+}
+
+- (NSUInteger)hash {
+    NSUInteger hash = _iCount;
+    for(NSUInteger i = 0; i < _iCount; i++) {
+        hash = 31 * hash + (NSUInteger) (_iStarts[i] ^ (_iStarts[i] >> 32));
+        hash = 31 * hash + (NSUInteger) (_iEnds[i] ^ (_iEnds[i] >> 32));
+    }
+    return hash;
+}
+
+- (NSString*)description {
+    NSMutableString* description = [NSMutableString stringWithString:@"["];
+    for(NSUInteger i = 0; i < _iCount; i++) {
+        [description appendFormat:(i == 0 ? @"%lld/%lld" : @", %lld/%lld"),
+         (long long) _iStarts[i], (long long) _iEnds[i]];
+    }
+    [description appendString:@"]"];
+    return description;
+}
+
+@end
@@ -21,6 +21,144 @@
 
 #import <Foundation/Foundation.h>
 
+#import "HLBaseSingleFieldPeriod.h"
+
+
+/**
+ * An immutable time period representing a number of minutes.
+ * <p>
+ * <code>Minutes</code> is an immutable period that can only store minutes.
+ * It does not store years, months or hours for example. As such it is a
+ * type-safe way of representing a number of minutes in an application.
+ * <p>
+ * Only the pooled factory and the arithmetic are ported so far; the rest
+ * of the class follows as the Java reference below.
+ * <p>
+ * <code>Minutes</code> is thread-safe and immutable.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+@interface HLMinutes : HLBaseSingleFieldPeriod {
+    
+}
+
+//-----------------------------------------------------------------------
+/**
+ * Obtains an instance of <code>Minutes</code> that may be cached.
+ * <code>Minutes</code> is immutable, so instances can be cached and shared.
+ * This factory method provides access to shared instances, which are
+ * preallocated for values from HL_PERIOD_POOL_MIN to HL_PERIOD_POOL_MAX,
+ * so arithmetic on small periods does not allocate.
+ *
+ * @param minutes  the number of minutes to obtain an instance for
+ * @return the instance of Minutes
+ */
++ (HLMinutes*)minutes:(NSInteger)minutes;
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the number of minutes that this period represents.
+ *
+ * @return the number of minutes in the period
+ */
+- (NSInteger)minutes;
+
+//-----------------------------------------------------------------------
+/**
+ * Returns a new instance with the specified number of minutes added.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param minutes  the amount of minutes to add, may be negative
+ * @return the new period plus the specified number of minutes
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMinutes*)plusMinutesValue:(NSInteger)minutes;
+
+/**
+ * Returns a new instance with the specified number of minutes added.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param minutes  the amount of minutes to add, may be negative, nil means zero
+ * @return the new period plus the specified number of minutes
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMinutes*)plusMinutes:(HLMinutes*)minutes;
+
+//-----------------------------------------------------------------------
+/**
+ * Returns a new instance with the specified number of minutes taken away.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param minutes  the amount of minutes to take away, may be negative
+ * @return the new period minus the specified number of minutes
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMinutes*)minusMinutesValue:(NSInteger)minutes;
+
+/**
+ * Returns a new instance with the specified number of minutes taken away.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param minutes  the amount of minutes to take away, may be negative, nil means zero
+ * @return the new period minus the specified number of minutes
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMinutes*)minusMinutes:(HLMinutes*)minutes;
+
+//-----------------------------------------------------------------------
+/**
+ * Returns a new instance with the minutes multiplied by the specified scalar.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param scalar  the amount to multiply by, may be negative
+ * @return the new period multiplied by the specified scalar
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMinutes*)multipliedBy:(NSInteger)scalar;
+
+/**
+ * Returns a new instance with the minutes divided by the specified divisor.
+ * The calculation uses integer division, thus 3 divided by 2 is 1.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param divisor  the amount to divide by, may be negative
+ * @return the new period divided by the specified divisor
+ * @throws ArithmeticException if the divisor is zero, or is -1 and the
+ *  result overflows an int
+ */
+- (HLMinutes*)dividedBy:(NSInteger)divisor;
+
+//-----------------------------------------------------------------------
+/**
+ * Returns a new instance with the minutes value negated.
+ *
+ * @return the new period with a negated value
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMinutes*)negated;
+
+@end
+
+/** Constant representing zero minutes. */
+extern const HLMinutes* HL_MINUTES_ZERO;
+/** Constant representing one minute. */
+extern const HLMinutes* HL_MINUTES_ONE;
+/** Constant representing two minutes. */
+extern const HLMinutes* HL_MINUTES_TWO;
+/** Constant representing three minutes. */
+extern const HLMinutes* HL_MINUTES_THREE;
+/** Constant representing the maximum number of minutes that can be stored in this object. */
+extern const HLMinutes* HL_MINUTES_MAX_VALUE;
+/** Constant representing the minimum number of minutes that can be stored in this object. */
+extern const HLMinutes* HL_MINUTES_MIN_VALUE;
+
 
 @interface Minutes {
 
@@ -19,7 +19,119 @@
  * limitations under the License.
  */
 
-#import "Minutes.h"
+#import "HLMinutes.h"
+
+#import "HLConstants.h"
+#import "HLFieldUtils.h"
+
+
+/** Constant representing zero minutes. */
+const HLMinutes* HL_MINUTES_ZERO;
+/** Constant representing one minute. */
+const HLMinutes* HL_MINUTES_ONE;
+/** Constant representing two minutes. */
+const HLMinutes* HL_MINUTES_TWO;
+/** Constant representing three minutes. */
+const HLMinutes* HL_MINUTES_THREE;
+/** Constant representing the maximum number of minutes that can be stored in this object. */
+const HLMinutes* HL_MINUTES_MAX_VALUE;
+/** Constant representing the minimum number of minutes that can be stored in this object. */
+const HLMinutes* HL_MINUTES_MIN_VALUE;
+
+/** The shared instances for small numbers of minutes. */
+static HLPeriodPool sMinutesPool;
+
+@implementation HLMinutes
+
++ (void)initialize {
+    if (self == [HLMinutes class]) {
+        HLPeriodPoolFill(&sMinutesPool, [HLMinutes class]);
+        HL_MINUTES_ZERO = [HLMinutes minutes:0];
+        HL_MINUTES_ONE = [HLMinutes minutes:1];
+        HL_MINUTES_TWO = [HLMinutes minutes:2];
+        HL_MINUTES_THREE = [HLMinutes minutes:3];
+        HL_MINUTES_MAX_VALUE = [[HLMinutes alloc] initWithPeriod:NSIntegerMax];
+        HL_MINUTES_MIN_VALUE = [[HLMinutes alloc] initWithPeriod:NSIntegerMin];
+    }
+}
+
+//-----------------------------------------------------------------------
++ (HLMinutes*)minutes:(NSInteger)minutes {
+    HLMinutes* pooled = HLPeriodPoolValue(&sMinutesPool, minutes);
+    if (pooled != nil) {
+        return pooled;
+    }
+    switch (minutes) {
+        case NSIntegerMax:
+            return (HLMinutes*) HL_MINUTES_MAX_VALUE;
+        case NSIntegerMin:
+            return (HLMinutes*) HL_MINUTES_MIN_VALUE;
+        default:
+            return [[[HLMinutes alloc] initWithPeriod:minutes] autorelease];
+    }
+}
+
+//-----------------------------------------------------------------------
+- (NSInteger)minutes {
+    return [self value];
+}
+
+//-----------------------------------------------------------------------
+- (HLMinutes*)plusMinutesValue:(NSInteger)minutes {
+    if (minutes == 0) {
+        return self;
+    }
+    
+    return [HLMinutes minutes:HLSafeToInteger(HLSafeAdd([self value], minutes))];
+}
+
+- (HLMinutes*)plusMinutes:(HLMinutes*)minutes {
+    if (minutes == nil) {
+        return self;
+    }
+    
+    return [self plusMinutesValue:[minutes value]];
+}
+
+//-----------------------------------------------------------------------
+- (HLMinutes*)minusMinutesValue:(NSInteger)minutes {
+    return [self plusMinutesValue:HLSafeToInteger(HLSafeNegate(minutes))];
+}
+
+- (HLMinutes*)minusMinutes:(HLMinutes*)minutes {
+    if (minutes == nil) {
+        return self;
+    }
+    
+    return [self minusMinutesValue:[minutes value]];
+}
+
+//-----------------------------------------------------------------------
+- (HLMinutes*)multipliedBy:(NSInteger)scalar {
+    return [HLMinutes minutes:HLSafeToInteger(HLSafeMultiply([self value], scalar))];
+}
+
+- (HLMinutes*)dividedBy:(NSInteger)divisor {
+    if (divisor == 1) {
+        return self;
+    }
+    if (divisor == -1) {
+        // NSIntegerMin / -1 traps rather than wrapping, so check it as a negation
+        return [self negated];
+    }
+    if (divisor == 0) {
+        [NSException raise:HL_ARITHMETIC_EXCEPTION format:@"Division by zero"];
+    }
+    
+    return [HLMinutes minutes:([self value] / divisor)];
+}
+
+//-----------------------------------------------------------------------
+- (HLMinutes*)negated {
+    return [HLMinutes minutes:HLSafeToInteger(HLSafeNegate([self value]))];
+}
+
+@end
 
 
 @implementation Minutes
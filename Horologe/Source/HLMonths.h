@@ -21,6 +21,162 @@
 
 #import <Foundation/Foundation.h>
 
+#import "HLBaseSingleFieldPeriod.h"
+
+
+/**
+ * An immutable time period representing a number of months.
+ * <p>
+ * <code>Months</code> is an immutable period that can only store months.
+ * It does not store years, days or hours for example. As such it is a
+ * type-safe way of representing a number of months in an application.
+ * <p>
+ * Only the pooled factory and the arithmetic are ported so far; the rest
+ * of the class follows as the Java reference below.
+ * <p>
+ * <code>Months</code> is thread-safe and immutable.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+@interface HLMonths : HLBaseSingleFieldPeriod {
+    
+}
+
+//-----------------------------------------------------------------------
+/**
+ * Obtains an instance of <code>Months</code> that may be cached.
+ * <code>Months</code> is immutable, so instances can be cached and shared.
+ * This factory method provides access to shared instances, which are
+ * preallocated for values from HL_PERIOD_POOL_MIN to HL_PERIOD_POOL_MAX,
+ * so arithmetic on small periods does not allocate.
+ *
+ * @param months  the number of months to obtain an instance for
+ * @return the instance of Months
+ */
++ (HLMonths*)months:(NSInteger)months;
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the number of months that this period represents.
+ *
+ * @return the number of months in the period
+ */
+- (NSInteger)months;
+
+//-----------------------------------------------------------------------
+/**
+ * Returns a new instance with the specified number of months added.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param months  the amount of months to add, may be negative
+ * @return the new period plus the specified number of months
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMonths*)plusMonthsValue:(NSInteger)months;
+
+/**
+ * Returns a new instance with the specified number of months added.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param months  the amount of months to add, may be negative, nil means zero
+ * @return the new period plus the specified number of months
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMonths*)plusMonths:(HLMonths*)months;
+
+//-----------------------------------------------------------------------
+/**
+ * Returns a new instance with the specified number of months taken away.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param months  the amount of months to take away, may be negative
+ * @return the new period minus the specified number of months
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMonths*)minusMonthsValue:(NSInteger)months;
+
+/**
+ * Returns a new instance with the specified number of months taken away.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param months  the amount of months to take away, may be negative, nil means zero
+ * @return the new period minus the specified number of months
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMonths*)minusMonths:(HLMonths*)months;
+
+//-----------------------------------------------------------------------
+/**
+ * Returns a new instance with the months multiplied by the specified scalar.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param scalar  the amount to multiply by, may be negative
+ * @return the new period multiplied by the specified scalar
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMonths*)multipliedBy:(NSInteger)scalar;
+
+/**
+ * Returns a new instance with the months divided by the specified divisor.
+ * The calculation uses integer division, thus 3 divided by 2 is 1.
+ * <p>
+ * This instance is immutable and unaffected by this method call.
+ *
+ * @param divisor  the amount to divide by, may be negative
+ * @return the new period divided by the specified divisor
+ * @throws ArithmeticException if the divisor is zero, or is -1 and the
+ *  result overflows an int
+ */
+- (HLMonths*)dividedBy:(NSInteger)divisor;
+
+//-----------------------------------------------------------------------
+/**
+ * Returns a new instance with the months value negated.
+ *
+ * @return the new period with a negated value
+ * @throws ArithmeticException if the result overflows an int
+ */
+- (HLMonths*)negated;
+
+@end
+
+/** Constant representing zero months. */
+extern const HLMonths* HL_MONTHS_ZERO;
+/** Constant representing one month. */
+extern const HLMonths* HL_MONTHS_ONE;
+/** Constant representing two months. */
+extern const HLMonths* HL_MONTHS_TWO;
+/** Constant representing three months. */
+extern const HLMonths* HL_MONTHS_THREE;
+/** Constant representing four months. */
+extern const HLMonths* HL_MONTHS_FOUR;
+/** Constant representing five months. */
+extern const HLMonths* HL_MONTHS_FIVE;
+/** Constant representing six months. */
+extern const HLMonths* HL_MONTHS_SIX;
+/** Constant representing seven months. */
+extern const HLMonths* HL_MONTHS_SEVEN;
+/** Constant representing eight months. */
+extern const HLMonths* HL_MONTHS_EIGHT;
+/** Constant representing nine months. */
+extern const HLMonths* HL_MONTHS_NINE;
+/** Constant representing ten months. */
+extern const HLMonths* HL_MONTHS_TEN;
+/** Constant representing eleven months. */
+extern const HLMonths* HL_MONTHS_ELEVEN;
+/** Constant representing twelve months. */
+extern const HLMonths* HL_MONTHS_TWELVE;
+/** Constant representing the maximum number of months that can be stored in this object. */
+extern const HLMonths* HL_MONTHS_MAX_VALUE;
+/** Constant representing the minimum number of months that can be stored in this object. */
+extern const HLMonths* HL_MONTHS_MIN_VALUE;
+
 
 @interface Months {
 
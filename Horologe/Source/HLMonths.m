@@ -19,7 +19,146 @@
  * limitations under the License.
  */
 
-#import "Months.h"
+#import "HLMonths.h"
+
+#import "HLConstants.h"
+#import "HLFieldUtils.h"
+
+
+/** Constant representing zero months. */
+const HLMonths* HL_MONTHS_ZERO;
+/** Constant representing one month. */
+const HLMonths* HL_MONTHS_ONE;
+/** Constant representing two months. */
+const HLMonths* HL_MONTHS_TWO;
+/** Constant representing three months. */
+const HLMonths* HL_MONTHS_THREE;
+/** Constant representing four months. */
+const HLMonths* HL_MONTHS_FOUR;
+/** Constant representing five months. */
+const HLMonths* HL_MONTHS_FIVE;
+/** Constant representing six months. */
+const HLMonths* HL_MONTHS_SIX;
+/** Constant representing seven months. */
+const HLMonths* HL_MONTHS_SEVEN;
+/** Constant representing eight months. */
+const HLMonths* HL_MONTHS_EIGHT;
+/** Constant representing nine months. */
+const HLMonths* HL_MONTHS_NINE;
+/** Constant representing ten months. */
+const HLMonths* HL_MONTHS_TEN;
+/** Constant representing eleven months. */
+const HLMonths* HL_MONTHS_ELEVEN;
+/** Constant representing twelve months. */
+const HLMonths* HL_MONTHS_TWELVE;
+/** Constant representing the maximum number of months that can be stored in this object. */
+const HLMonths* HL_MONTHS_MAX_VALUE;
+/** Constant representing the minimum number of months that can be stored in this object. */
+const HLMonths* HL_MONTHS_MIN_VALUE;
+
+/** The shared instances for small numbers of months. */
+static HLPeriodPool sMonthsPool;
+
+@implementation HLMonths
+
++ (void)initialize {
+    if (self == [HLMonths class]) {
+        HLPeriodPoolFill(&sMonthsPool, [HLMonths class]);
+        HL_MONTHS_ZERO = [HLMonths months:0];
+        HL_MONTHS_ONE = [HLMonths months:1];
+        HL_MONTHS_TWO = [HLMonths months:2];
+        HL_MONTHS_THREE = [HLMonths months:3];
+        HL_MONTHS_FOUR = [HLMonths months:4];
+        HL_MONTHS_FIVE = [HLMonths months:5];
+        HL_MONTHS_SIX = [HLMonths months:6];
+        HL_MONTHS_SEVEN = [HLMonths months:7];
+        HL_MONTHS_EIGHT = [HLMonths months:8];
+        HL_MONTHS_NINE = [HLMonths months:9];
+        HL_MONTHS_TEN = [HLMonths months:10];
+        HL_MONTHS_ELEVEN = [HLMonths months:11];
+        HL_MONTHS_TWELVE = [HLMonths months:12];
+        HL_MONTHS_MAX_VALUE = [[HLMonths alloc] initWithPeriod:NSIntegerMax];
+        HL_MONTHS_MIN_VALUE = [[HLMonths alloc] initWithPeriod:NSIntegerMin];
+    }
+}
+
+//-----------------------------------------------------------------------
++ (HLMonths*)months:(NSInteger)months {
+    HLMonths* pooled = HLPeriodPoolValue(&sMonthsPool, months);
+    if (pooled != nil) {
+        return pooled;
+    }
+    switch (months) {
+        case NSIntegerMax:
+            return (HLMonths*) HL_MONTHS_MAX_VALUE;
+        case NSIntegerMin:
+            return (HLMonths*) HL_MONTHS_MIN_VALUE;
+        default:
+            return [[[HLMonths alloc] initWithPeriod:months] autorelease];
+    }
+}
+
+//-----------------------------------------------------------------------
+- (NSInteger)months {
+    return [self value];
+}
+
+//-----------------------------------------------------------------------
+- (HLMonths*)plusMonthsValue:(NSInteger)months {
+    if (months == 0) {
+        return self;
+    }
+    
+    return [HLMonths months:HLSafeToInteger(HLSafeAdd([self value], months))];
+}
+
+- (HLMonths*)plusMonths:(HLMonths*)months {
+    if (months == nil) {
+        return self;
+    }
+    
+    return [self plusMonthsValue:[months value]];
+}
+
+//-----------------------------------------------------------------------
+- (HLMonths*)minusMonthsValue:(NSInteger)months {
+    return [self plusMonthsValue:HLSafeToInteger(HLSafeNegate(months))];
+}
+
+- (HLMonths*)minusMonths:(HLMonths*)months {
+    if (months == nil) {
+        return self;
+    }
+    
+    return [self minusMonthsValue:[months value]];
+}
+
+//-----------------------------------------------------------------------
+- (HLMonths*)multipliedBy:(NSInteger)scalar {
+    return [HLMonths months:HLSafeToInteger(HLSafeMultiply([self value], scalar))];
+}
+
+- (HLMonths*)dividedBy:(NSInteger)divisor {
+    if (divisor == 1) {
+        return self;
+    }
+    if (divisor == -1) {
+        // NSIntegerMin / -1 traps rather than wrapping, so check it as a negation
+        return [self negated];
+    }
+    if (divisor == 0) {
+        [NSException raise:HL_ARITHMETIC_EXCEPTION format:@"Division by zero"];
+    }
+    
+    return [HLMonths months:([self value] / divisor)];
+}
+
+//-----------------------------------------------------------------------
+- (HLMonths*)negated {
+    return [HLMonths months:HLSafeToInteger(HLSafeNegate([self value]))];
+}
+
+@end
 
 
 @implementation Months
@@ -126,7 +126,7 @@
  *
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  */
-- (Id)initWithInstantValue:(NSInteger)instant;
+- (Id)initWithInstantValue:(int64_t)instant;
 
 /**
  * Constructs an instance set to the milliseconds from 1970-01-01T00:00:00Z
@@ -137,7 +137,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param zone  the time zone, nil means default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant
+- (id)initWithInstantValue:(int64_t)instant
               dateTimeZone:(HLDateTimeZone*)zone;
 
 /**
@@ -150,7 +150,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param chronology  the chronology, nil means ISOChronology in default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant
+- (id)initWithInstantValue:(int64_t)instant
                 chronology:(HLChronology*)chronology;
 
 //-----------------------------------------------------------------------
@@ -339,7 +339,7 @@
  * @param instant  the milliseconds since 1970-01-01T00:00:00Z to set the
  * datetime to
  */
-- (void)setMillis:(NSInteger)instant;
+- (void)setMillis:(int64_t)instant;
 
 /**
  * Sets the millisecond instant of this instant from another.
@@ -358,7 +358,7 @@
  * @param duration  the millis to add
  * @throws ArithmeticException if the result exceeds the capacity of the instant
  */
-- (void)addDurationValue:(NSInteger)duration;
+- (void)addDurationValue:(int64_t)duration;
 
 /**
  * Adds a duration to this instant.
@@ -659,7 +659,7 @@
  * @param millis  the milliseconds to add
  * @throws IllegalArgumentException if the value is invalid
  */
-- (void)addMillis:(NSInteger)millis;
+- (void)addMillis:(int64_t)millis;
 
 //-----------------------------------------------------------------------
 /**
@@ -669,7 +669,7 @@
  * @param instant  an instant to copy the date from, time part ignored
  * @throws IllegalArgumentException if the value is invalid
  */
-- (void)setDateWithInstantValue:(NSInteger)instant;
+- (void)setDateWithInstantValue:(int64_t)instant;
 
 /**
  * Set the date from another instant.
@@ -701,7 +701,7 @@
  * @param millis  an instant to copy the time from, date part ignored
  * @throws IllegalArgumentException if the value is invalid
  */
-- (void)setTimeWithMillis:(NSInteger)millis;
+- (void)setTimeWithMillis:(int64_t)millis;
 
 /**
  * Set the time from another instant.
@@ -952,7 +952,7 @@
  * 
  * @return the milliseconds
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 /**
  * Gets the chronology of the datetime that this property is linked to.
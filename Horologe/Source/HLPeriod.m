@@ -21,6 +21,8 @@
 
 #import "HLPeriod.h"
 
+#import "HLPeriodValue.h"
+
 
 static const HLPeriod* HL_PERIOD_ZERO = [[HLPeriod alloc] init];
 
@@ -927,20 +929,14 @@ static const HLPeriod* HL_PERIOD_ZERO = [[HLPeriod alloc] init];
      * @throws UnsupportedOperationException if any field is not supported
      * @since 1.5
      */
-    - (HLPeriod*)plus:(id<HLReadablePeriod>)period) {
+    - (HLPeriod*)plus:(id<HLReadablePeriod>)period {
         if (period == nil) {
-            return this;
+            return self;
         }
-        int[] values = getValues();  // cloned
-        getPeriodType().addIndexedField(this, PeriodType.YEAR_INDEX, values, period.get(DurationFieldType.YEARS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.MONTH_INDEX, values, period.get(DurationFieldType.MONTHS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.WEEK_INDEX, values, period.get(DurationFieldType.WEEKS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.DAY_INDEX, values, period.get(DurationFieldType.DAYS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.HOUR_INDEX, values, period.get(DurationFieldType.HOURS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.MINUTE_INDEX, values, period.get(DurationFieldType.MINUTES_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.SECOND_INDEX, values, period.get(DurationFieldType.SECONDS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.MILLI_INDEX, values, period.get(DurationFieldType.MILLIS_TYPE));
-        return new Period(values, getPeriodType());
+        HLPeriodValue value = HLPeriodValueFromPeriod(self);
+        HLPeriodValue other = HLPeriodValueFromPeriod(period);
+        HLPeriodValueAdd(&value, &other);
+        return HLPeriodValueToPeriod(value);
     }
 
     //-----------------------------------------------------------------------
@@ -1106,20 +1102,14 @@ static const HLPeriod* HL_PERIOD_ZERO = [[HLPeriod alloc] init];
      * @throws UnsupportedOperationException if any field is not supported
      * @since 1.5
      */
-    - (HLPeriod*)minus:(id<HLReadablePeriod>)period) {
+    - (HLPeriod*)minus:(id<HLReadablePeriod>)period {
         if (period == nil) {
-            return this;
+            return self;
         }
-        int[] values = getValues();  // cloned
-        getPeriodType().addIndexedField(this, PeriodType.YEAR_INDEX, values, -period.get(DurationFieldType.YEARS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.MONTH_INDEX, values, -period.get(DurationFieldType.MONTHS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.WEEK_INDEX, values, -period.get(DurationFieldType.WEEKS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.DAY_INDEX, values, -period.get(DurationFieldType.DAYS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.HOUR_INDEX, values, -period.get(DurationFieldType.HOURS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.MINUTE_INDEX, values, -period.get(DurationFieldType.MINUTES_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.SECOND_INDEX, values, -period.get(DurationFieldType.SECONDS_TYPE));
-        getPeriodType().addIndexedField(this, PeriodType.MILLI_INDEX, values, -period.get(DurationFieldType.MILLIS_TYPE));
-        return new Period(values, getPeriodType());
+        HLPeriodValue value = HLPeriodValueFromPeriod(self);
+        HLPeriodValue other = HLPeriodValueFromPeriod(period);
+        HLPeriodValueSubtract(&value, &other);
+        return HLPeriodValueToPeriod(value);
     }
 
     //-----------------------------------------------------------------------
@@ -1401,14 +1391,7 @@ static const HLPeriod* HL_PERIOD_ZERO = [[HLPeriod alloc] init];
      * @since 1.5
      */
     - (HLDuration*)toStandardDuration {
-        checkYearsAndMonths("Duration");
-- (NSInteger)millis = getMillis();  // no overflow can happen, even with Integer.MAX_VALUEs
-        millis += (((long) getSeconds()) * ((long) DateTimeConstants.MILLIS_PER_SECOND));
-        millis += (((long) getMinutes()) * ((long) DateTimeConstants.MILLIS_PER_MINUTE));
-        millis += (((long) getHours()) * ((long) DateTimeConstants.MILLIS_PER_HOUR));
-        millis += (((long) getDays()) * ((long) DateTimeConstants.MILLIS_PER_DAY));
-        millis += (((long) getWeeks()) * ((long) DateTimeConstants.MILLIS_PER_WEEK));
-        return new Duration(millis);
+        return HLPeriodValueToStandardDuration(HLPeriodValueFromPeriod(self));
     }
 
     /**
@@ -1453,7 +1436,7 @@ static const HLPeriod* HL_PERIOD_ZERO = [[HLPeriod alloc] init];
      * @since 1.5
      */
     - (HLPeriod*)normalizedStandard {
-        return normalizedStandard(PeriodType.standard());
+        return [self normalizedStandardWithType:nil];
     }
 
     //-----------------------------------------------------------------------
@@ -1488,27 +1471,10 @@ static const HLPeriod* HL_PERIOD_ZERO = [[HLPeriod alloc] init];
      *  years or months but the specified period type does not support them
      * @since 1.5
      */
-    - (HLPeriod*)normalizedStandard(PeriodType type) {
-- (NSInteger)millis = getMillis();  // no overflow can happen, even with Integer.MAX_VALUEs
-        millis += (((long) getSeconds()) * ((long) DateTimeConstants.MILLIS_PER_SECOND));
-        millis += (((long) getMinutes()) * ((long) DateTimeConstants.MILLIS_PER_MINUTE));
-        millis += (((long) getHours()) * ((long) DateTimeConstants.MILLIS_PER_HOUR));
-        millis += (((long) getDays()) * ((long) DateTimeConstants.MILLIS_PER_DAY));
-        millis += (((long) getWeeks()) * ((long) DateTimeConstants.MILLIS_PER_WEEK));
-- (HLPeriod*)result = new Period(millis, DateTimeUtils.getPeriodType(type), ISOChronology.getInstanceUTC());
-        int years = getYears();
-        int months = getMonths();
-        if (years != 0 || months != 0) {
-            years = FieldUtils.safeAdd(years, months / 12);
-            months = months % 12;
-            if (years != 0) {
-                result = result.withYears(years);
-            }
-            if (months != 0) {
-                result = result.withMonths(months);
-            }
-        }
-        return result;
+    - (HLPeriod*)normalizedStandardWithType:(HLPeriodType*)type {
+        HLPeriodValue value = HLPeriodValueFromPeriod(self);
+        HLPeriodValueNormalizeStandard(&value, type == nil ? HL_PERIOD_MASK_STANDARD : [type fieldMask]);
+        return HLPeriodValueToPeriod(value);
     }
 
 }
@@ -19,871 +19,375 @@
  * limitations under the License.
  */
 
-#import "PeriodType.h"
+#import "HLPeriodType.h"
 
+#import <libkern/OSAtomic.h>
 
-@implementation PeriodType
+#import "HLConstants.h"
+#import "HLDurationFieldType.h"
+#import "HLFieldUtils.h"
+#import "HLReadablePeriod.h"
 
-/*
- *  Copyright 2001-2005 Stephen Colebourne
- *
- *  Licensed under the Apache License, Version 2.0 (the "License");
- *  you may not use this file except in compliance with the License.
- *  You may obtain a copy of the License at
- *
- *      http://www.apache.org/licenses/LICENSE-2.0
- *
- *  Unless required by applicable law or agreed to in writing, software
- *  distributed under the License is distributed on an "AS IS" BASIS,
- *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- *  See the License for the specific language governing permissions and
- *  limitations under the License.
- */
-package org.joda.time;
 
-import java.io.Serializable;
-import java.util.ArrayList;
-import java.util.Arrays;
-import java.util.HashMap;
-import java.util.List;
-import java.util.Map;
+#define HL_PERIOD_TYPE_MASK_ALL ((uint16_t) (HL_PERIOD_TYPE_MASK_COUNT - 1))
 
-import org.joda.time.field.FieldUtils;
+@interface HLPeriodType ()
 
 /**
- * Controls a period implementation by specifying which duration fields are to be used.
- * <p>
- * The following implementations are provided:
- * <ul>
- * <li>Standard - years, months, weeks, days, hours, minutes, seconds, millis
- * <li>YearMonthDayTime - years, months, days, hours, minutes, seconds, millis
- * <li>YearMonthDay - years, months, days
- * <li>YearWeekDayTime - years, weeks, days, hours, minutes, seconds, millis
- * <li>YearWeekDay - years, weeks, days
- * <li>YearDayTime - years, days, hours, minutes, seconds, millis
- * <li>YearDay - years, days, hours
- * <li>DayTime - days, hours, minutes, seconds, millis
- * <li>Time - hours, minutes, seconds, millis
- * <li>plus one for each single type
- * </ul>
- *
- * <p>
- * PeriodType is thread-safe and immutable, and all subclasses must be as well.
+ * Constructor. Types are canonical, so only HLPeriodTypeCanonical creates
+ * them, once per field mask.
  *
- * @author Brian S O'Neill
- * @author Stephen Colebourne
- * @since 1.0
+ * @param name  the name
+ * @param fieldMask  the supported standard fields
  */
-public class PeriodType implements Serializable {
-    /** Serialization version */
-    private static final long serialVersionUID = 2274324892792009998L;
-
-    /** Cache of all the known types. */
-    private static final Map cTypes = new HashMap(32);
-
-    static int YEAR_INDEX = 0;
-    static int MONTH_INDEX = 1;
-    static int WEEK_INDEX = 2;
-    static int DAY_INDEX = 3;
-    static int HOUR_INDEX = 4;
-    static int MINUTE_INDEX = 5;
-    static int SECOND_INDEX = 6;
-    static int MILLI_INDEX = 7;
-    
-    private static PeriodType cStandard;
-    private static PeriodType cYMDTime;
-    private static PeriodType cYMD;
-    private static PeriodType cYWDTime;
-    private static PeriodType cYWD;
-    private static PeriodType cYDTime;
-    private static PeriodType cYD;
-    private static PeriodType cDTime;
-    private static PeriodType cTime;
-    
-    private static PeriodType cYears;
-    private static PeriodType cMonths;
-    private static PeriodType cWeeks;
-    private static PeriodType cDays;
-    private static PeriodType cHours;
-    private static PeriodType cMinutes;
-    private static PeriodType cSeconds;
-    private static PeriodType cMillis;
-
-    /**
-     * Gets a type that defines all standard fields.
-     * <ul>
-     * <li>years
-     * <li>months
-     * <li>weeks
-     * <li>days
-     * <li>hours
-     * <li>minutes
-     * <li>seconds
-     * <li>milliseconds
-     * </ul>
-     *
-     * @return the period type
-     */
-    public static PeriodType standard {
-        PeriodType type = cStandard;
-        if (type == nil) {
-            type = new PeriodType(
-                "Standard",
-                new DurationFieldType[] {
-                    DurationFieldType.years(), DurationFieldType.months(),
-                    DurationFieldType.weeks(), DurationFieldType.days(),
-                    DurationFieldType.hours(), DurationFieldType.minutes(),
-                    DurationFieldType.seconds(), DurationFieldType.millis(),
-                },
-                new int[] { 0, 1, 2, 3, 4, 5, 6, 7, }
-            );
-            cStandard = type;
-        }
-        return type;
-    }
+- (id)initWithName:(NSString*)name
+         fieldMask:(uint16_t)fieldMask;
 
-    /**
-     * Gets a type that defines all standard fields except weeks.
-     * <ul>
-     * <li>years
-     * <li>months
-     * <li>days
-     * <li>hours
-     * <li>minutes
-     * <li>seconds
-     * <li>milliseconds
-     * </ul>
-     *
-     * @return the period type
-     */
-    public static PeriodType yearMonthDayTime {
-        PeriodType type = cYMDTime;
-        if (type == nil) {
-            type = new PeriodType(
-                "YearMonthDayTime",
-                new DurationFieldType[] {
-                    DurationFieldType.years(), DurationFieldType.months(),
-                    DurationFieldType.days(),
-                    DurationFieldType.hours(), DurationFieldType.minutes(),
-                    DurationFieldType.seconds(), DurationFieldType.millis(),
-                },
-                new int[] { 0, 1, -1, 2, 3, 4, 5, 6, }
-            );
-            cYMDTime = type;
-        }
-        return type;
-    }
+@end
 
-    /**
-     * Gets a type that defines the year, month and day fields.
-     * <ul>
-     * <li>years
-     * <li>months
-     * <li>days
-     * </ul>
-     *
-     * @return the period type
-     * @since 1.1
-     */
-    public static PeriodType yearMonthDay {
-        PeriodType type = cYMD;
-        if (type == nil) {
-            type = new PeriodType(
-                "YearMonthDay",
-                new DurationFieldType[] {
-                    DurationFieldType.years(), DurationFieldType.months(),
-                    DurationFieldType.days(),
-                },
-                new int[] { 0, 1, -1, 2, -1, -1, -1, -1, }
-            );
-            cYMD = type;
-        }
-        return type;
+/** The canonical type for each field mask, filled on first use */
+static HLPeriodType* volatile sTypes[HL_PERIOD_TYPE_MASK_COUNT];
+
+static HLDurationFieldType* HLPeriodTypeFieldType(NSInteger index) {
+    switch (index) {
+        case HL_PERIOD_TYPE_YEAR_INDEX:
+            return [HLDurationFieldType years];
+        case HL_PERIOD_TYPE_MONTH_INDEX:
+            return [HLDurationFieldType months];
+        case HL_PERIOD_TYPE_WEEK_INDEX:
+            return [HLDurationFieldType weeks];
+        case HL_PERIOD_TYPE_DAY_INDEX:
+            return [HLDurationFieldType days];
+        case HL_PERIOD_TYPE_HOUR_INDEX:
+            return [HLDurationFieldType hours];
+        case HL_PERIOD_TYPE_MINUTE_INDEX:
+            return [HLDurationFieldType minutes];
+        case HL_PERIOD_TYPE_SECOND_INDEX:
+            return [HLDurationFieldType seconds];
+        case HL_PERIOD_TYPE_MILLI_INDEX:
+            return [HLDurationFieldType millis];
+        default:
+            return nil;
     }
+}
 
-    /**
-     * Gets a type that defines all standard fields except months.
-     * <ul>
-     * <li>years
-     * <li>weeks
-     * <li>days
-     * <li>hours
-     * <li>minutes
-     * <li>seconds
-     * <li>milliseconds
-     * </ul>
-     *
-     * @return the period type
-     */
-    public static PeriodType yearWeekDayTime {
-        PeriodType type = cYWDTime;
-        if (type == nil) {
-            type = new PeriodType(
-                "YearWeekDayTime",
-                new DurationFieldType[] {
-                    DurationFieldType.years(),
-                    DurationFieldType.weeks(), DurationFieldType.days(),
-                    DurationFieldType.hours(), DurationFieldType.minutes(),
-                    DurationFieldType.seconds(), DurationFieldType.millis(),
-                },
-                new int[] { 0, -1, 1, 2, 3, 4, 5, 6, }
-            );
-            cYWDTime = type;
-        }
-        return type;
-    }
+static inline uint16_t HLPeriodTypeBit(NSInteger index) {
+    return (uint16_t) (1u << index);
+}
 
-    /**
-     * Gets a type that defines year, week and day fields.
-     * <ul>
-     * <li>years
-     * <li>weeks
-     * <li>days
-     * </ul>
-     *
-     * @return the period type
-     * @since 1.1
-     */
-    public static PeriodType yearWeekDay {
-        PeriodType type = cYWD;
-        if (type == nil) {
-            type = new PeriodType(
-                "YearWeekDay",
-                new DurationFieldType[] {
-                    DurationFieldType.years(),
-                    DurationFieldType.weeks(), DurationFieldType.days(),
-                },
-                new int[] { 0, -1, 1, 2, -1, -1, -1, -1, }
-            );
-            cYWD = type;
-        }
-        return type;
-    }
+/*
+ * Names the type for a mask. The named types keep their names however
+ * they are reached; any other mask is named as the standard type with
+ * fields removed, as forFields always named it.
+ */
+static NSString* HLPeriodTypeName(uint16_t fieldMask) {
+    switch (fieldMask) {
+        case 0xFF: return @"Standard";
+        case 0xFB: return @"YearMonthDayTime";
+        case 0x0B: return @"YearMonthDay";
+        case 0xFD: return @"YearWeekDayTime";
+        case 0x0D: return @"YearWeekDay";
+        case 0xF9: return @"YearDayTime";
+        case 0x09: return @"YearDay";
+        case 0xF8: return @"DayTime";
+        case 0xF0: return @"Time";
+        case 0x01: return @"Years";
+        case 0x02: return @"Months";
+        case 0x04: return @"Weeks";
+        case 0x08: return @"Days";
+        case 0x10: return @"Hours";
+        case 0x20: return @"Minutes";
+        case 0x40: return @"Seconds";
+        case 0x80: return @"Millis";
+    }
+    static NSString* const removed[HL_PERIOD_TYPE_FIELD_COUNT] = {
+        @"NoYears", @"NoMonths", @"NoWeeks", @"NoDays",
+        @"NoHours", @"NoMinutes", @"NoSeconds", @"NoMillis",
+    };
+    NSMutableString* name = [NSMutableString stringWithString:@"Standard"];
+    for(NSInteger i = 0; i < HL_PERIOD_TYPE_FIELD_COUNT; i++) {
+        if ((fieldMask & HLPeriodTypeBit(i)) == 0) {
+            [name appendString:removed[i]];
+        }
+    }
+    return name;
+}
 
-    /**
-     * Gets a type that defines all standard fields except months and weeks.
-     * <ul>
-     * <li>years
-     * <li>days
-     * <li>hours
-     * <li>minutes
-     * <li>seconds
-     * <li>milliseconds
-     * </ul>
-     *
-     * @return the period type
-     */
-    public static PeriodType yearDayTime {
-        PeriodType type = cYDTime;
-        if (type == nil) {
-            type = new PeriodType(
-                "YearDayTime",
-                new DurationFieldType[] {
-                    DurationFieldType.years(), DurationFieldType.days(),
-                    DurationFieldType.hours(), DurationFieldType.minutes(),
-                    DurationFieldType.seconds(), DurationFieldType.millis(),
-                },
-                new int[] { 0, -1, -1, 1, 2, 3, 4, 5, }
-            );
-            cYDTime = type;
-        }
+/*
+ * Gets the canonical type for a mask, creating it if this is the first
+ * request. Readers only load the slot; a creation race is settled by the
+ * compare and swap, with the loser releasing its instance.
+ */
+static HLPeriodType* HLPeriodTypeCanonical(uint16_t fieldMask) {
+    HLPeriodType* type = sTypes[fieldMask];
+    if (type != nil) {
         return type;
     }
-
-    /**
-     * Gets a type that defines the year and day fields.
-     * <ul>
-     * <li>years
-     * <li>days
-     * </ul>
-     *
-     * @return the period type
-     * @since 1.1
-     */
-    public static PeriodType yearDay {
-        PeriodType type = cYD;
-        if (type == nil) {
-            type = new PeriodType(
-                "YearDay",
-                new DurationFieldType[] {
-                    DurationFieldType.years(), DurationFieldType.days(),
-                },
-                new int[] { 0, -1, -1, 1, -1, -1, -1, -1, }
-            );
-            cYD = type;
-        }
-        return type;
+    HLPeriodType* created = [[HLPeriodType alloc] initWithName:HLPeriodTypeName(fieldMask)
+                                                     fieldMask:fieldMask];
+    if (!OSAtomicCompareAndSwapPtrBarrier(nil, created, (void* volatile*) &sTypes[fieldMask])) {
+        [created release];
     }
+    return sTypes[fieldMask];
+}
 
-    /**
-     * Gets a type that defines all standard fields from days downwards.
-     * <ul>
-     * <li>days
-     * <li>hours
-     * <li>minutes
-     * <li>seconds
-     * <li>milliseconds
-     * </ul>
-     *
-     * @return the period type
-     */
-    public static PeriodType dayTime {
-        PeriodType type = cDTime;
-        if (type == nil) {
-            type = new PeriodType(
-                "DayTime",
-                new DurationFieldType[] {
-                    DurationFieldType.days(),
-                    DurationFieldType.hours(), DurationFieldType.minutes(),
-                    DurationFieldType.seconds(), DurationFieldType.millis(),
-                },
-                new int[] { -1, -1, -1, 0, 1, 2, 3, 4, }
-            );
-            cDTime = type;
-        }
-        return type;
-    }
+@implementation HLPeriodType
 
-    /**
-     * Gets a type that defines all standard time fields.
-     * <ul>
-     * <li>hours
-     * <li>minutes
-     * <li>seconds
-     * <li>milliseconds
-     * </ul>
-     *
-     * @return the period type
-     */
-    public static PeriodType time {
-        PeriodType type = cTime;
-        if (type == nil) {
-            type = new PeriodType(
-                "Time",
-                new DurationFieldType[] {
-                    DurationFieldType.hours(), DurationFieldType.minutes(),
-                    DurationFieldType.seconds(), DurationFieldType.millis(),
-                },
-                new int[] { -1, -1, -1, -1, 0, 1, 2, 3, }
-            );
-            cTime = type;
-        }
-        return type;
-    }
++ (HLPeriodType*)standard {
+    return HLPeriodTypeCanonical(0xFF);
+}
 
-    /**
-     * Gets a type that defines just the years field.
-     *
-     * @return the period type
-     */
-    public static PeriodType years {
-        PeriodType type = cYears;
-        if (type == nil) {
-            type = new PeriodType(
-                "Years",
-                new DurationFieldType[] { DurationFieldType.years() },
-                new int[] { 0, -1, -1, -1, -1, -1, -1, -1, }
-            );
-            cYears = type;
-        }
-        return type;
-    }
++ (HLPeriodType*)yearMonthDayTime {
+    return HLPeriodTypeCanonical(0xFB);
+}
 
-    /**
-     * Gets a type that defines just the months field.
-     *
-     * @return the period type
-     */
-    public static PeriodType months {
-        PeriodType type = cMonths;
-        if (type == nil) {
-            type = new PeriodType(
-                "Months",
-                new DurationFieldType[] { DurationFieldType.months() },
-                new int[] { -1, 0, -1, -1, -1, -1, -1, -1, }
-            );
-            cMonths = type;
-        }
-        return type;
-    }
++ (HLPeriodType*)yearMonthDay {
+    return HLPeriodTypeCanonical(0x0B);
+}
 
-    /**
-     * Gets a type that defines just the weeks field.
-     *
-     * @return the period type
-     */
-    public static PeriodType weeks {
-        PeriodType type = cWeeks;
-        if (type == nil) {
-            type = new PeriodType(
-                "Weeks",
-                new DurationFieldType[] { DurationFieldType.weeks() },
-                new int[] { -1, -1, 0, -1, -1, -1, -1, -1, }
-            );
-            cWeeks = type;
-        }
-        return type;
-    }
++ (HLPeriodType*)yearWeekDayTime {
+    return HLPeriodTypeCanonical(0xFD);
+}
 
-    /**
-     * Gets a type that defines just the days field.
-     *
-     * @return the period type
-     */
-    public static PeriodType days {
-        PeriodType type = cDays;
-        if (type == nil) {
-            type = new PeriodType(
-                "Days",
-                new DurationFieldType[] { DurationFieldType.days() },
-                new int[] { -1, -1, -1, 0, -1, -1, -1, -1, }
-            );
-            cDays = type;
-        }
-        return type;
-    }
++ (HLPeriodType*)yearWeekDay {
+    return HLPeriodTypeCanonical(0x0D);
+}
 
-    /**
-     * Gets a type that defines just the hours field.
-     *
-     * @return the period type
-     */
-    public static PeriodType hours {
-        PeriodType type = cHours;
-        if (type == nil) {
-            type = new PeriodType(
-                "Hours",
-                new DurationFieldType[] { DurationFieldType.hours() },
-                new int[] { -1, -1, -1, -1, 0, -1, -1, -1, }
-            );
-            cHours = type;
-        }
-        return type;
-    }
++ (HLPeriodType*)yearDayTime {
+    return HLPeriodTypeCanonical(0xF9);
+}
 
-    /**
-     * Gets a type that defines just the minutes field.
-     *
-     * @return the period type
-     */
-    public static PeriodType minutes {
-        PeriodType type = cMinutes;
-        if (type == nil) {
-            type = new PeriodType(
-                "Minutes",
-                new DurationFieldType[] { DurationFieldType.minutes() },
-                new int[] { -1, -1, -1, -1, -1, 0, -1, -1, }
-            );
-            cMinutes = type;
-        }
-        return type;
-    }
++ (HLPeriodType*)yearDay {
+    return HLPeriodTypeCanonical(0x09);
+}
 
-    /**
-     * Gets a type that defines just the seconds field.
-     *
-     * @return the period type
-     */
-    public static PeriodType seconds {
-        PeriodType type = cSeconds;
-        if (type == nil) {
-            type = new PeriodType(
-                "Seconds",
-                new DurationFieldType[] { DurationFieldType.seconds() },
-                new int[] { -1, -1, -1, -1, -1, -1, 0, -1, }
-            );
-            cSeconds = type;
-        }
-        return type;
-    }
++ (HLPeriodType*)dayTime {
+    return HLPeriodTypeCanonical(0xF8);
+}
 
-    /**
-     * Gets a type that defines just the millis field.
-     *
-     * @return the period type
-     */
-    public static PeriodType millis {
-        PeriodType type = cMillis;
-        if (type == nil) {
-            type = new PeriodType(
-                "Millis",
-                new DurationFieldType[] { DurationFieldType.millis() },
-                new int[] { -1, -1, -1, -1, -1, -1, -1, 0, }
-            );
-            cMillis = type;
-        }
-        return type;
-    }
++ (HLPeriodType*)time {
+    return HLPeriodTypeCanonical(0xF0);
+}
 
-    /**
-     * Gets a period type that contains the duration types of the array.
-     * <p>
-     * Only the 8 standard duration field types are supported.
-     *
-     * @param types  the types to include in the array.
-     * @return the period type
-     * @since 1.1
-     */
-    public static synchronized PeriodType forFields(DurationFieldType[] types) {
-        if (types == nil || types.length == 0) {
-            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
++ (HLPeriodType*)years {
+    return HLPeriodTypeCanonical(HLPeriodTypeBit(HL_PERIOD_TYPE_YEAR_INDEX));
+}
+
++ (HLPeriodType*)months {
+    return HLPeriodTypeCanonical(HLPeriodTypeBit(HL_PERIOD_TYPE_MONTH_INDEX));
+}
+
++ (HLPeriodType*)weeks {
+    return HLPeriodTypeCanonical(HLPeriodTypeBit(HL_PERIOD_TYPE_WEEK_INDEX));
+}
+
++ (HLPeriodType*)days {
+    return HLPeriodTypeCanonical(HLPeriodTypeBit(HL_PERIOD_TYPE_DAY_INDEX));
+}
+
++ (HLPeriodType*)hours {
+    return HLPeriodTypeCanonical(HLPeriodTypeBit(HL_PERIOD_TYPE_HOUR_INDEX));
+}
+
++ (HLPeriodType*)minutes {
+    return HLPeriodTypeCanonical(HLPeriodTypeBit(HL_PERIOD_TYPE_MINUTE_INDEX));
+}
+
++ (HLPeriodType*)seconds {
+    return HLPeriodTypeCanonical(HLPeriodTypeBit(HL_PERIOD_TYPE_SECOND_INDEX));
+}
+
++ (HLPeriodType*)millis {
+    return HLPeriodTypeCanonical(HLPeriodTypeBit(HL_PERIOD_TYPE_MILLI_INDEX));
+}
+
++ (HLPeriodType*)forFields:(NSArray*)types {
+    if (types == nil || [types count] == 0) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
                     format:@"Types array must not be nil or empty"];
+    }
+    uint16_t fieldMask = 0;
+    NSMutableArray* unsupported = nil;
+    for (id type in types) {
+        if (type == [NSNull null]) {
+            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                        format:@"Types array must not contain nil"];
         }
-        for(NSInteger i = 0; i < types.length; i++) {
-            if (types[i] == nil) {
-                [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
-                    format:@"Types array must not contain nil"];
-            }
-        }
-        Map cache = cTypes;
-        if (cTypes.isEmpty()) {
-            cache.put(standard(), standard());
-            cache.put(yearMonthDayTime(), yearMonthDayTime());
-            cache.put(yearMonthDay(), yearMonthDay());
-            cache.put(yearWeekDayTime(), yearWeekDayTime());
-            cache.put(yearWeekDay(), yearWeekDay());
-            cache.put(yearDayTime(), yearDayTime());
-            cache.put(yearDay(), yearDay());
-            cache.put(dayTime(), dayTime());
-            cache.put(time(), time());
-            cache.put(years(), years());
-            cache.put(months(), months());
-            cache.put(weeks(), weeks());
-            cache.put(days(), days());
-            cache.put(hours(), hours());
-            cache.put(minutes(), minutes());
-            cache.put(seconds(), seconds());
-            cache.put(millis(), millis());
-        }
-        PeriodType inPartType = new PeriodType(nil, types, nil);
-        Object cached = cache.get(inPartType);
-        if (cached instanceof PeriodType) {
-            return (PeriodType) cached;
-        }
-        if (cached != nil) {
-            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION format:@"PeriodType does not support fields: " + cached);
-        }
-        PeriodType type = standard();
-        List list = new ArrayList(Arrays.asList(types));
-        if (list.remove(DurationFieldType.years()) == false) {
-            type = type.withYearsRemoved();
-        }
-        if (list.remove(DurationFieldType.months()) == false) {
-            type = type.withMonthsRemoved();
-        }
-        if (list.remove(DurationFieldType.weeks()) == false) {
-            type = type.withWeeksRemoved();
-        }
-        if (list.remove(DurationFieldType.days()) == false) {
-            type = type.withDaysRemoved();
-        }
-        if (list.remove(DurationFieldType.hours()) == false) {
-            type = type.withHoursRemoved();
-        }
-        if (list.remove(DurationFieldType.minutes()) == false) {
-            type = type.withMinutesRemoved();
-        }
-        if (list.remove(DurationFieldType.seconds()) == false) {
-            type = type.withSecondsRemoved();
-        }
-        if (list.remove(DurationFieldType.millis()) == false) {
-            type = type.withMillisRemoved();
-        }
-        if (list.size() > 0) {
-            cache.put(inPartType, list);
-            [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION format:@"PeriodType does not support fields: " + list);
+        NSInteger i = 0;
+        while (i < HL_PERIOD_TYPE_FIELD_COUNT && HLPeriodTypeFieldType(i) != type) {
+            i++;
         }
-        // recheck cache in case initial array order was wrong
-        PeriodType checkPartType = new PeriodType(nil, type.iTypes, nil);
-        PeriodType checkedType = (PeriodType) cache.get(checkPartType);
-        if (checkedType != nil) {
-            cache.put(inPartType, checkedType);
-            return checkedType;
+        if (i < HL_PERIOD_TYPE_FIELD_COUNT) {
+            fieldMask |= HLPeriodTypeBit(i);
+        } else {
+            if (unsupported == nil) {
+                unsupported = [NSMutableArray array];
+            }
+            [unsupported addObject:type];
         }
-        cache.put(inPartType, type);
-        return type;
     }
-
-    //-----------------------------------------------------------------------    
-    /** The name of the type */
-    private final String iName;
-    /** The array of types */
-    private final DurationFieldType[] iTypes;
-    /** The array of indices */
-    private final int[] iIndices;
-
-    /**
-     * Constructor.
-     *
-     * @param name  the name
-     * @param types  the types
-     * @param indices  the indices
-     */
-    protected PeriodType(String name, DurationFieldType[] types, int[] indices) {
-        super();
-        iName = name;
-        iTypes = types;
-        iIndices = indices;
+    if (unsupported != nil) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"PeriodType does not support fields: %@", unsupported];
     }
+    return HLPeriodTypeCanonical(fieldMask);
+}
 
-    //-----------------------------------------------------------------------
-    /**
-     * Gets the name of the period type.
-     * 
-     * @return the name
-     */
-    - (NSString*)getName {
-        return iName;
++ (HLPeriodType*)forFieldMask:(uint16_t)fieldMask {
+    if (fieldMask & ~HL_PERIOD_TYPE_MASK_ALL) {
+        [NSException raise:HL_ILLEGAL_ARGUMENT_EXCEPTION
+                    format:@"PeriodType field mask has unknown bits: 0x%x", fieldMask];
     }
+    return HLPeriodTypeCanonical(fieldMask);
+}
 
-    /**
-     * Gets the number of fields in the period type.
-     * 
-     * @return the number of fields
-     */
-    - (NSInteger)size {
-        return iTypes.length;
+//-----------------------------------------------------------------------
+- (id)initWithName:(NSString*)name
+         fieldMask:(uint16_t)fieldMask {
+    self = [super init];
+    if(self) {
+        _iName = [name copy];
+        _iFieldMask = fieldMask & HL_PERIOD_TYPE_MASK_ALL;
+        NSMutableArray* types = [NSMutableArray arrayWithCapacity:HL_PERIOD_TYPE_FIELD_COUNT];
+        for(NSInteger i = 0; i < HL_PERIOD_TYPE_FIELD_COUNT; i++) {
+            if (_iFieldMask & HLPeriodTypeBit(i)) {
+                _iIndices[i] = (int8_t) [types count];
+                [types addObject:HLPeriodTypeFieldType(i)];
+            } else {
+                _iIndices[i] = -1;
+            }
+        }
+        _iTypes = [types copy];
     }
+    
+    return self;
+}
 
-    /**
-     * Gets the field type by index.
-     * 
-     * @param index  the index to retrieve
-     * @return the field type
-     * @throws IndexOutOfBoundsException if the index is invalid
-     */
-    public DurationFieldType getFieldType:(NSInteger) index) {
-        return iTypes[index];
-    }
+- (void)dealloc {
+    [_iName release];
+    [_iTypes release];
+    
+    [super dealloc];
+}
 
-    /**
-     * Checks whether the field specified is supported by this period.
-     *
-     * @param type  the type to check, may be nil which returns false
-     * @return true if the field is supported
-     */
-    - (BOOL)isSupported:(HLDurationFieldType*)type) {
-        return (indexOf(type) >= 0);
-    }
+//-----------------------------------------------------------------------
+- (NSString*)name {
+    return _iName;
+}
 
-    /**
-     * Gets the index of the field in this period.
-     *
-     * @param type  the type to check, may be nil which returns -1
-     * @return the index of -1 if not supported
-     */
-    - (NSInteger)indexOf:(HLDurationFieldType*)type) {
-        for(NSInteger i = 0, isize = size(); i < isize; i++) {
-            if (iTypes[i] == type) {
-                return i;
-            }
-        }
-        return -1;
-    }
+- (uint16_t)fieldMask {
+    return _iFieldMask;
+}
 
-    /**
-     * Gets a debugging to string.
-     * 
-     * @return a string
-     */
-    - (NSString*)description {
-        return "PeriodType[" + getName() + "]";
-    }
+- (NSInteger)size {
+    return [_iTypes count];
+}
 
-    //-----------------------------------------------------------------------
-    /**
-     * Gets the indexed field part of the period.
-     * 
-     * @param period  the period to query
-     * @param index  the index to use
-     * @return the value of the field, zero if unsupported
-     */
-    int getIndexedField:(id<HLReadablePeriod>)period :(NSInteger)index) {
-        int realIndex = iIndices[index];
-        return (realIndex == -1 ? 0 : period.getValue(realIndex));
+- (HLDurationFieldType*)fieldTypeAtIndex:(NSInteger)index {
+    if (index < 0 || index >= [_iTypes count]) {
+        [NSException raise:HL_INDEX_OUT_OF_BOUNDS_EXCEPTION
+                    format:@"Index %ld is out of range for %@", (long) index, self];
     }
+    return [_iTypes objectAtIndex:index];
+}
 
-    /**
-     * Sets the indexed field part of the period.
-     * 
-     * @param period  the period to query
-     * @param index  the index to use
-     * @param values  the array to populate
-     * @param newValue  the value to set
-     * @throws UnsupportedOperationException if not supported
-     */
-    boolean setIndexedField:(id<HLReadablePeriod>)period :(NSInteger)index, int[] values :(NSInteger)newValue) {
-        int realIndex = iIndices[index];
-        if (realIndex == -1) {
-            throw new UnsupportedOperationException("Field is not supported");
-        }
-        values[realIndex] = newValue;
-        return YES;
-    }
+- (BOOL)isSupported:(HLDurationFieldType*)type {
+    return ([self indexOf:type] >= 0);
+}
 
-    /**
-     * Adds to the indexed field part of the period.
-     * 
-     * @param period  the period to query
-     * @param index  the index to use
-     * @param values  the array to populate
-     * @param valueToAdd  the value to add
-     * @return true if the array is updated
-     * @throws UnsupportedOperationException if not supported
-     */
-    boolean addIndexedField:(id<HLReadablePeriod>)period :(NSInteger)index, int[] values :(NSInteger)valueToAdd) {
-        if (valueToAdd == 0) {
-            return NO;
+- (NSInteger)indexOf:(HLDurationFieldType*)type {
+    for(NSInteger i = 0; i < HL_PERIOD_TYPE_FIELD_COUNT; i++) {
+        if (HLPeriodTypeFieldType(i) == type) {
+            return _iIndices[i];
         }
-        int realIndex = iIndices[index];
-        if (realIndex == -1) {
-            throw new UnsupportedOperationException("Field is not supported");
-        }
-        values[realIndex] = FieldUtils.safeAdd(values[realIndex], valueToAdd);
-        return YES;
     }
+    return -1;
+}
 
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a version of this PeriodType instance that does not support years.
-     * 
-     * @return a new period type that supports the original set of fields except years
-     */
-    public PeriodType withYearsRemoved {
-        return withFieldRemoved(0, "NoYears");
-    }
+- (NSString*)description {
+    return [NSString stringWithFormat:@"PeriodType[%@]", _iName];
+}
 
-    /**
-     * Returns a version of this PeriodType instance that does not support months.
-     * 
-     * @return a new period type that supports the original set of fields except months
-     */
-    public PeriodType withMonthsRemoved {
-        return withFieldRemoved(1, "NoMonths");
-    }
+//-----------------------------------------------------------------------
+- (NSInteger)indexedFieldOfPeriod:(id<HLReadablePeriod>)period
+                            index:(NSInteger)index {
+    NSInteger realIndex = _iIndices[index];
+    return (realIndex == -1 ? 0 : [period valueAtIndex:realIndex]);
+}
 
-    /**
-     * Returns a version of this PeriodType instance that does not support weeks.
-     * 
-     * @return a new period type that supports the original set of fields except weeks
-     */
-    public PeriodType withWeeksRemoved {
-        return withFieldRemoved(2, "NoWeeks");
+- (BOOL)setIndexedField:(NSInteger)index
+                 values:(NSInteger*)values
+               newValue:(NSInteger)newValue {
+    NSInteger realIndex = _iIndices[index];
+    if (realIndex == -1) {
+        [NSException raise:HL_UNSUPPORTED_OPERATION_EXCEPTION
+                    format:@"Field is not supported"];
     }
+    values[realIndex] = newValue;
+    return YES;
+}
 
-    /**
-     * Returns a version of this PeriodType instance that does not support days.
-     * 
-     * @return a new period type that supports the original set of fields except days
-     */
-    public PeriodType withDaysRemoved {
-        return withFieldRemoved(3, "NoDays");
+- (BOOL)addIndexedField:(NSInteger)index
+                 values:(NSInteger*)values
+             valueToAdd:(NSInteger)valueToAdd {
+    if (valueToAdd == 0) {
+        return NO;
     }
-
-    /**
-     * Returns a version of this PeriodType instance that does not support hours.
-     * 
-     * @return a new period type that supports the original set of fields except hours
-     */
-    public PeriodType withHoursRemoved {
-        return withFieldRemoved(4, "NoHours");
+    NSInteger realIndex = _iIndices[index];
+    if (realIndex == -1) {
+        [NSException raise:HL_UNSUPPORTED_OPERATION_EXCEPTION
+                    format:@"Field is not supported"];
     }
+    values[realIndex] = HLSafeToInteger(HLSafeAdd(values[realIndex], valueToAdd));
+    return YES;
+}
 
-    /**
-     * Returns a version of this PeriodType instance that does not support minutes.
-     * 
-     * @return a new period type that supports the original set of fields except minutes
-     */
-    public PeriodType withMinutesRemoved {
-        return withFieldRemoved(5, "NoMinutes");
-    }
+//-----------------------------------------------------------------------
+- (HLPeriodType*)withYearsRemoved {
+    return HLPeriodTypeCanonical(_iFieldMask & ~HLPeriodTypeBit(HL_PERIOD_TYPE_YEAR_INDEX));
+}
 
-    /**
-     * Returns a version of this PeriodType instance that does not support seconds.
-     * 
-     * @return a new period type that supports the original set of fields except seconds
-     */
-    public PeriodType withSecondsRemoved {
-        return withFieldRemoved(6, "NoSeconds");
-    }
+- (HLPeriodType*)withMonthsRemoved {
+    return HLPeriodTypeCanonical(_iFieldMask & ~HLPeriodTypeBit(HL_PERIOD_TYPE_MONTH_INDEX));
+}
 
-    /**
-     * Returns a version of this PeriodType instance that does not support milliseconds.
-     * 
-     * @return a new period type that supports the original set of fields except milliseconds
-     */
-    public PeriodType withMillisRemoved {
-        return withFieldRemoved(7, "NoMillis");
-    }
+- (HLPeriodType*)withWeeksRemoved {
+    return HLPeriodTypeCanonical(_iFieldMask & ~HLPeriodTypeBit(HL_PERIOD_TYPE_WEEK_INDEX));
+}
 
-    /**
-     * Removes the field specified by indices index.
-     * 
-     * @param indicesIndex  the index to remove
-     * @param name  the name addition
-     * @return the new type
-     */
-    private PeriodType withFieldRemoved:(NSInteger) indicesIndex, String name) {
-        int fieldIndex = iIndices[indicesIndex];
-        if (fieldIndex == -1) {
-            return this;
-        }
-        
-        DurationFieldType[] types = new DurationFieldType[size() - 1];
-        for(NSInteger i = 0; i < iTypes.length; i++) {
-            if (i < fieldIndex) {
-                types[i] = iTypes[i];
-            } else if (i > fieldIndex) {
-                types[i - 1] = iTypes[i];
-            }
-        }
-        
-        int[] indices = new int[8];
-        for(NSInteger i = 0; i < indices.length; i++) {
-            if (i < indicesIndex) {
-                indices[i] = iIndices[i];
-            } else if (i > indicesIndex) {
-                indices[i] = (iIndices[i] == -1 ? -1 : iIndices[i] - 1);
-            } else {
-                indices[i] = -1;
-            }
-        }
-        return new PeriodType(getName() + name, types, indices);
-    }
+- (HLPeriodType*)withDaysRemoved {
+    return HLPeriodTypeCanonical(_iFieldMask & ~HLPeriodTypeBit(HL_PERIOD_TYPE_DAY_INDEX));
+}
 
-    //-----------------------------------------------------------------------
-    /**
-     * Compares this type to another object.
-     * To be equal, the object must be a PeriodType with the same set of fields.
-     * 
-     * @param obj  the object to compare to
-     * @return true if equal
-     */
-    - (BOOL)equals:(id)obj) {
-        if (self == obj) {
-            return YES;
-        }
-        if (obj instanceof PeriodType == false) {
-            return NO;
-        }
-        PeriodType other = (PeriodType) obj;
-        return (Arrays.equals(iTypes, other.iTypes));
-    }
+- (HLPeriodType*)withHoursRemoved {
+    return HLPeriodTypeCanonical(_iFieldMask & ~HLPeriodTypeBit(HL_PERIOD_TYPE_HOUR_INDEX));
+}
 
-    /**
-     * Returns a hashcode based on the field types.
-     * 
-     * @return a suitable hashcode
-     */
-    - (NSUInteger)hash {
-        int hash = 0;
-        for(NSInteger i = 0; i < iTypes.length; i++) {
-            hash += iTypes[i].hashCode();
-        }
-        return hash;
-    }
+- (HLPeriodType*)withMinutesRemoved {
+    return HLPeriodTypeCanonical(_iFieldMask & ~HLPeriodTypeBit(HL_PERIOD_TYPE_MINUTE_INDEX));
+}
+
+- (HLPeriodType*)withSecondsRemoved {
+    return HLPeriodTypeCanonical(_iFieldMask & ~HLPeriodTypeBit(HL_PERIOD_TYPE_SECOND_INDEX));
+}
+
+- (HLPeriodType*)withMillisRemoved {
+    return HLPeriodTypeCanonical(_iFieldMask & ~HLPeriodTypeBit(HL_PERIOD_TYPE_MILLI_INDEX));
+}
 
+//-----------------------------------------------------------------------
+- (BOOL)isEqual:(id)obj {
+    if (self == obj) {
+        return YES;
+    }
+    if (![obj isKindOfClass:[HLPeriodType class]]) {
+        return NO;
+    }
+    return _iFieldMask == [(HLPeriodType*) obj fieldMask];
 }
 
+- (NSUInteger)hash {
+    return _iFieldMask;
+}
 
 @end
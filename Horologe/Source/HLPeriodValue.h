@@ -0,0 +1,278 @@
+/*
+ * PeriodValue.h
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import <Foundation/Foundation.h>
+
+#import "HLFieldUtils.h"
+#import "HLPeriodType.h"
+
+
+@class HLDuration;
+@class HLPeriod;
+@protocol HLReadablePeriod;
+
+/*
+ * Period values
+ *
+ * HLPeriodValue holds the eight standard period fields inline, one slot
+ * per field in PeriodType index order, together with the field mask of
+ * its PeriodType. Arithmetic updates the struct in place, so
+ * summing many periods allocates nothing; an HLPeriod is only created
+ * when the result has to leave as an object.
+ *
+ * Unsupported slots are always zero, and adding a non-zero amount to one
+ * raises, matching what HLPeriod does with its PeriodType.
+ */
+
+/** The field slots, which match the PeriodType indices. */
+typedef enum {
+    HLPeriodSlotYears = HL_PERIOD_TYPE_YEAR_INDEX,
+    HLPeriodSlotMonths = HL_PERIOD_TYPE_MONTH_INDEX,
+    HLPeriodSlotWeeks = HL_PERIOD_TYPE_WEEK_INDEX,
+    HLPeriodSlotDays = HL_PERIOD_TYPE_DAY_INDEX,
+    HLPeriodSlotHours = HL_PERIOD_TYPE_HOUR_INDEX,
+    HLPeriodSlotMinutes = HL_PERIOD_TYPE_MINUTE_INDEX,
+    HLPeriodSlotSeconds = HL_PERIOD_TYPE_SECOND_INDEX,
+    HLPeriodSlotMillis = HL_PERIOD_TYPE_MILLI_INDEX,
+} HLPeriodSlot;
+
+/** The number of field slots. */
+#define HL_PERIOD_SLOT_COUNT HL_PERIOD_TYPE_FIELD_COUNT
+
+/** The bit for a slot in a type mask, as in [HLPeriodType fieldMask]. */
+#define HL_PERIOD_SLOT_BIT(slot) ((uint16_t) (1u << (slot)))
+
+/** The type mask of PeriodType.standard(), which supports every slot. */
+#define HL_PERIOD_MASK_STANDARD ((uint16_t) 0xFF)
+
+/** The slots from weeks to millis, which have a standard length. */
+#define HL_PERIOD_MASK_PRECISE ((uint16_t) 0xFC)
+
+/**
+ * A period with its fields held inline.
+ */
+typedef struct {
+    /** The field values, indexed by HLPeriodSlot */
+    int32_t values[HL_PERIOD_SLOT_COUNT];
+    /** The supported slots, one HL_PERIOD_SLOT_BIT each */
+    uint16_t typeMask;
+} HLPeriodValue;
+
+/** The standard length in millis of each slot, zero for years and months. */
+extern const int64_t HLPeriodSlotStandardMillis[HL_PERIOD_SLOT_COUNT];
+
+//-----------------------------------------------------------------------
+/**
+ * Creates a zero period supporting the slots in a type mask.
+ */
+static inline HLPeriodValue HLPeriodValueZero(uint16_t typeMask) {
+    HLPeriodValue value;
+    memset(value.values, 0, sizeof(value.values));
+    value.typeMask = typeMask & HL_PERIOD_MASK_STANDARD;
+    return value;
+}
+
+/**
+ * Creates a period of the standard type from field values.
+ */
+static inline HLPeriodValue HLPeriodValueMake(int32_t years, int32_t months, int32_t weeks, int32_t days,
+                                              int32_t hours, int32_t minutes, int32_t seconds, int32_t millis) {
+    HLPeriodValue value;
+    value.values[HLPeriodSlotYears] = years;
+    value.values[HLPeriodSlotMonths] = months;
+    value.values[HLPeriodSlotWeeks] = weeks;
+    value.values[HLPeriodSlotDays] = days;
+    value.values[HLPeriodSlotHours] = hours;
+    value.values[HLPeriodSlotMinutes] = minutes;
+    value.values[HLPeriodSlotSeconds] = seconds;
+    value.values[HLPeriodSlotMillis] = millis;
+    value.typeMask = HL_PERIOD_MASK_STANDARD;
+    return value;
+}
+
+static inline BOOL HLPeriodValueIsSupported(const HLPeriodValue* value, HLPeriodSlot slot) {
+    return (value->typeMask & HL_PERIOD_SLOT_BIT(slot)) != 0;
+}
+
+static inline int32_t HLPeriodValueGet(const HLPeriodValue* value, HLPeriodSlot slot) {
+    return value->values[slot];
+}
+
+/**
+ * Gets the mask of the slots holding non-zero values.
+ */
+static inline uint16_t HLPeriodValueNonZeroMask(const HLPeriodValue* value) {
+    uint16_t mask = 0;
+    for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        mask |= (uint16_t) ((value->values[slot] != 0) << slot);
+    }
+    return mask;
+}
+
+/**
+ * Raises for a non-zero amount in slots the value does not support.
+ * Kept out of line so the arithmetic below stays small.
+ */
+extern void HLPeriodValueRaiseUnsupported(const HLPeriodValue* value, uint16_t amountMask);
+
+/**
+ * Narrows the 64-bit result of arithmetic on two int32 fields, raising if
+ * it does not fit. Widening keeps the check portable to compilers without
+ * overflow builtins, and no sum or product of two int32 values overflows
+ * 64 bits.
+ */
+static inline int32_t HLPeriodValueNarrow(int64_t result, const char* op, int32_t val1, int32_t val2) {
+    if (__builtin_expect(result < INT32_MIN || result > INT32_MAX, 0)) {
+        HLRaiseArithmeticOverflow(op, val1, val2);
+    }
+    return (int32_t) result;
+}
+
+/**
+ * Adds an amount to one slot in place.
+ *
+ * @throws UnsupportedOperationException if the amount is non-zero and the slot unsupported
+ * @throws ArithmeticException if the result exceeds the int32 range
+ */
+static inline void HLPeriodValueAddSlot(HLPeriodValue* value, HLPeriodSlot slot, int32_t amount) {
+    if (amount == 0) {
+        return;
+    }
+    if (__builtin_expect(!HLPeriodValueIsSupported(value, slot), 0)) {
+        HLPeriodValueRaiseUnsupported(value, HL_PERIOD_SLOT_BIT(slot));
+    }
+    value->values[slot] = HLPeriodValueNarrow((int64_t) value->values[slot] + amount,
+                                              "+", value->values[slot], amount);
+}
+
+/**
+ * Adds every field of a period to a value in place, as Period.plus does.
+ *
+ * @throws UnsupportedOperationException if the period has a non-zero field the value does not support
+ * @throws ArithmeticException if a field exceeds the int32 range
+ */
+static inline void HLPeriodValueAdd(HLPeriodValue* value, const HLPeriodValue* period) {
+    uint16_t unsupported = HLPeriodValueNonZeroMask(period) & ~value->typeMask;
+    if (__builtin_expect(unsupported != 0, 0)) {
+        HLPeriodValueRaiseUnsupported(value, unsupported);
+    }
+    int overflow = 0;
+    int32_t sums[HL_PERIOD_SLOT_COUNT];
+    for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        int64_t sum = (int64_t) value->values[slot] + period->values[slot];
+        overflow |= (sum < INT32_MIN) | (sum > INT32_MAX);
+        sums[slot] = (int32_t) sum;
+    }
+    if (__builtin_expect(overflow, 0)) {
+        for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+            HLPeriodValueAddSlot(value, (HLPeriodSlot) slot, period->values[slot]);
+        }
+        return;
+    }
+    memcpy(value->values, sums, sizeof(sums));
+}
+
+/**
+ * Subtracts every field of a period from a value in place, as Period.minus does.
+ *
+ * @throws UnsupportedOperationException if the period has a non-zero field the value does not support
+ * @throws ArithmeticException if a field exceeds the int32 range
+ */
+static inline void HLPeriodValueSubtract(HLPeriodValue* value, const HLPeriodValue* period) {
+    uint16_t unsupported = HLPeriodValueNonZeroMask(period) & ~value->typeMask;
+    if (__builtin_expect(unsupported != 0, 0)) {
+        HLPeriodValueRaiseUnsupported(value, unsupported);
+    }
+    for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        value->values[slot] = HLPeriodValueNarrow((int64_t) value->values[slot] - period->values[slot],
+                                                  "-", value->values[slot], period->values[slot]);
+    }
+}
+
+/**
+ * Multiplies every field by a scalar in place, as Period.multipliedBy does.
+ *
+ * @throws ArithmeticException if a field exceeds the int32 range
+ */
+static inline void HLPeriodValueMultiply(HLPeriodValue* value, int32_t scalar) {
+    for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        value->values[slot] = HLPeriodValueNarrow((int64_t) value->values[slot] * scalar,
+                                                  "*", value->values[slot], scalar);
+    }
+}
+
+//-----------------------------------------------------------------------
+/**
+ * Sums an array of periods into a value in place. Only the final sum has to
+ * fit each field, rather than every partial sum as with repeated plus.
+ *
+ * @param sum  the value to add to, its type decides the supported fields
+ * @param periods  the periods to add
+ * @param count  the number of periods
+ * @throws UnsupportedOperationException if a period has a non-zero field the sum does not support
+ * @throws ArithmeticException if a field exceeds the int32 range
+ */
+extern void HLPeriodValueSum(HLPeriodValue* sum, const HLPeriodValue* periods, NSUInteger count);
+
+/**
+ * Gets the standard duration of a period in millis, assuming a 7 day week,
+ * 24 hour day, 60 minute hour and 60 second minute, as
+ * Period.toStandardDuration does.
+ *
+ * @throws UnsupportedOperationException if the period contains years or months
+ */
+extern int64_t HLPeriodValueStandardDurationMillis(const HLPeriodValue* value);
+
+/**
+ * Normalizes a period in place using standard rules, as
+ * Period.normalizedStandard does: the weeks to millis are spread over the
+ * precise slots of the type mask, and months beyond eleven carry into
+ * years. The value takes the given type mask.
+ *
+ * @param value  the period to normalize
+ * @param typeMask  the type of the result, HL_PERIOD_MASK_STANDARD for the standard type
+ * @throws ArithmeticException if any field is too large to be represented
+ * @throws UnsupportedOperationException if the period has years or months the type cannot hold
+ */
+extern void HLPeriodValueNormalizeStandard(HLPeriodValue* value, uint16_t typeMask);
+
+//-----------------------------------------------------------------------
+/**
+ * Reads a period into a value with the same type.
+ *
+ * @param period  the period to read, nil means zero of the standard type
+ */
+extern HLPeriodValue HLPeriodValueFromPeriod(id<HLReadablePeriod> period);
+
+/**
+ * Creates an immutable period from a value.
+ *
+ * @return the autoreleased period
+ */
+extern HLPeriod* HLPeriodValueToPeriod(HLPeriodValue value);
+
+/**
+ * Creates the standard duration of a period value.
+ *
+ * @return the autoreleased duration
+ * @throws UnsupportedOperationException if the period contains years or months
+ */
+extern HLDuration* HLPeriodValueToStandardDuration(HLPeriodValue value);
@@ -0,0 +1,190 @@
+/*
+ * PeriodValue.m
+ *
+ * Horologe
+ * Copyright (c) 2011 Pilgrimage Software
+ *
+ * A Cocoa version of the Joda-Time Java date/time library.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "HLPeriodValue.h"
+
+#import "HLConstants.h"
+#import "HLDuration.h"
+#import "HLDurationFieldType.h"
+#import "HLPeriod.h"
+#import "HLPeriodType.h"
+#import "HLReadablePeriod.h"
+
+
+const int64_t HLPeriodSlotStandardMillis[HL_PERIOD_SLOT_COUNT] = {
+    0,
+    0,
+    604800000LL,
+    86400000LL,
+    3600000LL,
+    60000LL,
+    1000LL,
+    1LL,
+};
+
+static const HLDurationFieldType* HLPeriodSlotFieldType(HLPeriodSlot slot) {
+    switch (slot) {
+        case HLPeriodSlotYears:
+            return [HLDurationFieldType years];
+        case HLPeriodSlotMonths:
+            return [HLDurationFieldType months];
+        case HLPeriodSlotWeeks:
+            return [HLDurationFieldType weeks];
+        case HLPeriodSlotDays:
+            return [HLDurationFieldType days];
+        case HLPeriodSlotHours:
+            return [HLDurationFieldType hours];
+        case HLPeriodSlotMinutes:
+            return [HLDurationFieldType minutes];
+        case HLPeriodSlotSeconds:
+            return [HLDurationFieldType seconds];
+        default:
+            return [HLDurationFieldType millis];
+    }
+}
+
+void HLPeriodValueRaiseUnsupported(const HLPeriodValue* value, uint16_t amountMask) {
+    NSMutableArray* names = [NSMutableArray array];
+    for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        if (amountMask & HL_PERIOD_SLOT_BIT(slot) & ~value->typeMask) {
+            [names addObject:[HLPeriodSlotFieldType((HLPeriodSlot) slot) name]];
+        }
+    }
+    [NSException raise:HL_UNSUPPORTED_OPERATION_EXCEPTION
+                format:@"Field is not supported: %@", [names componentsJoinedByString:@", "]];
+}
+
+//-----------------------------------------------------------------------
+void HLPeriodValueSum(HLPeriodValue* sum, const HLPeriodValue* periods, NSUInteger count) {
+    // accumulate in 64 bits and check the range once per chunk, which is
+    // small enough that the int32 values cannot overflow the totals
+    const NSUInteger chunk = 1u << 30;
+    int64_t totals[HL_PERIOD_SLOT_COUNT];
+    uint16_t nonZero = 0;
+    for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        totals[slot] = sum->values[slot];
+    }
+    for(NSUInteger start = 0; start < count; start += chunk) {
+        NSUInteger end = count - start > chunk ? start + chunk : count;
+        for(NSUInteger i = start; i < end; i++) {
+            for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+                totals[slot] += periods[i].values[slot];
+            }
+            nonZero |= HLPeriodValueNonZeroMask(&periods[i]);
+        }
+        for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+            if (totals[slot] < INT32_MIN || totals[slot] > INT32_MAX) {
+                HLRaiseArithmeticOverflow("+", sum->values[slot], totals[slot] - sum->values[slot]);
+            }
+        }
+    }
+    if (nonZero & ~sum->typeMask) {
+        HLPeriodValueRaiseUnsupported(sum, nonZero);
+    }
+    for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        sum->values[slot] = (int32_t) totals[slot];
+    }
+}
+
+static void HLPeriodValueCheckYearsAndMonths(const HLPeriodValue* value, NSString* destinationType) {
+    if (value->values[HLPeriodSlotMonths] != 0) {
+        [NSException raise:HL_UNSUPPORTED_OPERATION_EXCEPTION
+                    format:@"Cannot convert to %@ as this period contains months and months vary in length",
+         destinationType];
+    }
+    if (value->values[HLPeriodSlotYears] != 0) {
+        [NSException raise:HL_UNSUPPORTED_OPERATION_EXCEPTION
+                    format:@"Cannot convert to %@ as this period contains years and years vary in length",
+         destinationType];
+    }
+}
+
+static inline int64_t HLPeriodValuePreciseMillis(const HLPeriodValue* value) {
+    // no overflow can happen, even with INT32_MAX in every slot
+    int64_t millis = 0;
+    for(int slot = HLPeriodSlotWeeks; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        millis += (int64_t) value->values[slot] * HLPeriodSlotStandardMillis[slot];
+    }
+    return millis;
+}
+
+int64_t HLPeriodValueStandardDurationMillis(const HLPeriodValue* value) {
+    HLPeriodValueCheckYearsAndMonths(value, @"Duration");
+    return HLPeriodValuePreciseMillis(value);
+}
+
+void HLPeriodValueNormalizeStandard(HLPeriodValue* value, uint16_t typeMask) {
+    int64_t millis = HLPeriodValuePreciseMillis(value);
+    int32_t years = value->values[HLPeriodSlotYears];
+    int32_t months = value->values[HLPeriodSlotMonths];
+
+    HLPeriodValue result = HLPeriodValueZero(typeMask);
+    for(int slot = HLPeriodSlotWeeks; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        if (HLPeriodValueIsSupported(&result, (HLPeriodSlot) slot)) {
+            int64_t amount = millis / HLPeriodSlotStandardMillis[slot];
+            if (amount < INT32_MIN || amount > INT32_MAX) {
+                HLRaiseArithmeticOverflow("(int32_t)", amount, 0);
+            }
+            result.values[slot] = (int32_t) amount;
+            millis -= amount * HLPeriodSlotStandardMillis[slot];
+        }
+    }
+    if (years != 0 || months != 0) {
+        int32_t carried = HLPeriodValueNarrow((int64_t) years + months / 12, "+", years, months / 12);
+        HLPeriodValueAddSlot(&result, HLPeriodSlotYears, carried);
+        HLPeriodValueAddSlot(&result, HLPeriodSlotMonths, months % 12);
+    }
+    *value = result;
+}
+
+//-----------------------------------------------------------------------
+HLPeriodValue HLPeriodValueFromPeriod(id<HLReadablePeriod> period) {
+    if (period == nil) {
+        return HLPeriodValueZero(HL_PERIOD_MASK_STANDARD);
+    }
+    HLPeriodValue value = HLPeriodValueZero([[period periodType] fieldMask]);
+    for(int slot = 0; slot < HL_PERIOD_SLOT_COUNT; slot++) {
+        if (HLPeriodValueIsSupported(&value, (HLPeriodSlot) slot)) {
+            NSInteger amount = [period valueOfFieldType:(HLDurationFieldType*) HLPeriodSlotFieldType((HLPeriodSlot) slot)];
+            if (amount < INT32_MIN || amount > INT32_MAX) {
+                HLRaiseArithmeticOverflow("(int32_t)", amount, 0);
+            }
+            value.values[slot] = (int32_t) amount;
+        }
+    }
+    return value;
+}
+
+HLPeriod* HLPeriodValueToPeriod(HLPeriodValue value) {
+    return [[[HLPeriod alloc] initWithYears:value.values[HLPeriodSlotYears]
+                                     months:value.values[HLPeriodSlotMonths]
+                                      weeks:value.values[HLPeriodSlotWeeks]
+                                       days:value.values[HLPeriodSlotDays]
+                                      hours:value.values[HLPeriodSlotHours]
+                                    minutes:value.values[HLPeriodSlotMinutes]
+                                    seconds:value.values[HLPeriodSlotSeconds]
+                                     millis:value.values[HLPeriodSlotMillis]
+                                       type:[HLPeriodType forFieldMask:value.typeMask]] autorelease];
+}
+
+HLDuration* HLPeriodValueToStandardDuration(HLPeriodValue value) {
+    return [[[HLDuration alloc] initWithDurationValue:HLPeriodValueStandardDurationMillis(&value)] autorelease];
+}
@@ -233,7 +233,7 @@
  * @param millis  the milliseconds to add
  * @throws IllegalArgumentException if the value is invalid
  */
-- (void)addMillis:(NSInteger)millis;
+- (void)addMillis:(int64_t)millis;
 
 /**
  * Set the date from fields.
@@ -50,7 +50,7 @@
  * instant to
  * @throws IllegalArgumentException if the value is invalid
  */
-- (void)setMillis:(NSInteger)instant;
+- (void)setMillis:(int64_t)instant;
 
 /**
  * Sets the millisecond instant of this instant from another.
@@ -108,7 +108,7 @@
  * @param duration  the millis to add
  * @throws IllegalArgumentException if the value is invalid
  */
-- (void)add:(NSInteger)duration;
+- (void)add:(int64_t)duration;
 
 /**
  * Adds a duration to this instant.
@@ -44,8 +44,8 @@
  * @param endInstant  the start of the time interval
  * @throws IllegalArgumentException if the end is before the start
  */
-- (void)setIntervalStartValue:(NSInteger)startInstant 
-                     endValue:(NSInteger)endInstant);
+- (void)setIntervalStartValue:(int64_t)startInstant 
+                     endValue:(int64_t)endInstant);
 
 /**
  * Sets this interval to be the same as another.
@@ -81,7 +81,7 @@
  *  millisecond instant from 1970-01-01T00:00:00Z
  * @throws IllegalArgumentException if the end is before the start
  */
-- (void)setStartMillis:(NSInteger)millisInstant;
+- (void)setStartMillis:(int64_t)millisInstant;
 
 /**
  * Sets the start of this time interval as an Instant.
@@ -99,7 +99,7 @@
  *  millisecond instant from 1970-01-01T00:00:00Z
  * @throws IllegalArgumentException if the end is before the start
  */
-- (void)setEndMillis:(NSInteger)millisInstant;
+- (void)setEndMillis:(int64_t)millisInstant;
 
 /** 
  * Sets the end of this time interval as an Instant.
@@ -93,7 +93,7 @@
                  hours:(NSInteger)hours
                minutes:(NSInteger)minutes
                seconds:(NSInteger)seconds
-                millis:(NSInteger)millis;
+                millis:(int64_t)millis;
 
 /**
  * Sets all the fields in one go from an interval dividing the
@@ -148,7 +148,7 @@
            hours:(NSInteger)hours
          minutes:(NSInteger)minutes
          seconds:(NSInteger)seconds 
-          millis:(NSInteger)millis;
+          millis:(int64_t)millis;
 
 /**
  * Adds an interval to this one by dividing the interval into
@@ -292,7 +292,7 @@
  * @param millis  the number of millis
  * @throws IllegalArgumentException if field is not supported and the value is non-zero
  */
-- (void)setMillis:(NSInteger)millis;
+- (void)setMillis:(int64_t)millis;
 
 /**
  * Adds the specified millis to the number of millis in the period.
@@ -301,6 +301,6 @@
  * @throws IllegalArgumentException if field is not supported and the value is non-zero
  * @throws ArithmeticException if the addition exceeds the capacity of the period
  */
-- (void)addMillis:(NSInteger)millis;
+- (void)addMillis:(int64_t)millis;
 
 @end
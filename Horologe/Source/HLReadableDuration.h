@@ -47,7 +47,7 @@
  *
  * @return the total length of the time duration in milliseconds.
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 //-----------------------------------------------------------------------
 /**
@@ -49,7 +49,7 @@
  *
  * @return the value as milliseconds
  */
-- (NSInteger)millis;
+- (int64_t)millis;
 
 /**
  * Gets the chronology of the instant.
@@ -71,7 +71,7 @@
  * @return the start of the time interval,
  *  millisecond instant from 1970-01-01T00:00:00Z
  */
-- (NSInteger)startMillis;
+- (int64_t)startMillis;
 
 /**
  * Gets the start of this time interval, which is inclusive, as a DateTime.
@@ -86,7 +86,7 @@
  * @return the end of the time interval,
  *  millisecond instant from 1970-01-01T00:00:00Z
  */
-- (NSInteger)endMillis;
+- (int64_t)endMillis;
 
 /** 
  * Gets the end of this time interval, which is exclusive, as a DateTime.
@@ -270,7 +270,7 @@
  * @return the millisecond duration of the time interval
  * @throws ArithmeticException if the duration exceeds the capacity of a long
  */
-- (NSInteger)toDurationMillis;
+- (int64_t)toDurationMillis;
 
 /**
  * Converts the duration of the interval to a period using the
@@ -187,7 +187,7 @@
  *
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  */
-- (id)initWithInstantValue:(NSInteger)instant;
+- (id)initWithInstantValue:(int64_t)instant;
 
 /**
  * Constructs a TimeOfDay extracting the partial fields from the specified
@@ -200,7 +200,7 @@
  * @param instant  the milliseconds from 1970-01-01T00:00:00Z
  * @param chronology  the chronology, nil means ISOChronology in the default zone
  */
-- (id)initWithInstantValue:(NSInteger)instant
+- (id)initWithInstantValue:(int64_t)instant
                 chronology:(HLChronology*)chronology;
 
 /**
@@ -219,7 +219,7 @@
  * @param instant  the datetime object, nil means now
  * @throws IllegalArgumentException if the instant is invalid
  */
-- (id)initWithInstantValue:(NSInteger)instant;
+- (id)initWithInstantValue:(int64_t)instant;
 
 /**
  * Constructs a TimeOfDay from an Object that represents a time, using the
@@ -568,7 +568,7 @@
  * @return the new time plus the increased millis
  * @since 1.1
  */
-- (HLTimeOfDay*)plusMillis:(NSInteger)millis;
+- (HLTimeOfDay*)plusMillis:(int64_t)millis;
 
 //-----------------------------------------------------------------------
 /**
@@ -658,7 +658,7 @@
  * @return the new time minus the increased millis
  * @since 1.1
  */
-- (HLTimeOfDay*)minusMillis:(NSInteger)millis;
+- (HLTimeOfDay*)minusMillis:(int64_t)millis;
 
 //-----------------------------------------------------------------------
 /**
@@ -787,7 +787,7 @@
  * @throws IllegalArgumentException if the value is invalid
  * @since 1.3
  */
-- (HLTimeOfDay*)withMillisOfSecond:(NSInteger)millis;
+- (HLTimeOfDay*)withMillisOfSecond:(int64_t)millis;
 
 //-----------------------------------------------------------------------
 /**
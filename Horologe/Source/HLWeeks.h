@@ -72,7 +72,9 @@ extern const HLWeeks* HL_WEEKS_MIN_VALUE;
 /**
  * Obtains an instance of <code>Weeks</code> that may be cached.
  * <code>Weeks</code> is immutable, so instances can be cached and shared.
- * This factory method provides access to shared instances.
+ * This factory method provides access to shared instances, which are
+ * preallocated for values from HL_PERIOD_POOL_MIN to HL_PERIOD_POOL_MAX,
+ * so arithmetic on small periods does not allocate.
  *
  * @param weeks  the number of weeks to obtain an instance for
  * @return the instance of Weeks
@@ -323,7 +325,8 @@ extern const HLWeeks* HL_WEEKS_MIN_VALUE;
  *
  * @param divisor  the amount to divide by, may be negative
  * @return the new period divided by the specified divisor
- * @throws ArithmeticException if the divisor is zero
+ * @throws ArithmeticException if the divisor is zero, or is -1 and the
+ *  result overflows an int
  */
 - (HLWeeks*)dividedBy:(NSInteger)divisor;
 
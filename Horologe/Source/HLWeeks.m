@@ -21,55 +21,121 @@
 
 #import "HLWeeks.h"
 
+#import "HLConstants.h"
+#import "HLFieldUtils.h"
+
 
 /** Constant representing zero weeks. */
-static HLWeeks* HL_WEEKS_ZERO = [[HLWeeks alloc] initWithPeriod:0];
+const HLWeeks* HL_WEEKS_ZERO;
 /** Constant representing one week. */
-static HLWeeks* HL_WEEKS_ONE = [[HLWeeks alloc] initWithPeriod:1];
+const HLWeeks* HL_WEEKS_ONE;
 /** Constant representing two weeks. */
-static HLWeeks* HL_WEEKS_TWO = [[HLWeeks alloc] initWithPeriod:2];
+const HLWeeks* HL_WEEKS_TWO;
 /** Constant representing three weeks. */
-static HLWeeks* HL_WEEKS_THREE = [[HLWeeks alloc] initWithPeriod:3];
+const HLWeeks* HL_WEEKS_THREE;
 /** Constant representing the maximum number of weeks that can be stored in this object. */
-static HLWeeks* HL_WEEKS_MAX_VALUE = [[HLWeeks alloc] initWithPeriod:NSIntegerMax];
+const HLWeeks* HL_WEEKS_MAX_VALUE;
 /** Constant representing the minimum number of weeks that can be stored in this object. */
-static HLWeeks* HL_WEEKS_MIN_VALUE = [[HLWeeks alloc] initWithPeriod:NSIntegerMin];
+const HLWeeks* HL_WEEKS_MIN_VALUE;
+
+/** The shared instances for small numbers of weeks. */
+static HLPeriodPool sWeeksPool;
 
 @implementation HLWeeks
 
++ (void)initialize {
+    if (self == [HLWeeks class]) {
+        HLPeriodPoolFill(&sWeeksPool, [HLWeeks class]);
+        HL_WEEKS_ZERO = [HLWeeks weeks:0];
+        HL_WEEKS_ONE = [HLWeeks weeks:1];
+        HL_WEEKS_TWO = [HLWeeks weeks:2];
+        HL_WEEKS_THREE = [HLWeeks weeks:3];
+        HL_WEEKS_MAX_VALUE = [[HLWeeks alloc] initWithPeriod:NSIntegerMax];
+        HL_WEEKS_MIN_VALUE = [[HLWeeks alloc] initWithPeriod:NSIntegerMin];
+    }
+}
+
+//-----------------------------------------------------------------------
++ (HLWeeks*)weeks:(NSInteger)weeks {
+    HLWeeks* pooled = HLPeriodPoolValue(&sWeeksPool, weeks);
+    if (pooled != nil) {
+        return pooled;
+    }
+    switch (weeks) {
+        case NSIntegerMax:
+            return (HLWeeks*) HL_WEEKS_MAX_VALUE;
+        case NSIntegerMin:
+            return (HLWeeks*) HL_WEEKS_MIN_VALUE;
+        default:
+            return [[[HLWeeks alloc] initWithPeriod:weeks] autorelease];
+    }
+}
+
+//-----------------------------------------------------------------------
+- (HLWeeks*)plusWeeksValue:(NSInteger)weeks {
+    if (weeks == 0) {
+        return self;
+    }
+    
+    return [HLWeeks weeks:HLSafeToInteger(HLSafeAdd([self value], weeks))];
+}
+
+- (HLWeeks*)plusWeeks:(HLWeeks*)weeks {
+    if (weeks == nil) {
+        return self;
+    }
+    
+    return [self plusWeeksValue:[weeks value]];
+}
+
+//-----------------------------------------------------------------------
+- (HLWeeks*)minusWeeksValue:(NSInteger)weeks {
+    return [self plusWeeksValue:HLSafeToInteger(HLSafeNegate(weeks))];
+}
+
+- (HLWeeks*)minusWeeks:(HLWeeks*)weeks {
+    if (weeks == nil) {
+        return self;
+    }
+    
+    return [self minusWeeksValue:[weeks value]];
+}
+
+//-----------------------------------------------------------------------
+- (HLWeeks*)multipliedBy:(NSInteger)scalar {
+    return [HLWeeks weeks:HLSafeToInteger(HLSafeMultiply([self value], scalar))];
+}
+
+- (HLWeeks*)dividedBy:(NSInteger)divisor {
+    if (divisor == 1) {
+        return self;
+    }
+    if (divisor == -1) {
+        // NSIntegerMin / -1 traps rather than wrapping, so check it as a negation
+        return [self negated];
+    }
+    if (divisor == 0) {
+        [NSException raise:HL_ARITHMETIC_EXCEPTION format:@"Division by zero"];
+    }
+    
+    return [HLWeeks weeks:([self value] / divisor)];
+}
+
+//-----------------------------------------------------------------------
+- (HLWeeks*)negated {
+    return [HLWeeks weeks:HLSafeToInteger(HLSafeNegate([self value]))];
+}
+
+@end
+
+
+@implementation Weeks
+
     /** The paser to use for this class. */
     private static final PeriodFormatter PARSER = ISOPeriodFormat.standard().withParseType(PeriodType.weeks());
     /** Serialization version. */
     private static final long serialVersionUID = 87525275727380866L;
 
-    //-----------------------------------------------------------------------
-    /**
-     * Obtains an instance of <code>Weeks</code> that may be cached.
-     * <code>Weeks</code> is immutable, so instances can be cached and shared.
-     * This factory method provides access to shared instances.
-     *
-     * @param weeks  the number of weeks to obtain an instance for
-     * @return the instance of Weeks
-     */
-    public static Weeks weeks:(NSInteger) weeks) {
-        switch (weeks) {
-            case 0:
-                return ZERO;
-            case 1:
-                return ONE;
-            case 2:
-                return TWO;
-            case 3:
-                return THREE;
-            case Integer.MAX_VALUE:
-                return MAX_VALUE;
-            case Integer.MIN_VALUE:
-                return MIN_VALUE;
-            default:
-                return new Weeks(weeks);
-        }
-    }
-
     //-----------------------------------------------------------------------
     /**
      * Creates a <code>Weeks</code> representing the number of whole weeks
@@ -311,111 +377,6 @@ static HLWeeks* HL_WEEKS_MIN_VALUE = [[HLWeeks alloc] initWithPeriod:NSIntegerMi
         return getValue();
     }
 
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the specified number of weeks added.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param weeks  the amount of weeks to add, may be negative
-     * @return the new period plus the specified number of weeks
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Weeks plus:(NSInteger) weeks) {
-        if (weeks == 0) {
-            return this;
-        }
-        return Weeks.weeks(FieldUtils.safeAdd(getValue(), weeks));
-    }
-
-    /**
-     * Returns a new instance with the specified number of weeks added.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param weeks  the amount of weeks to add, may be negative, nil means zero
-     * @return the new period plus the specified number of weeks
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Weeks plus(Weeks weeks) {
-        if (weeks == nil) {
-            return this;
-        }
-        return plus(weeks.getValue());
-    }
-
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the specified number of weeks taken away.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param weeks  the amount of weeks to take away, may be negative
-     * @return the new period minus the specified number of weeks
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Weeks minus:(NSInteger) weeks) {
-        return plus(FieldUtils.safeNegate(weeks));
-    }
-
-    /**
-     * Returns a new instance with the specified number of weeks taken away.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param weeks  the amount of weeks to take away, may be negative, nil means zero
-     * @return the new period minus the specified number of weeks
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Weeks minus(Weeks weeks) {
-        if (weeks == nil) {
-            return this;
-        }
-        return minus(weeks.getValue());
-    }
-
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the weeks multiplied by the specified scalar.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param scalar  the amount to multiply by, may be negative
-     * @return the new period multiplied by the specified scalar
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Weeks multipliedBy:(NSInteger) scalar) {
-        return Weeks.weeks(FieldUtils.safeMultiply(getValue(), scalar));
-    }
-
-    /**
-     * Returns a new instance with the weeks divided by the specified divisor.
-     * The calculation uses integer division, thus 3 divided by 2 is 1.
-     * <p>
-     * This instance is immutable and unaffected by this method call.
-     *
-     * @param divisor  the amount to divide by, may be negative
-     * @return the new period divided by the specified divisor
-     * @throws ArithmeticException if the divisor is zero
-     */
-    public Weeks dividedBy:(NSInteger) divisor) {
-        if (divisor == 1) {
-            return this;
-        }
-        return Weeks.weeks(getValue() / divisor);
-    }
-
-    //-----------------------------------------------------------------------
-    /**
-     * Returns a new instance with the weeks value negated.
-     *
-     * @return the new period with a negated value
-     * @throws ArithmeticException if the result overflows an int
-     */
-    public Weeks negated {
-        return Weeks.weeks(FieldUtils.safeNegate(getValue()));
-    }
-
     //-----------------------------------------------------------------------
     /**
      * Is this weeks instance greater than the specified number of weeks.
@@ -22,6 +22,7 @@
 #import "HLYears.h"
 
 #import "HLPeriod.h"
+#import "HLConstants.h"
 #import "HLFieldUtils.h"
 #import "HLDurationFieldType.h"
 #import "HLPeriodType.h"
@@ -29,34 +30,51 @@
 #import "HLLocalDate.h"
 
 
-static HLYears* HL_YEARS_ZERO = [[HLYears alloc] initWithYears:0];
-static HLYears* HL_YEARS_ONE = [[HLYears alloc] initWithYears:0];
-static HLYears* HL_YEARS_TWO = [[HLYears alloc] initWithYears:0];
-static HLYears* HL_YEARS_THREE = [[HLYears alloc] initWithYears:0];
-static HLYears* HL_YEARS_MIN_VALUE = [[HLYears alloc] initWithYears:NSIntegerMin];
-static HLYears* HL_YEARS_MAX_VALUE = [[HLYears alloc] initWithYears:NSIntegerMax];
+/** Constant representing zero years. */
+const HLYears* HL_YEARS_ZERO;
+/** Constant representing one year. */
+const HLYears* HL_YEARS_ONE;
+/** Constant representing two years. */
+const HLYears* HL_YEARS_TWO;
+/** Constant representing three years. */
+const HLYears* HL_YEARS_THREE;
+/** Constant representing the maximum number of years that can be stored in this object. */
+const HLYears* HL_YEARS_MAX_VALUE;
+/** Constant representing the minimum number of years that can be stored in this object. */
+const HLYears* HL_YEARS_MIN_VALUE;
+
+/** The shared instances for small numbers of years. */
+static HLPeriodPool sYearsPool;
 
 static HLPeriodFormatter* parser;
 
 @implementation HLYears
 
++ (void)initialize {
+    if (self == [HLYears class]) {
+        HLPeriodPoolFill(&sYearsPool, [HLYears class]);
+        HL_YEARS_ZERO = [HLYears years:0];
+        HL_YEARS_ONE = [HLYears years:1];
+        HL_YEARS_TWO = [HLYears years:2];
+        HL_YEARS_THREE = [HLYears years:3];
+        HL_YEARS_MAX_VALUE = [[HLYears alloc] initWithPeriod:NSIntegerMax];
+        HL_YEARS_MIN_VALUE = [[HLYears alloc] initWithPeriod:NSIntegerMin];
+    }
+}
+
 //-----------------------------------------------------------------------
 + (HLYears*)years:(NSInteger)years {
+    HLYears* pooled = HLPeriodPoolValue(&sYearsPool, years);
+    if (pooled != nil) {
+        return pooled;
+    }
     switch (years) {
-        case 0:
-            return HL_YEARS_ZERO;
-        case 1:
-            return HL_YEARS_ONE;
-        case 2:
-            return HL_YEARS_TWO;
-        case 3:
-            return HL_YEARS_THREE;
         case NSIntegerMax:
-            return HL_YEARS_MAX_VALUE;
+            return (HLYears*) HL_YEARS_MAX_VALUE;
         case NSIntegerMin:
-            return HL_YEARS_MIN_VALUE;
+            return (HLYears*) HL_YEARS_MIN_VALUE;
         default:
-            return [[HLYears alloc] initWithYears:years];
+            return [[[HLYears alloc] initWithPeriod:years] autorelease];
     }
 }
 
@@ -107,7 +125,7 @@ static HLPeriodFormatter* parser;
 
 //-----------------------------------------------------------------------
 - (id)initWithYears:(NSInteger)years {
-    self = [super initWithValue:years];
+    self = [super initWithPeriod:years];
     if(self) {
         
     }
@@ -139,8 +157,7 @@ static HLPeriodFormatter* parser;
         return self;
     }
     
-    return [HLYears years:[HLFieldUtils safeAddValue:[self value]
-                                            andValue:years]];
+    return [HLYears years:HLSafeToInteger(HLSafeAdd([self value], years))];
 }
 
 - (HLYears*)plusYears:(HLYears*)years {
@@ -148,12 +165,12 @@ static HLPeriodFormatter* parser;
         return self;
     }
     
-    return [self plus:[years value]];
+    return [self plusYearsValue:[years value]];
 }
 
 //-----------------------------------------------------------------------
 - (HLYears*)minusYearsValue:(NSInteger)years {
-    return [self plus:[HLFieldUtils safeNegate:years]]
+    return [self plusYearsValue:HLSafeToInteger(HLSafeNegate(years))];
 }
 
 - (HLYears*)minusYears:(HLYears*)years {
@@ -161,26 +178,32 @@ static HLPeriodFormatter* parser;
         return self;
     }
     
-    return [self minus:[years value]];
+    return [self minusYearsValue:[years value]];
 }
 
 //-----------------------------------------------------------------------
 - (HLYears*)multipliedBy:(NSInteger)scalar {
-    return [HLYears years:[HLFieldUtils safeMultiplyValue:[self value]
-                                                   andScalar:scalar]];
+    return [HLYears years:HLSafeToInteger(HLSafeMultiply([self value], scalar))];
 }
 
 - (HLYears*)dividedBy:(NSInteger)divisor {
     if (divisor == 1) {
         return self;
     }
+    if (divisor == -1) {
+        // NSIntegerMin / -1 traps rather than wrapping, so check it as a negation
+        return [self negated];
+    }
+    if (divisor == 0) {
+        [NSException raise:HL_ARITHMETIC_EXCEPTION format:@"Division by zero"];
+    }
     
     return [HLYears years:([self value] / divisor)];
 }
 
 //-----------------------------------------------------------------------
 - (HLYears*)negated {
-    return [HLYears years:[HLFieldUtils safeNegate:[self value]]];
+    return [HLYears years:HLSafeToInteger(HLSafeNegate([self value]))];
 }
 
 //-----------------------------------------------------------------------
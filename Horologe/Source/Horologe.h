@@ -7,7 +7,9 @@
 //
 
 #import <Horology/HLChronology.h>
+#import <Horology/HLClock.h>
 #import <Horology/HLDateMidnight.h>
+#import <Horology/HLDateBridge.h>
 #import <Horology/HLDateTime.h>
 #import <Horology/HLDateTimeComparator.h>
 #import <Horology/HLDateTimeConstants.h>
@@ -22,7 +24,11 @@
 #import <Horology/HLHours.h>
 #import <Horology/HLIllegalFieldValueException.h>
 #import <Horology/HLInstant.h>
+#import <Horology/HLInstantSort.h>
+#import <Horology/HLInstantValue.h>
 #import <Horology/HLInterval.h>
+#import <Horology/HLIntervalIndex.h>
+#import <Horology/HLIntervalSet.h>
 #import <Horology/HLHorologePermission.h>
 #import <Horology/HLLocalDate.h>
 #import <Horology/HLLocalDateTime.h>
@@ -35,6 +41,7 @@
 #import <Horology/HLPartial.h>
 #import <Horology/HLPeriod.h>
 #import <Horology/HLPeriodType.h>
+#import <Horology/HLPeriodValue.h>
 #import <Horology/HLReadableDateTime.h>
 #import <Horology/HLReadableDuration.h>
 #import <Horology/HLReadableInstant.h>
@@ -125,6 +132,7 @@
 #import <Horology/Field/HLDelegatedDateTimeField.h>
 #import <Horology/Field/HLDelegatedDurationField.h>
 #import <Horology/Field/HLDividedDateTimeField.h>
+#import <Horology/Field/HLFieldKernel.h>
 #import <Horology/Field/HLFieldUtils.h>
 #import <Horology/Field/HLImpreciseDateTimeField.h>
 #import <Horology/Field/HLLenientDateTimeField.h>
@@ -8,6 +8,200 @@
 
 #import "HorologeTests.h"
 
+#import "HLBaseSingleFieldPeriod.h"
+#import "HLChronology.h"
+#import "HLClock.h"
+#import "HLConstants.h"
+#import "HLDateBridge.h"
+#import "HLDateTime.h"
+#import "HLDateTimeComparator.h"
+#import "HLDateTimeFieldType.h"
+#import "HLDateTimeFormatter.h"
+#import "HLDateTimeZone.h"
+#import "HLDurationFieldType.h"
+#import "HLFieldUtils.h"
+#import "HLISOChronology.h"
+#import "HLISODateTimeFormat.h"
+#import "HLInstant.h"
+#import "HLInstantSort.h"
+#import "HLInstantValue.h"
+#import "HLIntervalIndex.h"
+#import "HLIntervalSet.h"
+#import "HLPeriodType.h"
+#import "HLPeriodValue.h"
+#import "HLStringConverter.h"
+
+
+#define HL_TEST_INTERVAL_COUNT (300)
+#define HL_TEST_INSTANT_COUNT (1000)
+#define HL_TEST_BENCHMARK_CALLS (1000000)
+
+static int HLTestCompareIdentifiers(const void* lhs, const void* rhs) {
+    NSUInteger a = *(const NSUInteger*) lhs;
+    NSUInteger b = *(const NSUInteger*) rhs;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+static int HLTestCompareMillis(const void* lhs, const void* rhs) {
+    int64_t a = *(const int64_t*) lhs;
+    int64_t b = *(const int64_t*) rhs;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+/*
+ * Picks millis with plenty of repeats, mostly small but some at either end
+ * of time and some differing only in their high bytes.
+ */
+static int64_t HLTestSampleMillis(void) {
+    switch (random() % 8) {
+        case 0:
+            return INT64_MIN + random() % 3;
+        case 1:
+            return INT64_MAX - random() % 3;
+        case 2:
+            return (int64_t) (random() % 3) << 40;
+        default:
+            return random() % 50 - 25;
+    }
+}
+
+/*
+ * Finds the intervals matching a query one by one, with the pairwise rules
+ * of Interval: 0 contains the instant start, 1 overlaps [start, end),
+ * 2 contains [start, end) and 3 lies within [start, end).
+ */
+static NSUInteger HLTestMatchIntervals(const int64_t* starts, const int64_t* ends, NSUInteger count,
+                                       int query, int64_t start, int64_t end, NSUInteger* matches) {
+    NSUInteger found = 0;
+    for(NSUInteger i = 0; i < count; i++) {
+        BOOL match;
+        switch (query) {
+            case 0:
+                match = starts[i] <= start && start < ends[i];
+                break;
+            case 1:
+                match = starts[i] < end && start < ends[i];
+                break;
+            case 2:
+                match = starts[i] <= start && start < ends[i] && end <= ends[i];
+                break;
+            default:
+                match = start <= starts[i] && starts[i] < end && ends[i] <= end;
+                break;
+        }
+        if (match) {
+            matches[found++] = i;
+        }
+    }
+    return found;
+}
+
+static NSUInteger HLTestQueryIndex(HLIntervalIndex* index, int query, int64_t start, int64_t end,
+                                   NSUInteger* buffer, NSUInteger capacity) {
+    switch (query) {
+        case 0:
+            return [index identifiersContainingInstant:start intoBuffer:buffer capacity:capacity];
+        case 1:
+            return [index identifiersOverlappingStartMillis:start endMillis:end intoBuffer:buffer capacity:capacity];
+        case 2:
+            return [index identifiersContainingStartMillis:start endMillis:end intoBuffer:buffer capacity:capacity];
+        default:
+            return [index identifiersContainedInStartMillis:start endMillis:end intoBuffer:buffer capacity:capacity];
+    }
+}
+
+static BOOL HLTestRunsContain(const int64_t* starts, const int64_t* ends, NSUInteger count, int64_t instant) {
+    for(NSUInteger i = 0; i < count; i++) {
+        if (starts[i] <= instant && instant < ends[i]) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+/*
+ * Checks that the runs of a set are sorted, non-empty and neither overlap
+ * nor abut.
+ */
+static BOOL HLTestSetIsNormalized(HLIntervalSet* set) {
+    const int64_t* starts = [set startMillis];
+    const int64_t* ends = [set endMillis];
+    for(NSUInteger i = 0; i < [set count]; i++) {
+        if (starts[i] >= ends[i] || (i + 1 < [set count] && ends[i] >= starts[i + 1])) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+/*
+ * Converts a string the way HLStringConverter does and the way the full
+ * ISO parser does, returning the name of the exception raised, if any.
+ */
+static NSString* HLTestConvertString(HLStringConverter* converter, HLChronology* chrono, NSString* text, 
+                                     int64_t* millis) {
+    @try {
+        *millis = [converter instantMillisFromInstant:text chronology:chrono];
+    }
+    @catch (NSException* exception) {
+        return [exception name];
+    }
+    return nil;
+}
+
+static NSString* HLTestParseString(HLChronology* chrono, NSString* text, int64_t* millis) {
+    @try {
+        *millis = [[[HLISODateTimeFormat dateTimeParser] withChronology:chrono] parseMillis:text];
+    }
+    @catch (NSException* exception) {
+        return [exception name];
+    }
+    return nil;
+}
+
+static HLDurationFieldType* HLTestPeriodFieldType(NSInteger index) {
+    switch (index) {
+        case HL_PERIOD_TYPE_YEAR_INDEX:
+            return (HLDurationFieldType*) [HLDurationFieldType years];
+        case HL_PERIOD_TYPE_MONTH_INDEX:
+            return (HLDurationFieldType*) [HLDurationFieldType months];
+        case HL_PERIOD_TYPE_WEEK_INDEX:
+            return (HLDurationFieldType*) [HLDurationFieldType weeks];
+        case HL_PERIOD_TYPE_DAY_INDEX:
+            return (HLDurationFieldType*) [HLDurationFieldType days];
+        case HL_PERIOD_TYPE_HOUR_INDEX:
+            return (HLDurationFieldType*) [HLDurationFieldType hours];
+        case HL_PERIOD_TYPE_MINUTE_INDEX:
+            return (HLDurationFieldType*) [HLDurationFieldType minutes];
+        case HL_PERIOD_TYPE_SECOND_INDEX:
+            return (HLDurationFieldType*) [HLDurationFieldType seconds];
+        default:
+            return (HLDurationFieldType*) [HLDurationFieldType millis];
+    }
+}
+
+static HLPeriodType* HLTestPeriodTypeWithFieldRemoved(HLPeriodType* type, NSInteger index) {
+    switch (index) {
+        case HL_PERIOD_TYPE_YEAR_INDEX:
+            return [type withYearsRemoved];
+        case HL_PERIOD_TYPE_MONTH_INDEX:
+            return [type withMonthsRemoved];
+        case HL_PERIOD_TYPE_WEEK_INDEX:
+            return [type withWeeksRemoved];
+        case HL_PERIOD_TYPE_DAY_INDEX:
+            return [type withDaysRemoved];
+        case HL_PERIOD_TYPE_HOUR_INDEX:
+            return [type withHoursRemoved];
+        case HL_PERIOD_TYPE_MINUTE_INDEX:
+            return [type withMinutesRemoved];
+        case HL_PERIOD_TYPE_SECOND_INDEX:
+            return [type withSecondsRemoved];
+        default:
+            return [type withMillisRemoved];
+    }
+}
+
+
 @implementation HorologeTests
 
 - (void)setUp
@@ -24,9 +218,1070 @@
     [super tearDown];
 }
 
-- (void)testExample
+//-----------------------------------------------------------------------
+- (void)testDateBridgeRoundTrip
+{
+    // 1.001 seconds is held as slightly less than 1001 millis
+    STAssertEquals(HLMillisFromTimeIntervalSince1970(HLTimeIntervalSince1970FromMillis(1001)), 1001LL, nil);
+    STAssertEquals(HLMillisFromAbsoluteTime(HLAbsoluteTimeFromMillis(1001)), 1001LL, nil);
+    
+    int64_t samples[] = { 0, 1, -1, 999, -999, 1001, -1001, 1234567890123LL, -1234567890123LL,
+                          HLAbsoluteTimeEpochMillis - 1, HLAbsoluteTimeEpochMillis + 1,
+                          (1LL << 51) - 1, -(1LL << 51) + 1 };
+    NSUInteger count = sizeof(samples) / sizeof(samples[0]);
+    for(NSUInteger i = 0; i < count; i++) {
+        int64_t millis = samples[i];
+        STAssertEquals(HLMillisFromTimeIntervalSince1970(HLTimeIntervalSince1970FromMillis(millis)), millis, 
+                       @"since 1970: %lld", millis);
+        STAssertEquals(HLMillisFromAbsoluteTime(HLAbsoluteTimeFromMillis(millis)), millis, 
+                       @"absolute time: %lld", millis);
+        STAssertEquals(HLMillisFromDate(HLDateFromMillis(millis)), millis, 
+                       @"date: %lld", millis);
+    }
+    
+    for(int64_t millis = -100000; millis <= 100000; millis++) {
+        if (HLMillisFromTimeIntervalSince1970(HLTimeIntervalSince1970FromMillis(millis)) != millis) {
+            STFail(@"since 1970: %lld", millis);
+            break;
+        }
+    }
+    
+    NSTimeInterval intervals[count];
+    int64_t results[count];
+    HLTimeIntervalsSince1970FromMillis(samples, intervals, count);
+    HLMillisFromTimeIntervalsSince1970(intervals, results, count);
+    for(NSUInteger i = 0; i < count; i++) {
+        STAssertEquals(results[i], samples[i], @"buffer: %lld", samples[i]);
+    }
+}
+
+- (void)testDateBridgeRoundsDown
+{
+    STAssertEquals(HLMillisFromTimeIntervalSince1970(1.0004), 1000LL, nil);
+    STAssertEquals(HLMillisFromTimeIntervalSince1970(-0.0005), -1LL, nil);
+    STAssertEquals(HLMillisFromTimeIntervalSince1970(-1.0004), -1001LL, nil);
+}
+
+//-----------------------------------------------------------------------
+- (void)testIntervalIndexMatchesPairwiseQueries
+{
+    int64_t starts[HL_TEST_INTERVAL_COUNT];
+    int64_t ends[HL_TEST_INTERVAL_COUNT];
+    srandom(7);
+    for(NSUInteger i = 0; i < HL_TEST_INTERVAL_COUNT; i++) {
+        starts[i] = random() % 1000;
+        // a quarter are zero duration
+        ends[i] = starts[i] + (random() % 4 == 0 ? 0 : random() % 200);
+    }
+    // and a few at the end of time
+    for(NSUInteger i = 0; i < 5; i++) {
+        starts[i] = INT64_MAX - 10;
+        ends[i] = INT64_MAX;
+    }
+    
+    // one index built in a single sort, one by adding so it holds several runs
+    HLIntervalIndex* built = [[[HLIntervalIndex alloc] initWithStartMillis:starts
+                                                                 endMillis:ends
+                                                               identifiers:NULL
+                                                                     count:HL_TEST_INTERVAL_COUNT] autorelease];
+    HLIntervalIndex* added = [[[HLIntervalIndex alloc] init] autorelease];
+    for(NSUInteger i = 0; i < HL_TEST_INTERVAL_COUNT; i++) {
+        [added addStartMillis:starts[i] endMillis:ends[i] identifier:i];
+    }
+    STAssertEquals([added count], (NSUInteger) HL_TEST_INTERVAL_COUNT, nil);
+    
+    NSUInteger expected[HL_TEST_INTERVAL_COUNT];
+    NSUInteger actual[HL_TEST_INTERVAL_COUNT];
+    for(NSUInteger q = 0; q < 2000; q++) {
+        int64_t start = random() % 1300 - 100;
+        int64_t end = (q % 7 == 0 ? start : start + random() % 300);
+        if (q % 50 == 0) {
+            start = INT64_MAX - 5;
+            end = INT64_MAX;
+        }
+        for(int query = 0; query < 4; query++) {
+            NSUInteger found = HLTestMatchIntervals(starts, ends, HL_TEST_INTERVAL_COUNT, query, start, end, expected);
+            for(int which = 0; which < 2; which++) {
+                HLIntervalIndex* index = (which == 0 ? built : added);
+                NSUInteger count = HLTestQueryIndex(index, query, start, end, actual, HL_TEST_INTERVAL_COUNT);
+                qsort(actual, count, sizeof(NSUInteger), HLTestCompareIdentifiers);
+                STAssertEquals(count, found, @"query %d of [%lld, %lld)", query, start, end);
+                if (count == found && memcmp(actual, expected, found * sizeof(NSUInteger)) != 0) {
+                    STFail(@"query %d of [%lld, %lld) matched other intervals", query, start, end);
+                }
+            }
+        }
+    }
+}
+
+- (void)testIntervalIndexBoundaries
+{
+    int64_t starts[] = { 0, 10, 10, 20 };
+    int64_t ends[] = { 10, 20, 10, 30 };
+    HLIntervalIndex* index = [[[HLIntervalIndex alloc] initWithStartMillis:starts
+                                                                 endMillis:ends
+                                                               identifiers:NULL
+                                                                     count:4] autorelease];
+    NSUInteger buffer[4];
+    
+    // intervals that abut the query do not overlap it
+    STAssertEquals([index identifiersOverlappingStartMillis:10 endMillis:20 intoBuffer:buffer capacity:4],
+                   (NSUInteger) 1, nil);
+    STAssertEquals(buffer[0], (NSUInteger) 1, nil);
+    STAssertFalse([index overlapsStartMillis:30 endMillis:40], nil);
+    STAssertTrue([index overlapsStartMillis:29 endMillis:40], nil);
+    
+    // an instant belongs to the interval it starts, not the one it ends
+    STAssertEquals([index identifiersContainingInstant:10 intoBuffer:buffer capacity:4], (NSUInteger) 1, nil);
+    STAssertEquals(buffer[0], (NSUInteger) 1, nil);
+    STAssertEquals([index identifiersContainingInstant:INT64_MAX intoBuffer:buffer capacity:4], (NSUInteger) 0, nil);
+    
+    // a zero duration interval overlaps a query it lies strictly within
+    STAssertEquals([index identifiersOverlappingStartMillis:5 endMillis:15 intoBuffer:buffer capacity:4],
+                   (NSUInteger) 3, nil);
+    
+    // the count is the total even when the buffer is too small
+    STAssertEquals([index identifiersOverlappingStartMillis:0 endMillis:30 intoBuffer:buffer capacity:1],
+                   (NSUInteger) 4, nil);
+    STAssertEquals([index identifiersContainedInStartMillis:0 endMillis:30 intoBuffer:NULL capacity:0],
+                   (NSUInteger) 4, nil);
+    
+    STAssertThrowsSpecificNamed([index addStartMillis:5 endMillis:4 identifier:4],
+                                NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
+    STAssertEquals([index count], (NSUInteger) 4, nil);
+}
+
+//-----------------------------------------------------------------------
+- (void)testIntervalSetAlgebraMatchesMembership
+{
+    srandom(11);
+    for(NSUInteger round = 0; round < 500; round++) {
+        int64_t aStarts[6], aEnds[6], bStarts[6], bEnds[6];
+        NSUInteger aCount = random() % 6;
+        NSUInteger bCount = random() % 6;
+        for(NSUInteger i = 0; i < aCount; i++) {
+            aStarts[i] = random() % 120;
+            aEnds[i] = aStarts[i] + random() % 30;
+        }
+        for(NSUInteger i = 0; i < bCount; i++) {
+            bStarts[i] = random() % 120;
+            bEnds[i] = bStarts[i] + random() % 30;
+        }
+        HLIntervalSet* a = [[[HLIntervalSet alloc] initWithStartMillis:aStarts endMillis:aEnds count:aCount] autorelease];
+        HLIntervalSet* b = [[[HLIntervalSet alloc] initWithStartMillis:bStarts endMillis:bEnds count:bCount] autorelease];
+        HLIntervalSet* both = [a unionWithSet:b];
+        HLIntervalSet* common = [a intersectionWithSet:b];
+        HLIntervalSet* only = [a differenceWithSet:b];
+        HLIntervalSet* gaps = [a complementWithinStartMillis:10 endMillis:100];
+        STAssertTrue(HLTestSetIsNormalized(a), @"%@", a);
+        STAssertTrue(HLTestSetIsNormalized(both), @"%@", both);
+        STAssertTrue(HLTestSetIsNormalized(common), @"%@", common);
+        STAssertTrue(HLTestSetIsNormalized(only), @"%@", only);
+        STAssertTrue(HLTestSetIsNormalized(gaps), @"%@", gaps);
+        
+        for(int64_t instant = -1; instant <= 160; instant++) {
+            BOOL inA = HLTestRunsContain(aStarts, aEnds, aCount, instant);
+            BOOL inB = HLTestRunsContain(bStarts, bEnds, bCount, instant);
+            if ([a containsInstant:instant] != inA ||
+                [both containsInstant:instant] != (inA || inB) ||
+                [common containsInstant:instant] != (inA && inB) ||
+                [only containsInstant:instant] != (inA && !inB) ||
+                [gaps containsInstant:instant] != (instant >= 10 && instant < 100 && !inA)) {
+                STFail(@"%lld in %@ and %@", instant, a, b);
+                return;
+            }
+        }
+        
+        // sets holding the same instants hold the same runs
+        STAssertEqualObjects([HLIntervalSet unionOfSets:[NSArray arrayWithObjects:a, b, nil]], both, nil);
+        STAssertEqualObjects([both differenceWithSet:[b differenceWithSet:a]], a, nil);
+    }
+}
+
+- (void)testIntervalSetAtEndOfTime
+{
+    int64_t aStart = INT64_MAX - 10;
+    int64_t bStart = INT64_MAX - 5;
+    int64_t end = INT64_MAX;
+    HLIntervalSet* a = [[[HLIntervalSet alloc] initWithStartMillis:&aStart endMillis:&end count:1] autorelease];
+    HLIntervalSet* b = [[[HLIntervalSet alloc] initWithStartMillis:&bStart endMillis:&end count:1] autorelease];
+    
+    STAssertEqualObjects([a unionWithSet:b], a, nil);
+    STAssertEqualObjects([a intersectionWithSet:b], b, nil);
+    STAssertTrue([[b differenceWithSet:a] isEmpty], nil);
+    HLIntervalSet* only = [a differenceWithSet:b];
+    STAssertEquals([only count], (NSUInteger) 1, nil);
+    STAssertEquals([only startMillisAtIndex:0], INT64_MAX - 10, nil);
+    STAssertEquals([only endMillisAtIndex:0], INT64_MAX - 5, nil);
+    
+    STAssertTrue([a containsInstant:INT64_MAX - 1], nil);
+    STAssertFalse([a containsInstant:INT64_MAX], nil);
+    
+    HLIntervalSet* gaps = [a complementWithinStartMillis:INT64_MAX - 20 endMillis:INT64_MAX];
+    STAssertEquals([gaps count], (NSUInteger) 1, nil);
+    STAssertEquals([gaps endMillisAtIndex:0], INT64_MAX - 10, nil);
+    HLIntervalSet* all = [[HLIntervalSet emptySet] complementWithinStartMillis:0 endMillis:INT64_MAX];
+    STAssertEquals([all endMillisAtIndex:0], INT64_MAX, nil);
+    
+    // runs that abut coalesce, even across the whole range
+    int64_t starts[] = { INT64_MIN, 0, 5, INT64_MAX };
+    int64_t ends[] = { 0, INT64_MAX, 5, INT64_MAX };
+    HLIntervalSet* whole = [[[HLIntervalSet alloc] initWithStartMillis:starts endMillis:ends count:4] autorelease];
+    STAssertEquals([whole count], (NSUInteger) 1, nil);
+    STAssertEquals([whole startMillisAtIndex:0], INT64_MIN, nil);
+    STAssertEquals([whole endMillisAtIndex:0], INT64_MAX, nil);
+    STAssertThrowsSpecificNamed([whole durationMillis], NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed([whole startMillisAtIndex:1], NSException, HL_INDEX_OUT_OF_BOUNDS_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed([a complementWithinStartMillis:1 endMillis:0], 
+                                NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
+}
+
+//-----------------------------------------------------------------------
+- (void)testInstantSortIsStable
+{
+    // either side of the switch from insertion sort to the radix passes
+    NSUInteger counts[] = { 0, 1, 2, 47, 48, 49, 300, HL_TEST_INSTANT_COUNT };
+    int64_t* millis = malloc(HL_TEST_INSTANT_COUNT * sizeof(int64_t));
+    int64_t* sorted = malloc(HL_TEST_INSTANT_COUNT * sizeof(int64_t));
+    int64_t* expected = malloc(HL_TEST_INSTANT_COUNT * sizeof(int64_t));
+    NSUInteger* permutation = malloc(HL_TEST_INSTANT_COUNT * sizeof(NSUInteger));
+    NSUInteger* indexes = malloc(HL_TEST_INSTANT_COUNT * sizeof(NSUInteger));
+    srandom(13);
+    for(NSUInteger c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        NSUInteger count = counts[c];
+        for(NSUInteger i = 0; i < count; i++) {
+            millis[i] = HLTestSampleMillis();
+        }
+        memcpy(expected, millis, count * sizeof(int64_t));
+        qsort(expected, count, sizeof(int64_t), HLTestCompareMillis);
+        memcpy(sorted, millis, count * sizeof(int64_t));
+        HLInstantSortMillis(sorted, count);
+        STAssertTrue(memcmp(sorted, expected, count * sizeof(int64_t)) == 0, @"count %lu", (unsigned long) count);
+        
+        HLInstantSortPermutation(millis, count, permutation);
+        memcpy(indexes, permutation, count * sizeof(NSUInteger));
+        qsort(indexes, count, sizeof(NSUInteger), HLTestCompareIdentifiers);
+        for(NSUInteger i = 0; i < count; i++) {
+            if (indexes[i] != i) {
+                STFail(@"count %lu: not a permutation", (unsigned long) count);
+                break;
+            }
+            if (millis[permutation[i]] != expected[i]) {
+                STFail(@"count %lu: out of order at %lu", (unsigned long) count, (unsigned long) i);
+                break;
+            }
+            // equal millis keep their original order
+            if (i > 0 && millis[permutation[i - 1]] == millis[permutation[i]] && permutation[i - 1] > permutation[i]) {
+                STFail(@"count %lu: unstable at %lu", (unsigned long) count, (unsigned long) i);
+                break;
+            }
+        }
+        
+        for(NSUInteger i = 0; i <= count; i++) {
+            int64_t probes[] = { INT64_MIN, INT64_MAX, 0 };
+            if (i < count) {
+                probes[0] = expected[i];
+                probes[1] = (expected[i] == INT64_MIN ? expected[i] : expected[i] - 1);
+                probes[2] = (expected[i] == INT64_MAX ? expected[i] : expected[i] + 1);
+            }
+            for(NSUInteger p = 0; p < 3; p++) {
+                NSUInteger lower = 0;
+                NSUInteger upper = 0;
+                for(NSUInteger j = 0; j < count; j++) {
+                    lower += (expected[j] < probes[p]);
+                    upper += (expected[j] <= probes[p]);
+                }
+                STAssertEquals(HLInstantLowerBound(expected, count, probes[p]), lower, @"%lld", probes[p]);
+                STAssertEquals(HLInstantUpperBound(expected, count, probes[p]), upper, @"%lld", probes[p]);
+            }
+        }
+    }
+    free(indexes);
+    free(permutation);
+    free(expected);
+    free(sorted);
+    free(millis);
+}
+
+- (void)testInstantMergeRunsIsStable
+{
+    int64_t data[5][60];
+    const int64_t* runs[5];
+    NSUInteger counts[5];
+    int64_t merged[5 * 60];
+    NSUInteger origins[5 * 60];
+    srandom(17);
+    for(NSUInteger t = 0; t < 50; t++) {
+        NSUInteger total = 0;
+        for(NSUInteger r = 0; r < 5; r++) {
+            // one run is always empty
+            counts[r] = (r == 2 ? 0 : random() % 60);
+            for(NSUInteger i = 0; i < counts[r]; i++) {
+                data[r][i] = HLTestSampleMillis();
+            }
+            HLInstantSortMillis(data[r], counts[r]);
+            runs[r] = data[r];
+            total += counts[r];
+        }
+        
+        NSUInteger written = HLInstantMergeRuns(runs, counts, 5, merged, origins);
+        STAssertEquals(written, total, nil);
+        NSUInteger positions[5] = { 0, 0, 0, 0, 0 };
+        for(NSUInteger i = 0; i < written; i++) {
+            NSUInteger r = origins[i];
+            if (r >= 5 || positions[r] >= counts[r] || data[r][positions[r]++] != merged[i]) {
+                STFail(@"merge %lu: wrong origin at %lu", (unsigned long) t, (unsigned long) i);
+                return;
+            }
+            // equal millis come from the earlier run first
+            if (i > 0 && (merged[i - 1] > merged[i] || (merged[i - 1] == merged[i] && origins[i - 1] > r))) {
+                STFail(@"merge %lu: out of order at %lu", (unsigned long) t, (unsigned long) i);
+                return;
+            }
+        }
+    }
+}
+
+- (void)testInstantArraySortIsStable
+{
+    NSMutableArray* instants = [NSMutableArray array];
+    int64_t values[] = { 5, INT64_MAX, -5, 5, INT64_MIN, 0, -5, 5, INT64_MAX, INT64_MIN };
+    NSUInteger count = sizeof(values) / sizeof(values[0]);
+    for(NSUInteger i = 0; i < count; i++) {
+        [instants addObject:[[[HLInstant alloc] initWithInstantValue:values[i]] autorelease]];
+    }
+    
+    NSArray* sorted = HLInstantArraySort(instants);
+    STAssertEquals([sorted count], count, nil);
+    for(NSUInteger i = 1; i < count; i++) {
+        HLInstant* previous = [sorted objectAtIndex:i - 1];
+        HLInstant* current = [sorted objectAtIndex:i];
+        STAssertTrue([previous millis] <= [current millis], @"at %lu", (unsigned long) i);
+        if ([previous millis] == [current millis]) {
+            STAssertTrue([instants indexOfObjectIdenticalTo:previous] < [instants indexOfObjectIdenticalTo:current], 
+                         @"at %lu", (unsigned long) i);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------
+- (void)testPeriodValueArithmeticAtLimits
+{
+    HLPeriodValue value = HLPeriodValueMake(0, 0, 0, INT32_MAX - 1, 0, 0, 0, INT32_MIN + 1);
+    HLPeriodValueAddSlot(&value, HLPeriodSlotDays, 1);
+    STAssertEquals(HLPeriodValueGet(&value, HLPeriodSlotDays), INT32_MAX, nil);
+    STAssertThrowsSpecificNamed(HLPeriodValueAddSlot(&value, HLPeriodSlotDays, 1), 
+                                NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    STAssertEquals(HLPeriodValueGet(&value, HLPeriodSlotDays), INT32_MAX, nil);
+    HLPeriodValueAddSlot(&value, HLPeriodSlotMillis, -1);
+    STAssertEquals(HLPeriodValueGet(&value, HLPeriodSlotMillis), INT32_MIN, nil);
+    STAssertThrowsSpecificNamed(HLPeriodValueAddSlot(&value, HLPeriodSlotMillis, -1), 
+                                NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    
+    HLPeriodValue one = HLPeriodValueMake(0, 0, 0, 1, 0, 0, 0, 0);
+    HLPeriodValue oneMilli = HLPeriodValueMake(0, 0, 0, 0, 0, 0, 0, 1);
+    HLPeriodValue minusOneMilli = HLPeriodValueMake(0, 0, 0, 0, 0, 0, 0, -1);
+    STAssertThrowsSpecificNamed(HLPeriodValueAdd(&value, &one), NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed(HLPeriodValueAdd(&value, &minusOneMilli), NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed(HLPeriodValueSubtract(&value, &oneMilli), NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    HLPeriodValueSubtract(&value, &one);
+    STAssertEquals(HLPeriodValueGet(&value, HLPeriodSlotDays), INT32_MAX - 1, nil);
+    
+    HLPeriodValue lowest = HLPeriodValueMake(0, 0, 0, 0, 0, 0, 0, INT32_MIN);
+    HLPeriodValueMultiply(&lowest, 1);
+    STAssertEquals(HLPeriodValueGet(&lowest, HLPeriodSlotMillis), INT32_MIN, nil);
+    STAssertThrowsSpecificNamed(HLPeriodValueMultiply(&lowest, -1), NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    HLPeriodValue highest = HLPeriodValueMake(INT32_MAX, 0, 0, 0, 0, 0, 0, 0);
+    STAssertThrowsSpecificNamed(HLPeriodValueMultiply(&highest, 2), NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    HLPeriodValueMultiply(&highest, -1);
+    STAssertEquals(HLPeriodValueGet(&highest, HLPeriodSlotYears), -INT32_MAX, nil);
+    
+    // a field the type lacks is unsupported rather than out of range
+    HLPeriodValue daysOnly = HLPeriodValueZero(HL_PERIOD_SLOT_BIT(HLPeriodSlotDays));
+    STAssertThrowsSpecificNamed(HLPeriodValueAddSlot(&daysOnly, HLPeriodSlotHours, 1), 
+                                NSException, HL_UNSUPPORTED_OPERATION_EXCEPTION, nil);
+}
+
+- (void)testPeriodValueSumAtLimits
 {
-    STFail(@"Unit tests are not implemented yet in HorologeTests");
+    HLPeriodValue periods[3];
+    for(NSUInteger i = 0; i < 3; i++) {
+        periods[i] = HLPeriodValueMake(0, 0, 0, 1, 0, 0, 0, -1);
+    }
+    HLPeriodValue sum = HLPeriodValueMake(0, 0, 0, INT32_MAX - 2, 0, 0, 0, INT32_MIN + 2);
+    HLPeriodValueSum(&sum, periods, 2);
+    STAssertEquals(HLPeriodValueGet(&sum, HLPeriodSlotDays), INT32_MAX, nil);
+    STAssertEquals(HLPeriodValueGet(&sum, HLPeriodSlotMillis), INT32_MIN, nil);
+    
+    // an overflow leaves the sum as it was
+    sum = HLPeriodValueMake(0, 0, 0, INT32_MAX - 2, 0, 0, 0, 0);
+    STAssertThrowsSpecificNamed(HLPeriodValueSum(&sum, periods, 3), NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    STAssertEquals(HLPeriodValueGet(&sum, HLPeriodSlotDays), INT32_MAX - 2, nil);
+    STAssertEquals(HLPeriodValueGet(&sum, HLPeriodSlotMillis), 0, nil);
+}
+
+- (void)testPeriodValueNormalizeAtLimits
+{
+    HLPeriodValue value = HLPeriodValueMake(0, 25, 0, 0, 0, 0, 0, 1500);
+    HLPeriodValueNormalizeStandard(&value, HL_PERIOD_MASK_STANDARD);
+    STAssertEquals(HLPeriodValueGet(&value, HLPeriodSlotYears), 2, nil);
+    STAssertEquals(HLPeriodValueGet(&value, HLPeriodSlotMonths), 1, nil);
+    STAssertEquals(HLPeriodValueGet(&value, HLPeriodSlotSeconds), 1, nil);
+    STAssertEquals(HLPeriodValueGet(&value, HLPeriodSlotMillis), 500, nil);
+    
+    // every precise slot at its limit still fits in millis
+    HLPeriodValue full = HLPeriodValueMake(0, 0, INT32_MAX, INT32_MAX, INT32_MAX, INT32_MAX, INT32_MAX, INT32_MAX);
+    int64_t millis = HLPeriodValueStandardDurationMillis(&full);
+    STAssertTrue(millis > 0, @"%lld", millis);
+    
+    // but not once folded into days
+    HLPeriodValue weeks = HLPeriodValueMake(0, 0, INT32_MAX, 0, 0, 0, 0, 0);
+    uint16_t daysAndMillis = HL_PERIOD_SLOT_BIT(HLPeriodSlotDays) | HL_PERIOD_SLOT_BIT(HLPeriodSlotMillis);
+    STAssertThrowsSpecificNamed(HLPeriodValueNormalizeStandard(&weeks, daysAndMillis), 
+                                NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    
+    HLPeriodValue years = HLPeriodValueMake(INT32_MAX, 11, 0, 0, 0, 0, 0, 0);
+    HLPeriodValueNormalizeStandard(&years, HL_PERIOD_MASK_STANDARD);
+    STAssertEquals(HLPeriodValueGet(&years, HLPeriodSlotYears), INT32_MAX, nil);
+    years = HLPeriodValueMake(INT32_MAX, 12, 0, 0, 0, 0, 0, 0);
+    STAssertThrowsSpecificNamed(HLPeriodValueNormalizeStandard(&years, HL_PERIOD_MASK_STANDARD), 
+                                NSException, HL_ARITHMETIC_EXCEPTION, nil);
+}
+
+//-----------------------------------------------------------------------
+- (void)testFieldUtilsInlineCallCost
+{
+    // the sums depend on every call, so neither loop can be optimized away
+    int64_t inlineSum = 0;
+    int64_t start = HLClockMonotonicNanos();
+    for(int64_t i = 0; i < HL_TEST_BENCHMARK_CALLS; i++) {
+        inlineSum = HLSafeAdd(inlineSum, HLSafeMultiply(i & 0xfff, 3));
+    }
+    int64_t inlineNanos = HLClockMonotonicNanos() - start;
+    
+    int64_t messageSum = 0;
+    start = HLClockMonotonicNanos();
+    for(int64_t i = 0; i < HL_TEST_BENCHMARK_CALLS; i++) {
+        messageSum = [HLFieldUtils safeAddInt64:messageSum 
+                                       andInt64:[HLFieldUtils safeMultiplyInt64:i & 0xfff andInt64:3]];
+    }
+    int64_t messageNanos = HLClockMonotonicNanos() - start;
+    
+    STAssertEquals(inlineSum, messageSum, nil);
+    // two checked operations per iteration
+    NSLog(@"HLSafeAdd/HLSafeMultiply: %.2f ns per call inline, %.2f ns per call as class methods",
+          (double) inlineNanos / (2.0 * HL_TEST_BENCHMARK_CALLS),
+          (double) messageNanos / (2.0 * HL_TEST_BENCHMARK_CALLS));
+}
+
+//-----------------------------------------------------------------------
+- (void)testInstantValueSerialization
+{
+    int64_t samples[] = { INT64_MIN, INT64_MIN + 1, -86400001LL, -1, 0, 1, 0x0102030405060708LL, INT64_MAX - 1, INT64_MAX };
+    NSUInteger count = sizeof(samples) / sizeof(samples[0]);
+    for(NSUInteger i = 0; i < count; i++) {
+        uint8_t bytes[HL_INSTANT_SERIALIZED_SIZE];
+        HLInstantMillisEncode(samples[i], bytes);
+        STAssertEquals(HLInstantMillisDecode(bytes), samples[i], nil);
+        for(NSUInteger k = 0; k < HL_INSTANT_SERIALIZED_SIZE; k++) {
+            STAssertEquals(bytes[k], (uint8_t) ((uint64_t) samples[i] >> (56 - 8 * k)), @"byte %lu of %lld", 
+                           (unsigned long) k, samples[i]);
+        }
+    }
+    
+    uint8_t expected[HL_INSTANT_SERIALIZED_SIZE] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    uint8_t bytes[HL_INSTANT_SERIALIZED_SIZE];
+    HLInstantMillisEncode(0x0102030405060708LL, bytes);
+    STAssertTrue(memcmp(bytes, expected, sizeof(expected)) == 0, nil);
+    
+    NSData* data = HLInstantMillisArrayToData(samples, count);
+    STAssertEquals([data length], (NSUInteger) (count * HL_INSTANT_SERIALIZED_SIZE), nil);
+    int64_t decoded[sizeof(samples) / sizeof(samples[0])];
+    STAssertEquals(HLInstantMillisArrayFromData(data, decoded, count), count, nil);
+    STAssertTrue(memcmp(decoded, samples, sizeof(samples)) == 0, nil);
+    
+    // a short buffer takes the leading instants only
+    memset(decoded, 0, sizeof(decoded));
+    STAssertEquals(HLInstantMillisArrayFromData(data, decoded, 3), (NSUInteger) 3, nil);
+    STAssertEquals(decoded[2], samples[2], nil);
+    STAssertEquals(decoded[3], (int64_t) 0, nil);
+    
+    STAssertEquals([HLInstantMillisArrayToData(samples, 0) length], (NSUInteger) 0, nil);
+    NSData* truncated = [data subdataWithRange:NSMakeRange(0, [data length] - 1)];
+    STAssertThrowsSpecificNamed(HLInstantMillisArrayFromData(truncated, decoded, count), 
+                                NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
+}
+
+- (void)testLocalDateValueCivilConversions
+{
+    STAssertEquals(HLLocalDateValueMake(1970, 1, 1).epochDay, 0, nil);
+    STAssertEquals(HLLocalDateValueMake(2000, 3, 1).epochDay, 11017, nil);
+    STAssertEquals(HLLocalDateValueMake(0, 1, 1).epochDay, -719528, nil);
+    STAssertEquals(HLLocalDateValueMake(0, 2, 29).epochDay, -719469, nil);
+    STAssertEquals(HLLocalDateValueMake(0, 3, 1).epochDay, -719468, nil);
+    STAssertEquals(HLLocalDateValueMake(-1, 12, 31).epochDay, -719529, nil);
+    STAssertEquals(HLLocalDateValueDayOfWeek(HLLocalDateValueMakeWithEpochDay(0)), 4, nil);
+    
+    // every day across year 0 follows the previous one and survives a round trip
+    int32_t start = HLLocalDateValueMake(-401, 1, 1).epochDay;
+    int32_t end = HLLocalDateValueMake(401, 12, 31).epochDay;
+    int32_t prevYear, prevMonth, prevDay;
+    HLLocalDateValueGetFields(HLLocalDateValueMakeWithEpochDay(start), &prevYear, &prevMonth, &prevDay);
+    STAssertEquals(prevYear, -401, nil);
+    STAssertEquals(prevMonth, 1, nil);
+    STAssertEquals(prevDay, 1, nil);
+    for(int32_t epochDay = start + 1; epochDay <= end; epochDay++) {
+        HLLocalDateValue date = HLLocalDateValueMakeWithEpochDay(epochDay);
+        int32_t year, month, day;
+        HLLocalDateValueGetFields(date, &year, &month, &day);
+        if (HLLocalDateValueMake(year, month, day).epochDay != epochDay) {
+            STFail(@"round trip of epoch day %d", epochDay);
+            break;
+        }
+        BOOL follows = (year == prevYear && month == prevMonth && day == prevDay + 1) ||
+                       (year == prevYear && month == prevMonth + 1 && day == 1) ||
+                       (year == prevYear + 1 && month == 1 && day == 1 && prevMonth == 12 && prevDay == 31);
+        if (!follows) {
+            STFail(@"%d-%d-%d does not follow %d-%d-%d", year, month, day, prevYear, prevMonth, prevDay);
+            break;
+        }
+        if (month == 3 && day == 1) {
+            BOOL leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+            STAssertEquals((BOOL) (prevDay == 29), leap, @"February of %d", year);
+        }
+        int32_t prevDayOfWeek = HLLocalDateValueDayOfWeek(HLLocalDateValueMakeWithEpochDay(epochDay - 1));
+        if (HLLocalDateValueDayOfWeek(date) != prevDayOfWeek % 7 + 1) {
+            STFail(@"day of week of epoch day %d", epochDay);
+            break;
+        }
+        prevYear = year;
+        prevMonth = month;
+        prevDay = day;
+    }
+    
+    // the whole int32 range of epoch days converts both ways
+    int32_t limits[] = { INT32_MIN, INT32_MIN + 1, INT32_MAX - 1, INT32_MAX };
+    for(NSUInteger i = 0; i < sizeof(limits) / sizeof(limits[0]); i++) {
+        int32_t year, month, day;
+        HLLocalDateValueGetFields(HLLocalDateValueMakeWithEpochDay(limits[i]), &year, &month, &day);
+        STAssertEquals(HLLocalDateValueMake(year, month, day).epochDay, limits[i], nil);
+        HLInstantValue midnight = HLLocalDateValueStartOfDayUTC(HLLocalDateValueMakeWithEpochDay(limits[i]));
+        STAssertEquals(HLInstantValueDateUTC(midnight).epochDay, limits[i], nil);
+        STAssertEquals(HLInstantValueMillisOfDayUTC(midnight), 0, nil);
+        STAssertEquals(HLInstantValueDateUTC(HLInstantValuePlusMillis(midnight, 86399999)).epochDay, limits[i], nil);
+    }
+    
+    HLInstantValue beforeEpoch = HLInstantValueMake(-1, HL_CHRONOLOGY_ID_ISO_UTC);
+    STAssertEquals(HLInstantValueDateUTC(beforeEpoch).epochDay, -1, nil);
+    STAssertEquals(HLInstantValueMillisOfDayUTC(beforeEpoch), 86399999, nil);
+    STAssertEquals(HLInstantValueMillisOfDayUTC(HLInstantValueMake(INT64_MIN, HL_CHRONOLOGY_ID_ISO_UTC)), 60424192, nil);
+    STAssertEquals(HLInstantValueMillisOfDayUTC(HLInstantValueMake(INT64_MAX, HL_CHRONOLOGY_ID_ISO_UTC)), 25975807, nil);
+    
+    // instants beyond the last representable day cannot become a date
+    STAssertThrowsSpecificNamed(HLInstantValueDateUTC(HLInstantValueMake(INT64_MAX, HL_CHRONOLOGY_ID_ISO_UTC)), 
+                                NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed(HLInstantValueDateUTC(HLInstantValueMake(INT64_MIN, HL_CHRONOLOGY_ID_ISO_UTC)), 
+                                NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed(HLInstantValueDateUTC(HLInstantValueMake((int64_t) INT32_MAX * 86400000LL + 86400000LL, 
+                                                                         HL_CHRONOLOGY_ID_ISO_UTC)), 
+                                NSException, HL_ARITHMETIC_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed(HLLocalDateValuePlusDays(HLLocalDateValueMakeWithEpochDay(INT32_MAX), 1), 
+                                NSException, HL_ARITHMETIC_EXCEPTION, nil);
+}
+
+//-----------------------------------------------------------------------
+- (void)testStringConverterFixedShapes
+{
+    // shapes the fixed recognizer accepts, with the instant the full parser gives
+    static const struct {
+        const char* text;
+        int64_t millis;
+    } accepted[] = {
+        { "2011-06-15", 1308096000000LL },
+        { "2011-06-15T10:30", 1308133800000LL },
+        { "2011-06-15T10:30:15", 1308133815000LL },
+        { "2011-06-15T10:30:15.1", 1308133815100LL },
+        { "2011-06-15T10:30:15.123", 1308133815123LL },
+        { "2011-06-15T10:30:15.123456789", 1308133815123LL },
+        { "2011-06-15T10:30:15,5", 1308133815500LL },
+        { "2011-06-15T10:30:15Z", 1308133815000LL },
+        { "2011-06-15T10:30:15.123+05:30", 1308114015123LL },
+        { "2011-06-15T10:30-0800", 1308162600000LL },
+        { "2011-06-15T10:30:15+02", 1308126615000LL },
+        { "2012-02-29T23:59:59.999Z", 1330559999999LL },
+        { "1969-12-31T23:59:59.999Z", -1LL },
+        { "0000-03-01T00:00Z", -62162035200000LL },
+    };
+    // shapes it leaves to the full parser, which may accept or reject them
+    static const char* fallback[] = {
+        "2011", "2011-06", "2011-166", "2011-W24-3", "2011-06-15T10", "T10:30",
+        "2011-06-15T10:30:15.1234567891", "2011-06-15 10:30", "2011-02-29", "2011-13-01", 
+        "2011-06-15T24:00", "2011-06-15T10:60", "2011-06-15T10:30:60", "2011-06-15T10:30:15.", 
+        "2011-06-15T10:30+05:30:00", "2011-06-15T10:30+5", "2011-06-15T10:30z", "+2011-06-15", 
+        "2011-06-15T10:30:15Zjunk", "",
+    };
+    
+    HLStringConverter* converter = [[[HLStringConverter alloc] init] autorelease];
+    HLChronology* utc = [HLISOChronology instanceUTC];
+    for(NSUInteger i = 0; i < sizeof(accepted) / sizeof(accepted[0]); i++) {
+        NSString* text = [NSString stringWithUTF8String:accepted[i].text];
+        int64_t converted = 0, parsed = 0;
+        STAssertNil(HLTestConvertString(converter, utc, text, &converted), text);
+        STAssertNil(HLTestParseString(utc, text, &parsed), text);
+        STAssertEquals(converted, accepted[i].millis, text);
+        STAssertEquals(converted, parsed, text);
+    }
+    for(NSUInteger i = 0; i < sizeof(fallback) / sizeof(fallback[0]); i++) {
+        NSString* text = [NSString stringWithUTF8String:fallback[i]];
+        int64_t converted = 0, parsed = 0;
+        NSString* convertError = HLTestConvertString(converter, utc, text, &converted);
+        NSString* parseError = HLTestParseString(utc, text, &parsed);
+        STAssertEqualObjects(convertError, parseError, text);
+        if (parseError == nil) {
+            STAssertEquals(converted, parsed, text);
+        }
+    }
+}
+
+- (void)testStringConverterFixedShapesInZone
+{
+    HLStringConverter* converter = [[[HLStringConverter alloc] init] autorelease];
+    HLChronology* newYork = [HLISOChronology instanceWithDateTimeZone:[HLDateTimeZone forZoneId:@"America/New_York"]];
+    static const struct {
+        const char* text;
+        int64_t millis;
+    } local[] = {
+        { "2011-06-15T10:30", 1308148200000LL },
+        { "2011-01-15T10:30", 1295105400000LL },
+        // an explicit offset wins over the zone
+        { "2011-06-15T10:30:15.123+05:30", 1308114015123LL },
+    };
+    for(NSUInteger i = 0; i < sizeof(local) / sizeof(local[0]); i++) {
+        NSString* text = [NSString stringWithUTF8String:local[i].text];
+        int64_t converted = 0, parsed = 0;
+        STAssertNil(HLTestConvertString(converter, newYork, text, &converted), text);
+        STAssertNil(HLTestParseString(newYork, text, &parsed), text);
+        STAssertEquals(converted, local[i].millis, text);
+        STAssertEquals(converted, parsed, text);
+    }
+    
+    // local times in the spring gap fall back to the parser and its error,
+    // those in the autumn overlap resolve as the parser does
+    static const char* transitions[] = { "2011-03-13T02:00", "2011-03-13T02:30:15.5", "2011-11-06T01:30" };
+    for(NSUInteger i = 0; i < sizeof(transitions) / sizeof(transitions[0]); i++) {
+        NSString* text = [NSString stringWithUTF8String:transitions[i]];
+        int64_t converted = 0, parsed = 0;
+        NSString* convertError = HLTestConvertString(converter, newYork, text, &converted);
+        NSString* parseError = HLTestParseString(newYork, text, &parsed);
+        STAssertEqualObjects(convertError, parseError, text);
+        if (parseError == nil) {
+            STAssertEquals(converted, parsed, text);
+        }
+    }
+    int64_t millis;
+    STAssertNotNil(HLTestConvertString(converter, newYork, @"2011-03-13T02:30", &millis), nil);
+}
+
+//-----------------------------------------------------------------------
+- (void)testPeriodTypeNamedTypesAreCanonical
+{
+    HLDurationFieldType* years = HLTestPeriodFieldType(HL_PERIOD_TYPE_YEAR_INDEX);
+    HLDurationFieldType* months = HLTestPeriodFieldType(HL_PERIOD_TYPE_MONTH_INDEX);
+    HLDurationFieldType* weeks = HLTestPeriodFieldType(HL_PERIOD_TYPE_WEEK_INDEX);
+    HLDurationFieldType* days = HLTestPeriodFieldType(HL_PERIOD_TYPE_DAY_INDEX);
+    HLDurationFieldType* hours = HLTestPeriodFieldType(HL_PERIOD_TYPE_HOUR_INDEX);
+    HLDurationFieldType* minutes = HLTestPeriodFieldType(HL_PERIOD_TYPE_MINUTE_INDEX);
+    HLDurationFieldType* seconds = HLTestPeriodFieldType(HL_PERIOD_TYPE_SECOND_INDEX);
+    HLDurationFieldType* millis = HLTestPeriodFieldType(HL_PERIOD_TYPE_MILLI_INDEX);
+    
+    STAssertEquals([HLPeriodType yearMonthDay], 
+                   [HLPeriodType forFields:[NSArray arrayWithObjects:years, months, days, nil]], nil);
+    // the order of the fields does not matter
+    STAssertEquals([HLPeriodType yearMonthDay], 
+                   [HLPeriodType forFields:[NSArray arrayWithObjects:days, years, months, nil]], nil);
+    STAssertEquals([HLPeriodType standard], 
+                   [HLPeriodType forFields:[NSArray arrayWithObjects:years, months, weeks, days, 
+                                            hours, minutes, seconds, millis, nil]], nil);
+    STAssertEquals([HLPeriodType time], 
+                   [HLPeriodType forFields:[NSArray arrayWithObjects:hours, minutes, seconds, millis, nil]], nil);
+    STAssertEquals([HLPeriodType days], [HLPeriodType forFields:[NSArray arrayWithObject:days]], nil);
+    
+    static const struct {
+        uint16_t fieldMask;
+        const char* name;
+    } named[] = {
+        { 0xFF, "Standard" }, { 0xFB, "YearMonthDayTime" }, { 0x0B, "YearMonthDay" },
+        { 0xFD, "YearWeekDayTime" }, { 0x0D, "YearWeekDay" }, { 0xF9, "YearDayTime" },
+        { 0x09, "YearDay" }, { 0xF8, "DayTime" }, { 0xF0, "Time" },
+        { 0x01, "Years" }, { 0x02, "Months" }, { 0x04, "Weeks" }, { 0x08, "Days" },
+        { 0x10, "Hours" }, { 0x20, "Minutes" }, { 0x40, "Seconds" }, { 0x80, "Millis" },
+    };
+    HLPeriodType* factories[] = {
+        [HLPeriodType standard], [HLPeriodType yearMonthDayTime], [HLPeriodType yearMonthDay],
+        [HLPeriodType yearWeekDayTime], [HLPeriodType yearWeekDay], [HLPeriodType yearDayTime],
+        [HLPeriodType yearDay], [HLPeriodType dayTime], [HLPeriodType time],
+        [HLPeriodType years], [HLPeriodType months], [HLPeriodType weeks], [HLPeriodType days],
+        [HLPeriodType hours], [HLPeriodType minutes], [HLPeriodType seconds], [HLPeriodType millis],
+    };
+    for(NSUInteger i = 0; i < sizeof(named) / sizeof(named[0]); i++) {
+        STAssertEquals([factories[i] fieldMask], named[i].fieldMask, nil);
+        STAssertEquals([HLPeriodType forFieldMask:named[i].fieldMask], factories[i], nil);
+        STAssertEqualObjects([factories[i] name], [NSString stringWithUTF8String:named[i].name], nil);
+    }
+    
+    STAssertThrowsSpecificNamed([HLPeriodType forFields:[NSArray array]], 
+                                NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed([HLPeriodType forFields:[NSArray arrayWithObject:(id) [HLDurationFieldType halfdays]]], 
+                                NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed([HLPeriodType forFieldMask:0x100], NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed([HLPeriodType forFieldMask:0x1FF], NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
+    STAssertThrowsSpecificNamed([HLPeriodType forFieldMask:0xFFFF], NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
+}
+
+- (void)testPeriodTypeFieldMasks
+{
+    for(uint16_t fieldMask = 0; fieldMask < HL_PERIOD_TYPE_MASK_COUNT; fieldMask++) {
+        HLPeriodType* type = [HLPeriodType forFieldMask:fieldMask];
+        STAssertEquals([type fieldMask], fieldMask, nil);
+        STAssertEquals([HLPeriodType forFieldMask:fieldMask], type, nil);
+        
+        NSInteger size = 0;
+        for(NSInteger i = 0; i < HL_PERIOD_TYPE_FIELD_COUNT; i++) {
+            HLDurationFieldType* fieldType = HLTestPeriodFieldType(i);
+            uint16_t bit = (uint16_t) (1u << i);
+            if (fieldMask & bit) {
+                STAssertEquals([type indexOf:fieldType], size, @"mask 0x%x field %ld", fieldMask, (long) i);
+                STAssertEquals([type fieldTypeAtIndex:size], fieldType, nil);
+                STAssertTrue([type isSupported:fieldType], nil);
+                size++;
+            } else {
+                STAssertEquals([type indexOf:fieldType], (NSInteger) -1, @"mask 0x%x field %ld", fieldMask, (long) i);
+                STAssertFalse([type isSupported:fieldType], nil);
+            }
+            
+            HLPeriodType* removed = HLTestPeriodTypeWithFieldRemoved(type, i);
+            STAssertEquals([removed fieldMask], (uint16_t) (fieldMask & ~bit), nil);
+            STAssertEquals(removed, [HLPeriodType forFieldMask:fieldMask & ~bit], nil);
+        }
+        STAssertEquals([type size], size, @"mask 0x%x", fieldMask);
+        STAssertEquals([type indexOf:nil], (NSInteger) -1, nil);
+        STAssertEquals([type indexOf:(HLDurationFieldType*) [HLDurationFieldType halfdays]], (NSInteger) -1, nil);
+        STAssertThrowsSpecificNamed([type fieldTypeAtIndex:size], NSException, HL_INDEX_OUT_OF_BOUNDS_EXCEPTION, nil);
+        STAssertThrowsSpecificNamed([type fieldTypeAtIndex:-1], NSException, HL_INDEX_OUT_OF_BOUNDS_EXCEPTION, nil);
+    }
+    
+    // removing fields reaches the named types, and names the others after the standard type
+    STAssertEquals([[HLPeriodType standard] withWeeksRemoved], [HLPeriodType yearMonthDayTime], nil);
+    STAssertEquals([[HLPeriodType yearMonthDayTime] withMonthsRemoved], [HLPeriodType yearDayTime], nil);
+    STAssertEquals([[[[[HLPeriodType yearDayTime] withHoursRemoved] withMinutesRemoved] withSecondsRemoved] 
+                    withMillisRemoved], [HLPeriodType yearDay], nil);
+    STAssertEqualObjects([[[HLPeriodType yearDayTime] withYearsRemoved] name], @"DayTime", nil);
+    STAssertEqualObjects([[[HLPeriodType standard] withYearsRemoved] name], @"StandardNoYears", nil);
+    STAssertEqualObjects([[[HLPeriodType time] withMillisRemoved] name], 
+                         @"StandardNoYearsNoMonthsNoWeeksNoDaysNoMillis", nil);
+    STAssertEqualObjects([[[HLPeriodType yearMonthDay] withDaysRemoved] name], 
+                         @"StandardNoWeeksNoDaysNoHoursNoMinutesNoSecondsNoMillis", nil);
+    STAssertEquals([[[HLPeriodType years] withYearsRemoved] size], (NSInteger) 0, nil);
+    STAssertEquals([[HLPeriodType days] withYearsRemoved], [HLPeriodType days], nil);
+}
+
+//-----------------------------------------------------------------------
+- (void)testSingleFieldPeriodBatchBetween
+{
+    // month ends, leap days, times of day, negative spans and year 0
+    static const struct {
+        int32_t startYear, startMonth, startDay;
+        int64_t startMillisOfDay;
+        int32_t endYear, endMonth, endDay;
+        int64_t endMillisOfDay;
+        NSInteger months;
+    } spans[] = {
+        { 2011, 1, 31, 0, 2011, 2, 28, 0, 1 },
+        { 2011, 1, 31, 0, 2011, 2, 27, 0, 0 },
+        { 2012, 1, 31, 0, 2012, 2, 29, 0, 1 },
+        { 2012, 1, 31, 0, 2012, 2, 28, 0, 0 },
+        { 2012, 2, 29, 0, 2013, 2, 28, 0, 12 },
+        { 2012, 2, 29, 0, 2016, 2, 29, 0, 48 },
+        { 2011, 3, 31, 0, 2011, 4, 30, 0, 1 },
+        { 2011, 2, 28, 0, 2011, 1, 31, 0, -1 },
+        { 2011, 1, 15, 36000000, 2011, 2, 15, 35999999, 0 },
+        { 2011, 1, 15, 36000000, 2011, 2, 15, 36000000, 1 },
+        { 1969, 12, 31, 86399999, 1970, 1, 1, 0, 0 },
+        { -1, 12, 31, 0, 0, 2, 29, 0, 2 },
+        { 0, 2, 29, 0, -4, 2, 29, 0, -48 },
+        { 2000, 1, 1, 0, 1900, 1, 1, 0, -1200 },
+        { 2011, 12, 31, 43200000, 2010, 12, 31, 43200001, -11 },
+    };
+    NSUInteger count = sizeof(spans) / sizeof(spans[0]);
+    HLDurationFieldType* fields[] = {
+        (HLDurationFieldType*) [HLDurationFieldType days],
+        (HLDurationFieldType*) [HLDurationFieldType weeks],
+        (HLDurationFieldType*) [HLDurationFieldType months],
+        (HLDurationFieldType*) [HLDurationFieldType years],
+        (HLDurationFieldType*) [HLDurationFieldType hours],
+    };
+    HLChronology* utc = [HLISOChronology instanceUTC];
+    HLChronology* newYork = [HLISOChronology instanceWithDateTimeZone:[HLDateTimeZone forZoneId:@"America/New_York"]];
+    
+    int64_t starts[sizeof(spans) / sizeof(spans[0])];
+    int64_t ends[sizeof(spans) / sizeof(spans[0])];
+    NSMutableArray* startInstants = [NSMutableArray arrayWithCapacity:count];
+    NSMutableArray* endInstants = [NSMutableArray arrayWithCapacity:count];
+    for(NSUInteger i = 0; i < count; i++) {
+        starts[i] = HLLocalDateValueStartOfDayUTC(HLLocalDateValueMake(spans[i].startYear, spans[i].startMonth, 
+                                                                       spans[i].startDay)).millis + spans[i].startMillisOfDay;
+        ends[i] = HLLocalDateValueStartOfDayUTC(HLLocalDateValueMake(spans[i].endYear, spans[i].endMonth, 
+                                                                     spans[i].endDay)).millis + spans[i].endMillisOfDay;
+        // runs of each chronology, so the instant variant splits and rejoins
+        HLChronology* chrono = (i % 5 < 3 ? utc : newYork);
+        [startInstants addObject:[[[HLDateTime alloc] initWithInstantValue:starts[i] chronology:chrono] autorelease]];
+        [endInstants addObject:[[[HLDateTime alloc] initWithInstantValue:ends[i] chronology:utc] autorelease]];
+    }
+    
+    NSInteger results[sizeof(spans) / sizeof(spans[0])];
+    for(NSUInteger f = 0; f < sizeof(fields) / sizeof(fields[0]); f++) {
+        [HLBaseSingleFieldPeriod betweenStartMillis:starts endMillis:ends count:count 
+                                          fieldType:fields[f] chronology:utc results:results];
+        for(NSUInteger i = 0; i < count; i++) {
+            HLDateTime* start = [[[HLDateTime alloc] initWithInstantValue:starts[i] chronology:utc] autorelease];
+            NSInteger expected = [HLBaseSingleFieldPeriod betweenStartInstant:start 
+                                                                   endInstant:[endInstants objectAtIndex:i] 
+                                                                    fieldType:fields[f]];
+            STAssertEquals(results[i], expected, @"field %lu span %lu", (unsigned long) f, (unsigned long) i);
+            if (fields[f] == [HLDurationFieldType months]) {
+                STAssertEquals(results[i], spans[i].months, @"span %lu", (unsigned long) i);
+            }
+        }
+        
+        [HLBaseSingleFieldPeriod betweenStartInstants:startInstants endInstants:endInstants 
+                                            fieldType:fields[f] results:results];
+        for(NSUInteger i = 0; i < count; i++) {
+            NSInteger expected = [HLBaseSingleFieldPeriod betweenStartInstant:[startInstants objectAtIndex:i] 
+                                                                   endInstant:[endInstants objectAtIndex:i] 
+                                                                    fieldType:fields[f]];
+            STAssertEquals(results[i], expected, @"field %lu instants %lu", (unsigned long) f, (unsigned long) i);
+        }
+    }
+    
+    // days truncate toward zero whichever way the span runs
+    int64_t halfStarts[] = { 0, 0, -43200000LL };
+    int64_t halfEnds[] = { 129600000LL, -129600000LL, 43200000LL };
+    [HLBaseSingleFieldPeriod betweenStartMillis:halfStarts endMillis:halfEnds count:3 
+                                      fieldType:(HLDurationFieldType*) [HLDurationFieldType days] 
+                                     chronology:utc results:results];
+    STAssertEquals(results[0], (NSInteger) 1, nil);
+    STAssertEquals(results[1], (NSInteger) -1, nil);
+    STAssertEquals(results[2], (NSInteger) 1, nil);
+    
+    STAssertThrowsSpecificNamed([HLBaseSingleFieldPeriod betweenStartInstants:startInstants 
+                                                                  endInstants:[NSArray array] 
+                                                                    fieldType:fields[0] results:results], 
+                                NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
+}
+
+//-----------------------------------------------------------------------
+- (void)testChronologyTryDateTimeMillis
+{
+    HLChronology* utc = [HLISOChronology instanceUTC];
+    static const struct {
+        NSInteger year, monthOfYear, dayOfMonth, hourOfDay, minuteOfHour, secondOfMinute, millisOfSecond;
+    } invalid[] = {
+        { 2011, 13, 1, 0, 0, 0, 0 },
+        { 2011, 0, 1, 0, 0, 0, 0 },
+        { 2011, 2, 29, 0, 0, 0, 0 },
+        { 2011, 4, 31, 0, 0, 0, 0 },
+        { 2011, 6, 0, 0, 0, 0, 0 },
+        { 2011, 6, 15, 24, 0, 0, 0 },
+        { 2011, 6, 15, 10, 60, 0, 0 },
+        { 2011, 6, 15, 10, 30, -1, 0 },
+        { 2011, 6, 15, 10, 30, 15, 1000 },
+        { 300000000, 1, 1, 0, 0, 0, 0 },
+        { -300000000, 1, 1, 0, 0, 0, 0 },
+    };
+    for(NSUInteger i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        int64_t millis = 42;
+        NSError* error = nil;
+        STAssertFalse([utc tryDateTimeMillisWithYear:invalid[i].year 
+                                         monthOfYear:invalid[i].monthOfYear 
+                                          dayOfMonth:invalid[i].dayOfMonth 
+                                           hourOfDay:invalid[i].hourOfDay 
+                                        minuteOfHour:invalid[i].minuteOfHour 
+                                      secondOfMinute:invalid[i].secondOfMinute 
+                                      millisOfSecond:invalid[i].millisOfSecond 
+                                              result:&millis 
+                                               error:&error], @"case %lu", (unsigned long) i);
+        STAssertEqualObjects([error domain], HL_ERROR_DOMAIN, @"case %lu", (unsigned long) i);
+        STAssertEquals([error code], (NSInteger) HL_ERROR_ILLEGAL_FIELD_VALUE, @"case %lu", (unsigned long) i);
+        STAssertEquals(millis, (int64_t) 42, @"case %lu", (unsigned long) i);
+        // the raising form rejects the same values
+        STAssertThrowsSpecificNamed([utc dateTimeMillisWithYear:invalid[i].year 
+                                                    monthOfYear:invalid[i].monthOfYear 
+                                                     dayOfMonth:invalid[i].dayOfMonth 
+                                                      hourOfDay:invalid[i].hourOfDay 
+                                                   minuteOfHour:invalid[i].minuteOfHour 
+                                                 secondOfMinute:invalid[i].secondOfMinute 
+                                                 millisOfSecond:invalid[i].millisOfSecond], 
+                                    NSException, HL_ILLEGAL_FIELD_VALUE_EXCEPTION, @"case %lu", (unsigned long) i);
+    }
+    
+    int64_t millis = 0;
+    NSError* error = nil;
+    STAssertFalse([utc tryDateTimeMillisWithYear:2011 monthOfYear:6 dayOfMonth:15 millisOfDay:86400000 
+                                          result:&millis error:&error], nil);
+    STAssertEqualObjects([error domain], HL_ERROR_DOMAIN, nil);
+    STAssertEquals([error code], (NSInteger) HL_ERROR_ILLEGAL_FIELD_VALUE, nil);
+    // the error is optional
+    STAssertFalse([utc tryDateTimeMillisWithYear:2011 monthOfYear:2 dayOfMonth:29 millisOfDay:0 
+                                          result:&millis error:NULL], nil);
+    
+    STAssertTrue([utc tryDateTimeMillisWithYear:2012 monthOfYear:2 dayOfMonth:29 millisOfDay:0 
+                                         result:&millis error:&error], nil);
+    STAssertEquals(millis, 1330473600000LL, nil);
+    STAssertTrue([utc tryDateTimeMillisWithYear:1969 monthOfYear:12 dayOfMonth:31 hourOfDay:23 minuteOfHour:59 
+                                 secondOfMinute:59 millisOfSecond:999 result:&millis error:&error], nil);
+    STAssertEquals(millis, -1LL, nil);
+}
+
+- (void)testChronologyTryDateTimeMillisInZoneGap
+{
+    HLChronology* newYork = [HLISOChronology instanceWithDateTimeZone:[HLDateTimeZone forZoneId:@"America/New_York"]];
+    int64_t millis = 42;
+    NSError* error = nil;
+    STAssertFalse([newYork tryDateTimeMillisWithYear:2011 monthOfYear:3 dayOfMonth:13 hourOfDay:2 minuteOfHour:30 
+                                      secondOfMinute:0 millisOfSecond:0 result:&millis error:&error], nil);
+    STAssertEqualObjects([error domain], HL_ERROR_DOMAIN, nil);
+    STAssertEquals([error code], (NSInteger) HL_ERROR_ILLEGAL_ARGUMENT, nil);
+    STAssertEquals(millis, (int64_t) 42, nil);
+    
+    error = nil;
+    STAssertFalse([newYork tryDateTimeMillisWithYear:2011 monthOfYear:3 dayOfMonth:13 millisOfDay:2 * 3600000 
+                                              result:&millis error:&error], nil);
+    STAssertEquals([error code], (NSInteger) HL_ERROR_ILLEGAL_ARGUMENT, nil);
+    
+    // either side of the gap, and the repeated hour in autumn, are valid
+    STAssertTrue([newYork tryDateTimeMillisWithYear:2011 monthOfYear:3 dayOfMonth:13 hourOfDay:3 minuteOfHour:0 
+                                     secondOfMinute:0 millisOfSecond:0 result:&millis error:&error], nil);
+    STAssertEquals(millis, 1299999600000LL, nil);
+    STAssertTrue([newYork tryDateTimeMillisWithYear:2011 monthOfYear:3 dayOfMonth:13 hourOfDay:1 minuteOfHour:59 
+                                     secondOfMinute:59 millisOfSecond:999 result:&millis error:&error], nil);
+    STAssertEquals(millis, 1299999599999LL, nil);
+    STAssertTrue([newYork tryDateTimeMillisWithYear:2011 monthOfYear:11 dayOfMonth:6 hourOfDay:1 minuteOfHour:30 
+                                     secondOfMinute:0 millisOfSecond:0 result:&millis error:&error], nil);
+    STAssertEquals(millis, [newYork dateTimeMillisWithYear:2011 monthOfYear:11 dayOfMonth:6 hourOfDay:1 
+                                              minuteOfHour:30 secondOfMinute:0 millisOfSecond:0], nil);
+}
+
+- (void)testTryArithmeticOverflow
+{
+    int64_t result = 42;
+    STAssertFalse(HLTryAdd(INT64_MAX, 1, &result), nil);
+    STAssertFalse(HLTryAdd(INT64_MIN, -1, &result), nil);
+    STAssertFalse(HLTrySubtract(INT64_MIN, 1, &result), nil);
+    STAssertFalse(HLTrySubtract(0, INT64_MIN, &result), nil);
+    STAssertFalse(HLTryMultiply(INT64_MIN, -1, &result), nil);
+    STAssertFalse(HLTryMultiply(INT64_MAX / 2 + 1, 2, &result), nil);
+    STAssertFalse(HLTryMultiply(INT64_MIN / 2 - 1, 2, &result), nil);
+    // a failed operation leaves the result alone
+    STAssertEquals(result, (int64_t) 42, nil);
+    
+    STAssertTrue(HLTryAdd(INT64_MAX, INT64_MIN, &result), nil);
+    STAssertEquals(result, (int64_t) -1, nil);
+    STAssertTrue(HLTrySubtract(-1, INT64_MAX, &result), nil);
+    STAssertEquals(result, INT64_MIN, nil);
+    STAssertTrue(HLTryMultiply(INT64_MIN / 2, 2, &result), nil);
+    STAssertEquals(result, INT64_MIN, nil);
+    STAssertTrue(HLTryMultiply(INT64_MAX, -1, &result), nil);
+    STAssertEquals(result, -INT64_MAX, nil);
+    
+    NSInteger narrowed = 42;
+#if NSIntegerMax < INT64_MAX
+    STAssertFalse(HLTryToInteger((int64_t) NSIntegerMax + 1, &narrowed), nil);
+    STAssertFalse(HLTryToInteger((int64_t) NSIntegerMin - 1, &narrowed), nil);
+    STAssertEquals(narrowed, (NSInteger) 42, nil);
+#endif
+    STAssertTrue(HLTryToInteger(NSIntegerMax, &narrowed), nil);
+    STAssertEquals(narrowed, NSIntegerMax, nil);
+    
+    // overflow is reported in the Horologe domain with its own code
+    NSError* error = nil;
+    HLSetError(&error, HL_ERROR_ARITHMETIC, @"The calculation caused an overflow: %lld + %lld", INT64_MAX, 1LL);
+    STAssertEqualObjects([error domain], HL_ERROR_DOMAIN, nil);
+    STAssertEquals([error code], (NSInteger) HL_ERROR_ARITHMETIC, nil);
+    STAssertEqualObjects([error localizedDescription], 
+                         @"The calculation caused an overflow: 9223372036854775807 + 1", nil);
+    HLSetError(NULL, HL_ERROR_ARITHMETIC, @"ignored");
+}
+
+//-----------------------------------------------------------------------
+- (void)testDateTimeComparatorSortArray
+{
+    HLChronology* utc = [HLISOChronology instanceUTC];
+    HLChronology* newYork = [HLISOChronology instanceWithDateTimeZone:[HLDateTimeZone forZoneId:@"America/New_York"]];
+    
+    // few distinct days, hours and minutes, so most keys collide at some limit
+    srandom(43);
+    NSMutableArray* objects = [NSMutableArray arrayWithCapacity:HL_TEST_INSTANT_COUNT];
+    for(NSUInteger i = 0; i < HL_TEST_INSTANT_COUNT; i++) {
+        int64_t millis = 1300000000000LL * (random() % 3 - 1) + 
+            (random() % 5) * 86400000LL + (random() % 3) * 3600000LL + (random() % 2) * 60000LL + random() % 3;
+        switch (random() % 3) {
+            case 0:
+                [objects addObject:[[[HLInstant alloc] initWithInstantValue:millis] autorelease]];
+                break;
+            case 1:
+                [objects addObject:[[[HLDateTime alloc] initWithInstantValue:millis chronology:utc] autorelease]];
+                break;
+            default:
+                [objects addObject:[[[HLDateTime alloc] initWithInstantValue:millis chronology:newYork] autorelease]];
+                break;
+        }
+    }
+    
+    HLDateTimeComparator* comparators[] = {
+        [HLDateTimeComparator instance],
+        [HLDateTimeComparator dateOnlyInstance],
+        [HLDateTimeComparator timeOnlyInstance],
+        [HLDateTimeComparator instanceWithLowerLimit:[HLDateTimeFieldType hourOfDay]],
+        [HLDateTimeComparator instanceWithLowerLimit:nil upperLimit:[HLDateTimeFieldType hourOfDay]],
+        [HLDateTimeComparator instanceWithLowerLimit:[HLDateTimeFieldType minuteOfHour] 
+                                          upperLimit:[HLDateTimeFieldType dayOfMonth]],
+        [HLDateTimeComparator instanceWithLowerLimit:[HLDateTimeFieldType hourOfDay] 
+                                          upperLimit:[HLDateTimeFieldType monthOfYear]],
+    };
+    for(NSUInteger c = 0; c < sizeof(comparators) / sizeof(comparators[0]); c++) {
+        HLDateTimeComparator* comparator = comparators[c];
+        NSArray* sorted = [comparator sortArray:objects];
+        STAssertEquals([sorted count], [objects count], nil);
+        
+        // each object appears once, in order, with ties in their original order
+        NSUInteger previousIndex = NSNotFound;
+        for(NSUInteger i = 0; i < [sorted count]; i++) {
+            NSUInteger index = [objects indexOfObjectIdenticalTo:[sorted objectAtIndex:i]];
+            STAssertTrue(index != NSNotFound, nil);
+            if (i > 0) {
+                NSComparisonResult order = [comparator compareLeftSide:[sorted objectAtIndex:i - 1] 
+                                                           toRightSide:[sorted objectAtIndex:i]];
+                if (order == NSOrderedDescending || (order == NSOrderedSame && previousIndex >= index)) {
+                    STFail(@"comparator %lu out of order at %lu", (unsigned long) c, (unsigned long) i);
+                    break;
+                }
+                // the keys order pairs as the comparator does
+                int64_t lhsKey = [comparator sortKeyForObject:[sorted objectAtIndex:i - 1]];
+                int64_t rhsKey = [comparator sortKeyForObject:[sorted objectAtIndex:i]];
+                STAssertEquals(lhsKey == rhsKey, order == NSOrderedSame, nil);
+            }
+            previousIndex = index;
+        }
+    }
+    
+    // short arrays come back as copies
+    NSArray* single = [NSArray arrayWithObject:[objects objectAtIndex:0]];
+    STAssertEqualObjects([[HLDateTimeComparator instance] sortArray:single], single, nil);
+    STAssertEquals([[[HLDateTimeComparator instance] sortArray:[NSArray array]] count], (NSUInteger) 0, nil);
+    STAssertThrowsSpecificNamed([[HLDateTimeComparator instance] sortArray:[NSArray arrayWithObjects:
+                                                                            [objects objectAtIndex:0], 
+                                                                            [[[NSObject alloc] init] autorelease], nil]], 
+                                NSException, HL_ILLEGAL_ARGUMENT_EXCEPTION, nil);
 }
 
 @end